@@ -0,0 +1,34 @@
+#pragma once
+
+#include "o2/Scene/ActorCreationMode.h"
+#include "o2/Utils/Types/Ref.h"
+
+namespace o2
+{
+    class Actor;
+    class BenchmarksRunner;
+
+    // Creates actors tree with image components: root actor with children, each child has few children
+    Ref<Actor> CreateBenchmarkActorsTree(int actorsCount, ActorCreateMode mode);
+
+    // Measures DataDocument JSON parsing and writing, actors serialization and Type::GetFieldPtr
+    void RunSerializationBenchmarks(BenchmarksRunner& runner);
+
+    // Measures Type::IsBasedOn over engine types graph, compared with recursive base types search
+    void RunReflectionBenchmarks(BenchmarksRunner& runner);
+
+    // Measures Ref copying and WeakRef locking. Checks references counting from few threads with thread safe refs
+    void RunRefBenchmarks(BenchmarksRunner& runner);
+
+    // Measures Curve evaluation
+    void RunMathBenchmarks(BenchmarksRunner& runner);
+
+    // Measures actors searching by name, cloning, instantiating from ActorAsset and prototype, Scene::Update with actors
+    void RunSceneBenchmarks(BenchmarksRunner& runner);
+
+    // Measures Render::DrawBuffer batching, Text layout and particles update
+    void RunRenderBenchmarks(BenchmarksRunner& runner);
+
+    // Checks widgets static batching: capture, replay equal to normal drawing, invalidation and fallback
+    void RunStaticBatchingChecks(BenchmarksRunner& runner);
+}
@@ -0,0 +1,92 @@
+#include "o2/stdafx.h"
+#include "o2/O2.h"
+
+#include "o2/Application/Application.h"
+#include "o2/Utils/Debug/Profiling/SimpleProfiler.h"
+#include "o2/Utils/System/CommandLineOptions.h"
+#include "o2Benchmarks/Benchmarks.h"
+#include "o2Benchmarks/BenchmarksRunner.h"
+
+using namespace o2;
+
+int main(int argc, char* argv[])
+{
+    INITIALIZE_O2;
+
+    const auto filterKey = "-filter";
+    const auto outputKey = "-output";
+    const auto samplesKey = "-samples";
+    const auto sampleTimeKey = "-sample-time";
+    const auto profileTraceKey = "-profile-trace";
+    const auto profileReportKey = "-profile-report";
+
+    Map<String, String> options = CommandLineOptions::Parse(argc, argv);
+
+    BenchmarksRunner runner;
+
+    if (options.ContainsKey(filterKey))
+        runner.filter = options[filterKey];
+
+    if (options.ContainsKey(samplesKey))
+        runner.samplesCount = Math::Max((int)options[samplesKey], 1);
+
+    if (options.ContainsKey(sampleTimeKey))
+        runner.minSampleTime = (float)options[sampleTimeKey];
+
+    String outputPath = "BenchmarksResults.json";
+    if (options.ContainsKey(outputKey))
+        outputPath = options[outputKey];
+
+    // Headless application gives deterministic random and doesn't require window and graphics API
+    auto application = mmake<Application>();
+    application->InitializeHeadless();
+
+    // Each benchmarks group is marked as profiler frame, so report shows groups separately
+    SimpleProfiler::Reset();
+
+    void(*benchmarks[])(BenchmarksRunner&) = {
+        &RunSerializationBenchmarks, &RunReflectionBenchmarks, &RunRefBenchmarks, &RunMathBenchmarks,
+        &RunSceneBenchmarks, &RunRenderBenchmarks, &RunStaticBatchingChecks
+    };
+
+    for (auto runBenchmarks : benchmarks)
+    {
+        runBenchmarks(runner);
+        SimpleProfiler::MarkFrame();
+    }
+
+    application->CloseHeadless();
+
+#if defined(O2_PROFILE_STATS)
+    if (options.ContainsKey(profileTraceKey))
+    {
+        if (SimpleProfiler::SaveChromeTrace(options[profileTraceKey]))
+            std::cout << "Profiler trace saved into " << options[profileTraceKey] << std::endl;
+        else
+            std::cout << "Can't save profiler trace into " << options[profileTraceKey] << std::endl;
+    }
+
+    if (options.ContainsKey(profileReportKey))
+        std::cout << SimpleProfiler::GetFramesReport(SimpleProfiler::GetFramesCount(), options[profileReportKey] != "flat") << std::endl;
+#else
+    if (options.ContainsKey(profileTraceKey) || options.ContainsKey(profileReportKey))
+        std::cout << "Profiler exports require O2_SELFPROFILE build option" << std::endl;
+#endif
+
+    if (!runner.SaveResults(outputPath))
+    {
+        std::cout << "Can't save benchmarks results into " << outputPath << std::endl;
+        return -1;
+    }
+
+    std::cout << "Benchmarks results saved into " << outputPath << std::endl;
+
+    int failedChecksCount = runner.GetFailedChecksCount();
+    if (failedChecksCount > 0)
+    {
+        std::cout << failedChecksCount << " checks failed" << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include "o2/stdafx.h"
+#include "BenchmarksRunner.h"
+
+#include <cstdio>
+#include "o2/Utils/Serialization/DataValue.h"
+
+namespace o2
+{
+    void BenchmarksRunner::Skip(const String& name, const String& reason)
+    {
+        if (!IsEnabled(name))
+            return;
+
+        Result result;
+        result.name = name;
+        result.skipped = true;
+        result.skipReason = reason;
+        mResults.Add(result);
+
+        printf("%-48s skipped: %s\n", name.Data(), reason.Data());
+    }
+
+    bool BenchmarksRunner::Check(const String& name, bool condition)
+    {
+        if (!IsEnabled(name))
+            return condition;
+
+        Result result;
+        result.name = name;
+        result.isCheck = true;
+        result.passed = condition;
+        mResults.Add(result);
+
+        printf("%-48s %s\n", name.Data(), condition ? "passed" : "FAILED");
+
+        return condition;
+    }
+
+    int BenchmarksRunner::GetFailedChecksCount() const
+    {
+        return mResults.Count([](const Result& result) { return result.isCheck && !result.passed; });
+    }
+
+    bool BenchmarksRunner::IsEnabled(const String& name) const
+    {
+        return filter.IsEmpty() || name.Find(filter) >= 0;
+    }
+
+    const Vector<BenchmarksRunner::Result>& BenchmarksRunner::GetResults() const
+    {
+        return mResults;
+    }
+
+    bool BenchmarksRunner::SaveResults(const String& fileName) const
+    {
+        DataDocument document;
+        document.AddMember("samplesCount") = samplesCount;
+        document.AddMember("minSampleTime") = minSampleTime;
+
+        auto& resultsData = document.AddMember("results");
+        resultsData.SetArray();
+
+        for (auto& result : mResults)
+        {
+            auto& resultData = resultsData.AddElement();
+            resultData.AddMember("name") = result.name;
+
+            if (result.skipped)
+            {
+                resultData.AddMember("skipped") = true;
+                resultData.AddMember("skipReason") = result.skipReason;
+                continue;
+            }
+
+            if (result.isCheck)
+            {
+                resultData.AddMember("passed") = result.passed;
+                continue;
+            }
+
+            resultData.AddMember("samplesCount") = result.samplesCount;
+            resultData.AddMember("iterationsCount") = result.iterationsCount;
+            resultData.AddMember("itemsPerIteration") = result.itemsPerIteration;
+            resultData.AddMember("minNs") = result.minTime;
+            resultData.AddMember("medianNs") = result.medianTime;
+            resultData.AddMember("meanNs") = result.meanTime;
+            resultData.AddMember("maxNs") = result.maxTime;
+            resultData.AddMember("itemsPerSecond") = result.itemsPerSecond;
+        }
+
+        return document.SaveToFile(fileName);
+    }
+
+    void BenchmarksRunner::AddResult(const String& name, int itemsPerIteration, UInt64 iterationsCount,
+                                     Vector<double>& samplesTimes)
+    {
+        std::sort(samplesTimes.begin(), samplesTimes.end());
+
+        double toIterationNs = 1e9/(double)iterationsCount;
+
+        Result result;
+        result.name = name;
+        result.samplesCount = samplesTimes.Count();
+        result.iterationsCount = iterationsCount;
+        result.itemsPerIteration = itemsPerIteration;
+        result.minTime = samplesTimes.First()*toIterationNs;
+        result.maxTime = samplesTimes.Last()*toIterationNs;
+
+        int middle = samplesTimes.Count()/2;
+        if (samplesTimes.Count() % 2 == 0)
+            result.medianTime = (samplesTimes[middle - 1] + samplesTimes[middle])*0.5*toIterationNs;
+        else
+            result.medianTime = samplesTimes[middle]*toIterationNs;
+
+        double sum = 0;
+        for (auto time : samplesTimes)
+            sum += time;
+
+        result.meanTime = sum/samplesTimes.Count()*toIterationNs;
+
+        if (result.medianTime > 0)
+            result.itemsPerSecond = itemsPerIteration*1e9/result.medianTime;
+
+        mResults.Add(result);
+
+        printf("%-48s median %12.1f ns  min %12.1f ns  max %12.1f ns  %14.0f items/s\n", name.Data(),
+               result.medianTime, result.minTime, result.maxTime, result.itemsPerSecond);
+    }
+}
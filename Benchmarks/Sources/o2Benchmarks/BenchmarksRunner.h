@@ -0,0 +1,127 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+namespace o2
+{
+    // ----------------------------------------------------------------------------------------------------------
+    // Benchmarks runner. Measures functions by samples: each sample repeats function iterations count, which is
+    // calibrated to take at least minimal sample time. Collects results and saves them into JSON file
+    // ----------------------------------------------------------------------------------------------------------
+    class BenchmarksRunner
+    {
+    public:
+        // ---------------------------------------------------------------
+        // Benchmark result. Times are in nanoseconds per single iteration
+        // ---------------------------------------------------------------
+        struct Result
+        {
+            String name;                  // Benchmark name, groups are separated by slash
+            int    samplesCount = 0;      // Count of measured samples
+            UInt64 iterationsCount = 0;   // Iterations count in each sample
+            int    itemsPerIteration = 1; // Count of processed items in one iteration
+
+            double minTime = 0;    // Minimal iteration time
+            double medianTime = 0; // Median iteration time
+            double meanTime = 0;   // Mean iteration time
+            double maxTime = 0;    // Maximal iteration time
+
+            double itemsPerSecond = 0; // Processed items per second by median time
+
+            bool   skipped = false; // Is benchmark skipped
+            String skipReason;      // Reason of skipping
+
+            bool isCheck = false; // Is it correctness check result instead of measurement
+            bool passed = false;  // Is check passed
+        };
+
+    public:
+        int    samplesCount = 15;    // Count of measured samples for each benchmark
+        double minSampleTime = 0.02; // Minimal time of one sample in seconds
+        String filter;               // Only benchmarks containing filter in name are measured. Empty filter measures all
+
+    public:
+        // Measures function and stores result. Function is called once per iteration and processes itemsPerIteration items
+        template<typename _func>
+        void Measure(const String& name, int itemsPerIteration, _func func);
+
+        // Stores skipped benchmark result with reason
+        void Skip(const String& name, const String& reason);
+
+        // Stores correctness check result. Returns condition
+        bool Check(const String& name, bool condition);
+
+        // Returns count of failed checks
+        int GetFailedChecksCount() const;
+
+        // Returns is benchmark passing filter
+        bool IsEnabled(const String& name) const;
+
+        // Returns stored results
+        const Vector<Result>& GetResults() const;
+
+        // Saves results into JSON file
+        bool SaveResults(const String& fileName) const;
+
+    protected:
+        Vector<Result> mResults; // Stored results
+
+    protected:
+        // Calculates result from samples times in seconds, prints and stores it
+        void AddResult(const String& name, int itemsPerIteration, UInt64 iterationsCount, Vector<double>& samplesTimes);
+    };
+
+    // Prevents compiler from optimizing out computation of value
+    template<typename _type>
+    inline void DoNotOptimize(const _type& value)
+    {
+#if defined(_MSC_VER)
+        static const void* volatile sink;
+        sink = &value;
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    template<typename _func>
+    void BenchmarksRunner::Measure(const String& name, int itemsPerIteration, _func func)
+    {
+        if (!IsEnabled(name))
+            return;
+
+        using Clock = std::chrono::steady_clock;
+
+        auto runSample = [&](UInt64 iterationsCount)
+        {
+            auto begin = Clock::now();
+
+            for (UInt64 i = 0; i < iterationsCount; i++)
+                func();
+
+            return std::chrono::duration<double>(Clock::now() - begin).count();
+        };
+
+        // Calibrating iterations count, it also warms up caches
+        UInt64 iterationsCount = 1;
+        while (true)
+        {
+            double time = runSample(iterationsCount);
+            if (time >= minSampleTime || iterationsCount >= (UInt64)1 << 30)
+                break;
+
+            double scale = time > 0 ? minSampleTime/time*1.2 : 10.0;
+            iterationsCount = (UInt64)(iterationsCount*std::clamp(scale, 2.0, 10.0));
+        }
+
+        Vector<double> samplesTimes;
+        samplesTimes.Reserve(samplesCount);
+
+        for (int i = 0; i < samplesCount; i++)
+            samplesTimes.Add(runSample(iterationsCount));
+
+        AddResult(name, itemsPerIteration, iterationsCount, samplesTimes);
+    }
+}
@@ -0,0 +1,93 @@
+#include "o2/stdafx.h"
+#include "Benchmarks.h"
+
+#include "o2/Utils/Math/Curve.h"
+#include "o2Benchmarks/BenchmarksRunner.h"
+
+namespace o2
+{
+    void RunMathBenchmarks(BenchmarksRunner& runner)
+    {
+        // Curve with many smooth keys, like in animations
+        const int keysCount = 32;
+        const int evaluationsCount = 1000;
+
+        Curve curve;
+        for (int i = 0; i < keysCount; i++)
+            curve.InsertKey((float)i, Math::Sin((float)i*0.7f));
+
+        float duration = (float)(keysCount - 1);
+
+        Vector<float> randomPositions;
+        for (int i = 0; i < evaluationsCount; i++)
+            randomPositions.Add(Math::Random(0.0f, duration));
+
+        runner.Measure("Math/Curve/Evaluate", evaluationsCount, [&]()
+        {
+            float sum = 0;
+            for (int i = 0; i < evaluationsCount; i++)
+                sum += curve.Evaluate(duration*(float)i/(float)evaluationsCount);
+
+            DoNotOptimize(sum);
+        });
+
+        runner.Measure("Math/Curve/EvaluateCached", evaluationsCount, [&]()
+        {
+            int cacheKey = 0, cacheKeyApprox = 0;
+
+            float sum = 0;
+            for (int i = 0; i < evaluationsCount; i++)
+                sum += curve.Evaluate(duration*(float)i/(float)evaluationsCount, 0.0f, true, cacheKey, cacheKeyApprox);
+
+            DoNotOptimize(sum);
+        });
+
+        runner.Measure("Math/Curve/EvaluateRandom", evaluationsCount, [&]()
+        {
+            float sum = 0;
+            for (auto position : randomPositions)
+                sum += curve.Evaluate(position);
+
+            DoNotOptimize(sum);
+        });
+
+        // Batch evaluation of random positions, like particles lifetimes, by keys and by baked lookup table
+        Vector<float> randomCoefs, values;
+        for (int i = 0; i < evaluationsCount; i++)
+            randomCoefs.Add(Math::Random(0.0f, 1.0f));
+
+        values.Resize(evaluationsCount);
+
+        runner.Measure("Math/Curve/EvaluateBatchRandom", evaluationsCount, [&]()
+        {
+            curve.EvaluateBatch(randomPositions.Data(), randomCoefs.Data(), values.Data(), evaluationsCount);
+            DoNotOptimize(values);
+        });
+
+        curve.BakeLookupTable();
+
+        runner.Measure("Math/Curve/EvaluateBatchRandomLookupTable", evaluationsCount, [&]()
+        {
+            curve.EvaluateBatch(randomPositions.Data(), randomCoefs.Data(), values.Data(), evaluationsCount);
+            DoNotOptimize(values);
+        });
+
+        // Lookup table with allowed error is used for smooth curves and isn't used for steps, so they aren't smoothed
+        Curve smoothCurve = Curve::EaseInOut();
+        smoothCurve.BakeLookupTable(256, 0.002f);
+        runner.Check("Checks/Math/Curve/LookupTableUsedForSmoothCurve", smoothCurve.IsLookupTableUsed());
+
+        Curve stepCurve({ Vec2F(0.0f, 0.0f), Vec2F(0.5f, 0.0f), Vec2F(0.501f, 1.0f), Vec2F(1.0f, 1.0f) }, false);
+        stepCurve.BakeLookupTable(256, 0.002f);
+
+        float stepPositions[] = { 0.4995f, 0.5005f, 0.502f };
+        float stepValues[3];
+        stepCurve.EvaluateBatch(stepPositions, nullptr, stepValues, 3);
+
+        bool stepsKept = !stepCurve.IsLookupTableUsed();
+        for (int i = 0; i < 3; i++)
+            stepsKept = stepsKept && Math::Abs(stepValues[i] - stepCurve.Evaluate(stepPositions[i])) < 0.0001f;
+
+        runner.Check("Checks/Math/Curve/LookupTableKeepsSteps", stepsKept);
+    }
+}
@@ -0,0 +1,151 @@
+#include "o2/stdafx.h"
+#include "Benchmarks.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "o2/Utils/Types/Ref.h"
+#include "o2/Utils/Types/WeakRef.h"
+#include "o2Benchmarks/BenchmarksRunner.h"
+
+namespace o2
+{
+    // Object for references benchmarks, counts its destructions
+    struct RefBenchmarkObject: public RefCounterable
+    {
+        std::atomic<int>* destroyedCount = nullptr;
+        int value = 0;
+
+        RefBenchmarkObject(std::atomic<int>* destroyedCount = nullptr):
+            destroyedCount(destroyedCount)
+        {}
+
+        ~RefBenchmarkObject()
+        {
+            if (destroyedCount)
+                destroyedCount->fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    // Measures Ref copying and WeakRef locking
+    static void RunRefCopyBenchmarks(BenchmarksRunner& runner)
+    {
+        const int copiesCount = 1000;
+
+        auto object = mmake<RefBenchmarkObject>();
+        WeakRef<RefBenchmarkObject> weakObject = object;
+
+        String mode = ENABLE_THREAD_SAFE_REFS ? "Atomic" : "Plain";
+
+        runner.Measure("Ref/" + mode + "/CopyDestroy", copiesCount, [&]()
+        {
+            for (int i = 0; i < copiesCount; i++)
+            {
+                Ref<RefBenchmarkObject> copy = object;
+                DoNotOptimize(copy);
+            }
+        });
+
+        runner.Measure("Ref/" + mode + "/WeakLock", copiesCount, [&]()
+        {
+            for (int i = 0; i < copiesCount; i++)
+            {
+                auto locked = weakObject.Lock();
+                DoNotOptimize(locked);
+            }
+        });
+    }
+
+    // Stresses references counting from few threads: copying, locking weak references and racing last strong
+    // reference releasing with locking. Run with O2_TSAN to check data races
+    static void RunRefThreadsChecks(BenchmarksRunner& runner)
+    {
+        const String copyCheckName = "Checks/Ref/Threads/CopyAndLock";
+        const String releaseCheckName = "Checks/Ref/Threads/ReleaseAndLock";
+
+        if (!ENABLE_THREAD_SAFE_REFS)
+        {
+            runner.Skip(copyCheckName, "Build with O2_THREAD_SAFE_REFS");
+            runner.Skip(releaseCheckName, "Build with O2_THREAD_SAFE_REFS");
+            return;
+        }
+
+        const int threadsCount = 4;
+        const int iterationsCount = 100000;
+        const int racesCount = 2000;
+
+        if (runner.IsEnabled(copyCheckName))
+        {
+            std::atomic<int> destroyedCount = 0;
+            std::atomic<int> failedLocksCount = 0;
+
+            {
+                auto object = mmake<RefBenchmarkObject>(&destroyedCount);
+                WeakRef<RefBenchmarkObject> weakObject = object;
+
+                std::vector<std::thread> threads;
+                for (int i = 0; i < threadsCount; i++)
+                {
+                    threads.emplace_back([&]()
+                    {
+                        for (int j = 0; j < iterationsCount; j++)
+                        {
+                            Ref<RefBenchmarkObject> copy = object;
+                            WeakRef<RefBenchmarkObject> weakCopy = weakObject;
+
+                            if (!weakCopy.Lock())
+                                failedLocksCount.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    });
+                }
+
+                for (auto& thread : threads)
+                    thread.join();
+            }
+
+            runner.Check(copyCheckName, destroyedCount == 1 && failedLocksCount == 0);
+        }
+
+        if (runner.IsEnabled(releaseCheckName))
+        {
+            std::atomic<int> destroyedCount = 0;
+            std::atomic<int> deadLocksCount = 0;
+
+            for (int i = 0; i < racesCount; i++)
+            {
+                auto object = mmake<RefBenchmarkObject>(&destroyedCount);
+                WeakRef<RefBenchmarkObject> weakObject = object;
+
+                std::atomic<bool> start = false;
+
+                std::thread locker([&]()
+                {
+                    while (!start.load(std::memory_order_acquire))
+                    {}
+
+                    // Locked object must be alive until locked reference is released
+                    if (auto locked = weakObject.Lock())
+                    {
+                        if (destroyedCount.load(std::memory_order_relaxed) != i)
+                            deadLocksCount.fetch_add(1, std::memory_order_relaxed);
+
+                        locked->value++;
+                    }
+                });
+
+                start.store(true, std::memory_order_release);
+                object = nullptr;
+
+                locker.join();
+            }
+
+            runner.Check(releaseCheckName, destroyedCount == racesCount && deadLocksCount == 0);
+        }
+    }
+
+    void RunRefBenchmarks(BenchmarksRunner& runner)
+    {
+        RunRefCopyBenchmarks(runner);
+        RunRefThreadsChecks(runner);
+    }
+}
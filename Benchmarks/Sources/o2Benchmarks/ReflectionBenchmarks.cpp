@@ -0,0 +1,71 @@
+#include "o2/stdafx.h"
+#include "Benchmarks.h"
+
+#include "o2/Utils/Reflection/Reflection.h"
+#include "o2Benchmarks/BenchmarksRunner.h"
+
+namespace o2
+{
+    // Reference recursive check through base types, as it was before ancestors bitsets
+    static bool IsBasedOnRecursive(const Type* type, const Type* other)
+    {
+        if (type == other)
+            return true;
+
+        for (auto& baseType : type->GetBaseTypes())
+        {
+            if (IsBasedOnRecursive(baseType.type, other))
+                return true;
+        }
+
+        return false;
+    }
+
+    void RunReflectionBenchmarks(BenchmarksRunner& runner)
+    {
+        // Pairs over engine types graph: each object type with its deepest ancestor and with some unrelated type
+        Vector<const Type*> objectTypes;
+        for (auto& kv : Reflection::GetTypes())
+        {
+            if (kv.second->GetUsage() == Type::Usage::Object)
+                objectTypes.Add(kv.second);
+        }
+
+        Vector<Pair<const Type*, const Type*>> typesPairs;
+        for (int i = 0; i < objectTypes.Count(); i++)
+        {
+            const Type* type = objectTypes[i];
+
+            const Type* rootType = type;
+            while (!rootType->GetBaseTypes().IsEmpty())
+                rootType = rootType->GetBaseTypes()[0].type;
+
+            typesPairs.Add(Pair<const Type*, const Type*>(type, rootType));
+            typesPairs.Add(Pair<const Type*, const Type*>(type, objectTypes[(i*7919) % objectTypes.Count()]));
+        }
+
+        if (typesPairs.IsEmpty())
+        {
+            runner.Skip("Reflection/Type/IsBasedOn", "No object types registered");
+            return;
+        }
+
+        runner.Measure("Reflection/Type/IsBasedOn", typesPairs.Count(), [&]()
+        {
+            int basedCount = 0;
+            for (auto& pair : typesPairs)
+                basedCount += pair.first->IsBasedOn(*pair.second) ? 1 : 0;
+
+            DoNotOptimize(basedCount);
+        });
+
+        runner.Measure("Reflection/Type/IsBasedOnRecursive", typesPairs.Count(), [&]()
+        {
+            int basedCount = 0;
+            for (auto& pair : typesPairs)
+                basedCount += IsBasedOnRecursive(pair.first, pair.second) ? 1 : 0;
+
+            DoNotOptimize(basedCount);
+        });
+    }
+}
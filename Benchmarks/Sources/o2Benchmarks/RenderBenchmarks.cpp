@@ -0,0 +1,393 @@
+#include "o2/stdafx.h"
+#include "Benchmarks.h"
+
+#include "o2/Assets/Assets.h"
+#include "o2/Render/DrawBatchCache.h"
+#include "o2/Render/Particles/ParticlesEffects.h"
+#include "o2/Render/Particles/ParticlesEmitter.h"
+#include "o2/Render/Render.h"
+#include "o2/Render/Spine/Spine.h"
+#include "o2/Render/Spine/SpineManager.h"
+#include "o2/Render/Sprite.h"
+#include "o2/Render/Text.h"
+#include "o2/Render/VectorFont.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2Benchmarks/BenchmarksRunner.h"
+#include "spine/Atlas.h"
+#include "spine/SkeletonJson.h"
+
+namespace o2
+{
+    // Measures capturing drawing buffers into draw batch cache, where buffers are merged into batches by texture and
+    // blend mode. It isn't render batching: in headless mode buffers are not submitted to GPU. Buffers are drawn as
+    // tracked, otherwise untracked drawing breaks capture
+    static void RunDrawCaptureBenchmarks(BenchmarksRunner& runner)
+    {
+        const int quadsCount = 1000;
+        const int quadsInBlendModeGroup = 64;
+
+        Vector<Vertex> vertices;
+        for (int i = 0; i < quadsCount; i++)
+        {
+            float x = (float)(i % 32)*10.0f, y = (float)(i/32)*10.0f;
+            vertices.Add(Vertex(x, y, 0.0f, 0xffffffff, 0.0f, 0.0f));
+            vertices.Add(Vertex(x + 10.0f, y, 0.0f, 0xffffffff, 1.0f, 0.0f));
+            vertices.Add(Vertex(x + 10.0f, y + 10.0f, 0.0f, 0xffffffff, 1.0f, 1.0f));
+            vertices.Add(Vertex(x, y + 10.0f, 0.0f, 0xffffffff, 0.0f, 1.0f));
+        }
+
+        VertexIndex quadIndexes[] = { 0, 1, 2, 0, 2, 3 };
+        auto cache = mmake<DrawBatchCache>();
+
+        runner.Measure("Render/DrawCapture", quadsCount, [&]()
+        {
+            o2Render.BeginDrawCapture(cache);
+            o2Render.BeginTrackedDrawing(nullptr);
+
+            for (int i = 0; i < quadsCount; i++)
+            {
+                BlendMode blendMode = (i/quadsInBlendModeGroup) % 2 == 0 ? BlendMode::Normal : BlendMode::Add;
+                o2Render.DrawBuffer(PrimitiveType::Polygon, vertices.Data() + i*4, 4, quadIndexes, 2, TextureRef::Null(),
+                                    blendMode);
+            }
+
+            o2Render.EndTrackedDrawing();
+            o2Render.EndDrawCapture();
+            DoNotOptimize(cache->GetBatches());
+        });
+    }
+
+    // Checks that headless render resets frame state in Begin, like render with graphics API
+    static void RunHeadlessRenderChecks(BenchmarksRunner& runner)
+    {
+        if (!runner.IsEnabled("Checks/Render/Headless/FrameStateReset"))
+            return;
+
+        Vertex vertices[] = { Vertex(0.0f, 0.0f, 0.0f, 0xffffffff, 0.0f, 0.0f),
+                              Vertex(10.0f, 0.0f, 0.0f, 0xffffffff, 1.0f, 0.0f),
+                              Vertex(10.0f, 10.0f, 0.0f, 0xffffffff, 1.0f, 1.0f) };
+        VertexIndex indexes[] = { 0, 1, 2 };
+
+        o2Render.Begin();
+        o2Render.EnableScissorTest(RectI(0, 0, 100, 100));
+        o2Render.DrawBuffer(PrimitiveType::Polygon, vertices, 3, indexes, 1, TextureRef::Null(), BlendMode::Normal);
+        o2Render.End();
+
+        o2Render.Begin();
+        bool isReset = o2Render.GetDrawingDepth() == 0.0f && o2Render.GetScissorInfos().IsEmpty() &&
+            o2Render.GetDrawCallsCount() == 0;
+        o2Render.End();
+
+        runner.Check("Checks/Render/Headless/FrameStateReset", isReset);
+    }
+
+    // Measures text layout and mesh building with word wrapping
+    static void RunTextBenchmarks(BenchmarksRunner& runner)
+    {
+        String fontPath = o2Assets.GetBuiltAssetsPath() + "debugFont.ttf";
+        if (!o2FileSystem.IsFileExist(fontPath))
+        {
+            runner.Skip("Render/Text/Layout", "Font " + fontPath + " not found, build assets first");
+            return;
+        }
+
+        WString sourceText = "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs. ";
+        WString firstText, secondText;
+        for (int i = 0; i < 8; i++)
+        {
+            firstText += sourceText;
+            secondText += sourceText;
+        }
+
+        // Texts are different, so layout is rebuilt each time
+        secondText += "!";
+
+        auto text = mmake<Text>(mmake<VectorFont>(fontPath));
+        text->SetWordWrap(true);
+        text->SetSize(Vec2F(300.0f, 400.0f));
+        text->SetText(firstText);
+        text->SetText(secondText);
+
+        bool first = true;
+        runner.Measure("Render/Text/Layout", firstText.Length(), [&]()
+        {
+            text->SetText(first ? firstText : secondText);
+            first = !first;
+        });
+    }
+
+    // Measures particles emitting and updating with effect
+    static void RunParticlesBenchmarks(BenchmarksRunner& runner)
+    {
+        const int maxParticles = 2000;
+        const float dt = 1.0f/60.0f;
+
+        auto gravity = mmake<ParticlesGravityEffect>();
+        gravity->SetGravity(Vec2F(0.0f, -100.0f));
+
+        auto emitter = mmake<ParticlesEmitter>();
+        emitter->SetMaxParticles(maxParticles);
+        emitter->SetParticlesPerSecond((float)maxParticles);
+        emitter->SetParticlesLifetime(1.0f);
+        emitter->SetEmissionDuration(1.0f);
+        emitter->SetLoop(Loop::Repeat);
+        emitter->AddEffect(gravity);
+        emitter->Play();
+
+        // Warming up until particles count is stable
+        for (int i = 0; i < 120; i++)
+            emitter->Update(dt);
+
+        runner.Measure("Render/Particles/Update", Math::Max(emitter->GetParticlesCount(), 1), [&]()
+        {
+            emitter->Update(dt);
+        });
+    }
+
+    // Tiled sprite with access to built mesh
+    class VisibleTilesSprite : public Sprite
+    {
+    public:
+        // Default constructor
+        VisibleTilesSprite(): Sprite(Color4::White()) {}
+
+        // Returns count of tiles built into mesh
+        int GetBuiltTilesCount() const { return (int)mMesh.polyCount/2; }
+    };
+
+    // Checks that tiled sprite builds only tiles inside camera and scissor rect with moved camera and inside render
+    // target. Scissor rects are in camera space, render target resets clipping
+    static void RunSpriteVisibleTilesChecks(BenchmarksRunner& runner)
+    {
+        if (!runner.IsEnabled("Checks/Render/Sprite/TiledVisibleTiles"))
+            return;
+
+        const float tileSize = 16.0f;
+
+        auto sprite = mmake<VisibleTilesSprite>();
+        sprite->SetTextureSrcRect(RectI(0, 0, 16, 16));
+        sprite->SetMode(SpriteMode::Tiled);
+        sprite->SetRect(RectF(0.0f, 0.0f, tileSize*64.0f, tileSize*64.0f));
+
+        // Visible area is aligned by tiles, allowing one extra row and column of partially visible tiles
+        auto isBuiltTiles = [&](int tilesX, int tilesY)
+        {
+            int count = sprite->GetBuiltTilesCount();
+            return count >= tilesX*tilesY && count <= (tilesX + 1)*(tilesY + 1);
+        };
+
+        o2Render.Begin();
+
+        // Camera sees 10x10 tiles in the middle of sprite, scissor clips left bottom quarter of it
+        o2Render.SetCamera(Camera(Vec2F(480.0f, 480.0f), Vec2F(160.0f, 160.0f)));
+        o2Render.EnableScissorTest(RectI(400, 400, 480, 480));
+        sprite->Draw();
+        bool movedCameraTiles = isBuiltTiles(5, 5);
+        o2Render.DisableScissorTest();
+
+        // Camera inside render target sees 16x16 tiles, there is no scissor clipping
+        TextureRef renderTarget(Vec2I(256, 256), TextureFormat::R8G8B8A8, Texture::Usage::RenderTarget);
+        o2Render.BindRenderTexture(renderTarget);
+        o2Render.SetCamera(Camera(Vec2F(512.0f, 512.0f), Vec2F(256.0f, 256.0f)));
+        sprite->Draw();
+        bool renderTargetTiles = isBuiltTiles(16, 16);
+        o2Render.UnbindRenderTexture();
+
+        o2Render.End();
+
+        runner.Check("Checks/Render/Sprite/TiledVisibleTiles", movedCameraTiles && renderTargetTiles);
+    }
+
+    // Measures sprites mesh updating by color and transform only changes. Tiled sprite is big, but visible tiles
+    // culling isn't measured: in headless mode there is no screen resolution, default camera is empty and all tiles are built
+    static void RunSpriteBenchmarks(BenchmarksRunner& runner)
+    {
+        const int spritesCount = 1000;
+        const int tilesCount = 8192;
+
+        Vector<Ref<Sprite>> sprites;
+        for (int i = 0; i < spritesCount; i++)
+        {
+            auto sprite = mmake<Sprite>(Color4::White());
+            sprite->SetTextureSrcRect(RectI(0, 0, 32, 32));
+            sprite->SetSliceBorder(BorderI(8, 8, 8, 8));
+            sprite->SetMode(SpriteMode::Sliced);
+            sprite->SetSize(Vec2F(100.0f, 50.0f));
+            sprites.Add(sprite);
+        }
+
+        int frame = 0;
+        runner.Measure("Render/Sprite/Sliced/Transparency", spritesCount, [&]()
+        {
+            frame++;
+            float transparency = (float)(frame % 100)/100.0f;
+            for (auto& sprite : sprites)
+                sprite->SetTransparency(transparency);
+        });
+
+        runner.Measure("Render/Sprite/Sliced/Move", spritesCount, [&]()
+        {
+            frame++;
+            for (int i = 0; i < spritesCount; i++)
+                sprites[i]->SetPosition(Vec2F((float)(frame % 100), (float)i));
+        });
+
+        auto tiledSprite = mmake<Sprite>(Color4::White());
+        tiledSprite->SetTextureSrcRect(RectI(0, 0, 16, 16));
+        tiledSprite->SetMode(SpriteMode::Tiled);
+        tiledSprite->SetSize(Vec2F(16.0f*128.0f, 16.0f*(float)(tilesCount/128)));
+
+        runner.Measure("Render/Sprite/Tiled/Move", tilesCount, [&]()
+        {
+            frame++;
+            tiledSprite->SetPosition(Vec2F((float)(frame % 100), 0.0f));
+        });
+    }
+
+    // Spine asset built in code: a chain of bones with a quad attachment on each and a few looped animations.
+    // Keeps spine benchmarks independent of assets folder contents. Atlas page has no texture, so draw buffers are
+    // built with empty texture
+    class BenchmarkSpineAsset : public SpineAsset
+    {
+    public:
+        // Constructor, generates skeleton with bonesCount bones
+        BenchmarkSpineAsset(int bonesCount)
+        {
+            String atlasData =
+                "benchmark.png\n"
+                "size: 64, 64\n"
+                "filter: Linear, Linear\n"
+                "quad\n"
+                "bounds: 0, 0, 32, 32\n";
+
+            mAtlas = mnew spine::Atlas(atlasData.Data(), atlasData.Length(), "", nullptr, false);
+
+            String bones = "{ \"name\": \"root\" }";
+            String slots, attachments, swingTimelines, waveTimelines;
+            for (int i = 0; i < bonesCount; i++)
+            {
+                String bone = "bone" + (String)i;
+                String parent = i == 0 ? String("root") : "bone" + (String)(i - 1);
+                String delimiter = i == 0 ? "" : ", ";
+
+                bones += ", { \"name\": \"" + bone + "\", \"parent\": \"" + parent + "\", \"length\": 20, \"x\": " +
+                    (String)(i == 0 ? 0 : 20) + " }";
+
+                slots += delimiter + "{ \"name\": \"slot" + (String)i + "\", \"bone\": \"" + bone +
+                    "\", \"attachment\": \"quad\" }";
+
+                attachments += delimiter + "\"slot" + (String)i + "\": { \"quad\": { \"x\": 10, \"width\": 32, \"height\": 32 } }";
+
+                swingTimelines += delimiter + "\"" + bone + "\": { \"rotate\": [ { \"value\": 0 }, " +
+                    "{ \"time\": 0.5, \"value\": 15 }, { \"time\": 1, \"value\": 0 } ] }";
+
+                waveTimelines += delimiter + "\"" + bone + "\": { \"translate\": [ { \"x\": 0, \"y\": 0 }, " +
+                    "{ \"time\": 0.25, \"x\": 0, \"y\": 5 }, { \"time\": 0.75, \"x\": 0, \"y\": -5 }, " +
+                    "{ \"time\": 1, \"x\": 0, \"y\": 0 } ], \"scale\": [ { \"x\": 1, \"y\": 1 }, " +
+                    "{ \"time\": 0.5, \"x\": 1.2, \"y\": 0.8 }, { \"time\": 1, \"x\": 1, \"y\": 1 } ] }";
+            }
+
+            String skeletonData =
+                "{ \"skeleton\": { \"spine\": \"4.2.00\" }, "
+                "\"bones\": [ " + bones + " ], "
+                "\"slots\": [ " + slots + " ], "
+                "\"skins\": [ { \"name\": \"default\", \"attachments\": { " + attachments + " } } ], "
+                "\"animations\": { "
+                "\"swing\": { \"bones\": { " + swingTimelines + " } }, "
+                "\"wave\": { \"bones\": { " + waveTimelines + " } } } }";
+
+            spine::SkeletonJson json(mAtlas);
+            mSkeletonData = json.readSkeletonData(skeletonData.Data());
+
+            if (mSkeletonData)
+            {
+                mAnimationStateData = mnew spine::AnimationStateData(mSkeletonData);
+                mAnimationStateData->setDefaultMix(0.2f);
+            }
+            else
+                o2Debug.LogError("Failed to build benchmark spine skeleton: %s", json.getError().buffer());
+        }
+
+        // Destructor. Skeleton data is released before atlas, attachments refer to atlas regions
+        ~BenchmarkSpineAsset()
+        {
+            delete mAnimationStateData;
+            mAnimationStateData = nullptr;
+
+            delete mSkeletonData;
+            mSkeletonData = nullptr;
+
+            delete mAtlas;
+        }
+
+    private:
+        spine::Atlas* mAtlas = nullptr; // Atlas with single region for quad attachments
+    };
+
+    // Measures spine crowd: building draw buffers, serial and batched threaded animation updates
+    static void RunSpineBenchmarks(BenchmarksRunner& runner)
+    {
+        const int spinesCount = 500;
+        const int bonesCount = 16;
+        const float dt = 1.0f/60.0f;
+
+        auto benchmarkSpineAsset = mmake<BenchmarkSpineAsset>(bonesCount);
+        if (!benchmarkSpineAsset->GetSpineSkeletonData())
+        {
+            runner.Skip("Render/Spine", "Failed to build benchmark spine skeleton");
+            return;
+        }
+
+        AssetRef<SpineAsset> spineAsset = Ref<SpineAsset>(benchmarkSpineAsset);
+
+        Vector<Ref<Spine>> spines;
+        for (int i = 0; i < spinesCount; i++)
+        {
+            auto spine = mmake<Spine>(spineAsset);
+            spine->transform = Basis::Translated(Vec2F((float)(i % 25)*100.0f, (float)(i/25)*100.0f));
+
+            auto& animations = spine->GetAnimationNames();
+            if (!animations.IsEmpty())
+                spine->GetTrack(animations[i % animations.Count()])->Play();
+
+            spines.Add(spine);
+        }
+
+        runner.Measure("Render/Spine/UpdateDrawBuffers/" + (String)spinesCount, spinesCount, [&]()
+        {
+            for (auto& spine : spines)
+            {
+                spine->Update(dt);
+                spine->UpdateDrawBuffers();
+            }
+        });
+
+        runner.Measure("Render/Spine/Update/" + (String)spinesCount, spinesCount, [&]()
+        {
+            for (auto& spine : spines)
+                spine->Update(dt);
+        });
+
+        auto& spineManager = SpineManager::Instance();
+        runner.Measure("Render/Spine/UpdateBatched/" + (String)spinesCount, spinesCount, [&]()
+        {
+            spineManager.BeginBatch();
+
+            for (auto& spine : spines)
+                spineManager.ScheduleUpdate(spine, dt);
+
+            spineManager.EndBatch();
+        });
+    }
+
+    void RunRenderBenchmarks(BenchmarksRunner& runner)
+    {
+        RunHeadlessRenderChecks(runner);
+        RunSpriteVisibleTilesChecks(runner);
+        RunDrawCaptureBenchmarks(runner);
+        RunTextBenchmarks(runner);
+        RunParticlesBenchmarks(runner);
+        RunSpriteBenchmarks(runner);
+        RunSpineBenchmarks(runner);
+    }
+}
@@ -0,0 +1,178 @@
+#include "o2/stdafx.h"
+#include "Benchmarks.h"
+
+#include "o2/Assets/Types/ActorAsset.h"
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Components/ImageComponent.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Scene/SceneLayer.h"
+#include "o2Benchmarks/BenchmarksRunner.h"
+
+namespace o2
+{
+    Ref<Actor> CreateBenchmarkActorsTree(int actorsCount, ActorCreateMode mode)
+    {
+        const int subChildrenCount = 3;
+
+        auto root = mmake<Actor>(mode);
+        root->SetName("Root");
+
+        Ref<Actor> parent = root;
+        for (int i = 1; i < actorsCount; i++)
+        {
+            auto actor = mmake<Actor>(mode);
+            actor->SetName("Actor " + (String)i);
+            actor->transform->SetPosition(Vec2F((float)(i % 32)*10.0f, (float)(i/32)*10.0f));
+            actor->AddComponent<ImageComponent>();
+
+            if ((i - 1) % (subChildrenCount + 1) == 0)
+            {
+                root->AddChild(actor);
+                parent = actor;
+            }
+            else
+                parent->AddChild(actor);
+        }
+
+        return root;
+    }
+
+    void RunSceneBenchmarks(BenchmarksRunner& runner)
+    {
+        const int actorsCount = 100;
+
+        // Clones must not be added to scene, otherwise they are accumulated there
+        auto defaultCreationMode = Actor::GetDefaultCreationMode();
+        Actor::SetDefaultCreationMode(ActorCreateMode::NotInScene);
+
+        Ref<Actor> actorsTree = CreateBenchmarkActorsTree(actorsCount, ActorCreateMode::NotInScene);
+
+        runner.Measure("Scene/Actor/Clone", actorsCount, [&]()
+        {
+            auto clone = actorsTree->CloneAsRef<Actor>();
+            DoNotOptimize(clone);
+        });
+
+        // Searching the last actor, whole tree is walked
+        String lastActorName = "Actor " + (String)(actorsCount - 1);
+        NameId lastActorNameId(lastActorName);
+
+        runner.Measure("Scene/Actor/FindChild", actorsCount, [&]()
+        {
+            auto actor = actorsTree->FindChild(lastActorName);
+            DoNotOptimize(actor);
+        });
+
+        runner.Measure("Scene/Actor/FindChildByNameId", actorsCount, [&]()
+        {
+            auto actor = actorsTree->FindChild(lastActorNameId);
+            DoNotOptimize(actor);
+        });
+
+        auto actorAsset = mmake<ActorAsset>(actorsTree);
+
+        runner.Measure("Scene/ActorAsset/Instantiate", actorsCount, [&]()
+        {
+            auto actor = actorAsset->Instantiate();
+            DoNotOptimize(actor);
+        });
+
+        AssetRef<ActorAsset> prototype(actorAsset);
+
+        runner.Measure("Scene/ActorAsset/InstantiatePrototype", actorsCount, [&]()
+        {
+            auto actor = mmake<Actor>(prototype, ActorCreateMode::NotInScene);
+            DoNotOptimize(actor);
+        });
+
+        Actor::SetDefaultCreationMode(defaultCreationMode);
+
+        // Scene updating with many actors trees
+        const float dt = 1.0f/60.0f;
+
+        for (int actorsTreesCount : { 10, 100 })
+        {
+            Vector<Ref<Actor>> sceneActors;
+            for (int i = 0; i < actorsTreesCount; i++)
+                sceneActors.Add(CreateBenchmarkActorsTree(actorsCount, ActorCreateMode::InScene));
+
+            o2Scene.Update(dt);
+
+            int sceneActorsCount = actorsTreesCount*actorsCount;
+
+            runner.Measure("Scene/Update/" + (String)sceneActorsCount, sceneActorsCount, [&]()
+            {
+                o2Scene.Update(dt);
+            });
+
+            int frame = 0;
+            runner.Measure("Scene/UpdateMoving/" + (String)sceneActorsCount, sceneActorsCount, [&]()
+            {
+                frame++;
+                for (auto& actor : sceneActors)
+                    actor->transform->SetPosition(Vec2F((float)(frame % 100), 0.0f));
+
+                o2Scene.Update(dt);
+            });
+
+            runner.Measure("Scene/ForEachComponent/" + (String)sceneActorsCount, sceneActorsCount, [&]()
+            {
+                int count = 0;
+                o2Scene.ForEachComponent<ImageComponent>([&](ImageComponent* component) { count++; });
+                DoNotOptimize(count);
+            });
+
+            // Tags queries: every second actor has tag A, every third has B, every fifth has C
+            auto tagA = o2Scene.AddTag("A");
+            auto tagB = o2Scene.AddTag("B");
+            auto tagC = o2Scene.AddTag("C");
+
+            int actorIdx = 0;
+            for (auto& actor : o2Scene.GetAllActors())
+            {
+                auto actorRef = actor.Lock();
+
+                if (actorIdx % 2 == 0)
+                    actorRef->tags.AddTag(tagA);
+
+                if (actorIdx % 3 == 0)
+                    actorRef->tags.AddTag(tagB);
+
+                if (actorIdx % 5 == 0)
+                    actorRef->tags.AddTag(tagC);
+
+                actorIdx++;
+            }
+
+            runner.Measure("Scene/FindActorsWithTags/" + (String)sceneActorsCount, sceneActorsCount, [&]()
+            {
+                auto actors = o2Scene.FindActorsWithTags({ tagA, tagB }, { tagC });
+                DoNotOptimize(actors);
+            });
+
+            // Animated drawing depth: every actor changes depth each frame, layer order is rebuilt once per request
+            auto layer = o2Scene.GetDefaultLayer();
+            Vector<Ref<Actor>> drawables;
+            for (auto& actor : o2Scene.GetAllActors())
+            {
+                auto actorRef = actor.Lock();
+                actorRef->SetDrawingDepthInheritFromParent(false);
+                drawables.Add(actorRef);
+            }
+
+            int depthFrame = 0;
+            runner.Measure("Scene/SceneLayer/AnimateDrawDepth/" + (String)sceneActorsCount, sceneActorsCount, [&]()
+            {
+                depthFrame++;
+                for (int i = 0; i < drawables.Count(); i++)
+                    drawables[i]->SetDrawingDepth((float)((i*7 + depthFrame) % 64));
+
+                DoNotOptimize(layer->GetDrawables());
+            });
+
+            drawables.Clear();
+            sceneActors.Clear();
+            o2Scene.Clear();
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#include "o2/stdafx.h"
+#include "Benchmarks.h"
+
+#include "o2/Scene/Actor.h"
+#include "o2/Utils/Serialization/DataValue.h"
+#include "o2Benchmarks/BenchmarksRunner.h"
+
+namespace o2
+{
+    void RunSerializationBenchmarks(BenchmarksRunner& runner)
+    {
+        // Building document with typical assets data: objects with strings, numbers and small arrays
+        const int objectsCount = 1000;
+
+        DataDocument sourceDocument;
+        auto& objectsData = sourceDocument.AddMember("objects");
+        objectsData.SetArray();
+
+        for (int i = 0; i < objectsCount; i++)
+        {
+            auto& objectData = objectsData.AddElement();
+            objectData.AddMember("name") = "Object " + (String)i;
+            objectData.AddMember("id") = i;
+            objectData.AddMember("enabled") = i % 2 == 0;
+            objectData.AddMember("position") = Vec2F((float)i, (float)i*0.5f);
+            objectData.AddMember("color") = Color4(i % 255, 128, 64, 255);
+
+            auto& keysData = objectData.AddMember("keys");
+            keysData.SetArray();
+            for (int j = 0; j < 8; j++)
+                keysData.AddElement() = (float)j*0.125f;
+        }
+
+        String jsonText = sourceDocument.SaveAsString();
+
+        runner.Measure("Serialization/DataDocument/ParseJSON", objectsCount, [&]()
+        {
+            DataDocument document;
+            document.LoadFromData(jsonText);
+            DoNotOptimize(document);
+        });
+
+        runner.Measure("Serialization/DataDocument/WriteJSON", objectsCount, [&]()
+        {
+            String text = sourceDocument.SaveAsString();
+            DoNotOptimize(text);
+        });
+
+        // Actors tree serialization
+        const int actorsCount = 100;
+        Ref<Actor> actorsTree = CreateBenchmarkActorsTree(actorsCount, ActorCreateMode::NotInScene);
+
+        DataDocument actorsTreeData;
+        actorsTree->Serialize(actorsTreeData);
+
+        runner.Measure("Serialization/Actor/Serialize", actorsCount, [&]()
+        {
+            DataDocument document;
+            actorsTree->Serialize(document);
+            DoNotOptimize(document);
+        });
+
+        runner.Measure("Serialization/Actor/Deserialize", actorsCount, [&]()
+        {
+            auto actor = mmake<Actor>(ActorCreateMode::NotInScene);
+            actor->Deserialize(actorsTreeData);
+            DoNotOptimize(actor);
+        });
+
+        // Fields search by path, used by animations and prototypes differences
+        const Type& actorType = actorsTree->GetType();
+        const FieldInfo* fieldInfo = nullptr;
+
+        runner.Measure("Serialization/Type/GetFieldPtr", 1, [&]()
+        {
+            void* fieldPtr = actorType.GetFieldPtr(actorsTree.Get(), "transform/position", fieldInfo);
+            DoNotOptimize(fieldPtr);
+        });
+    }
+}
@@ -0,0 +1,161 @@
+#include "o2/stdafx.h"
+#include "Benchmarks.h"
+
+#include "o2/Render/DrawBatchCache.h"
+#include "o2/Render/RectDrawable.h"
+#include "o2/Render/Render.h"
+#include "o2/Render/Sprite.h"
+#include "o2/Scene/UI/Widget.h"
+#include "o2/Scene/UI/WidgetLayout.h"
+#include "o2Benchmarks/BenchmarksRunner.h"
+
+namespace o2
+{
+    // Returns total vertices count of all cached batches
+    static int GetCachedVerticesCount(const DrawBatchCache& cache)
+    {
+        int count = 0;
+        for (auto& batch : cache.GetBatches())
+            count += batch.verticesCount;
+
+        return count;
+    }
+
+    // Returns true when caches have same vertices in same order. Batches splitting isn't compared
+    static bool IsCachedVerticesEqual(DrawBatchCache& a, DrawBatchCache& b)
+    {
+        Vector<Vertex> aVertices, bVertices;
+
+        for (auto& batch : a.GetBatches())
+            aVertices.insert(aVertices.end(), a.GetVertices(batch), a.GetVertices(batch) + batch.verticesCount);
+
+        for (auto& batch : b.GetBatches())
+            bVertices.insert(bVertices.end(), b.GetVertices(batch), b.GetVertices(batch) + batch.verticesCount);
+
+        if (aVertices.Count() != bVertices.Count())
+            return false;
+
+        for (int i = 0; i < aVertices.Count(); i++)
+        {
+            if (aVertices[i].x != bVertices[i].x || aVertices[i].y != bVertices[i].y ||
+                aVertices[i].color != bVertices[i].color)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Draws widget inside observer capture, so drawn buffers can be compared
+    static void DrawObserved(const Ref<Widget>& widget, const Ref<DrawBatchCache>& observer)
+    {
+        o2Render.BeginDrawCapture(observer);
+        widget->Draw();
+        o2Render.EndDrawCapture();
+    }
+
+    // Checks batches splitting by render state commands
+    static void RunDrawBatchCacheChecks(BenchmarksRunner& runner)
+    {
+        Vertex vertices[] = { Vertex(0, 0, 0, 0xffffffff, 0, 0), Vertex(10, 0, 0, 0xffffffff, 1, 0),
+                              Vertex(10, 10, 0, 0xffffffff, 1, 1) };
+        VertexIndex indexes[] = { 0, 1, 2 };
+
+        auto add = [&](DrawBatchCache& cache, float depth)
+        {
+            cache.Add(PrimitiveType::Polygon, vertices, 3, indexes, 1, TextureRef::Null(), BlendMode::Normal,
+                      1000, 1000, depth);
+        };
+
+        DrawBatchCache cache;
+        add(cache, 1.0f);
+        add(cache, 2.0f);
+        cache.AddCommand(DrawBatchCache::CommandType::EnableScissorTest, 2.0f, RectI(0, 0, 5, 5));
+        add(cache, 3.0f);
+        cache.AddCommand(DrawBatchCache::CommandType::DisableScissorTest, 3.0f);
+        add(cache, 4.0f);
+
+        auto& batches = cache.GetBatches();
+        runner.Check("Checks/StaticBatching/Cache/MergesBuffers", batches.Count() == 3 && batches[0].buffersCount == 2);
+        runner.Check("Checks/StaticBatching/Cache/KeepsCommandsOrder", cache.GetCommands().Count() == 5 &&
+                     cache.GetCommands()[1].type == DrawBatchCache::CommandType::EnableScissorTest &&
+                     cache.GetCommands()[3].type == DrawBatchCache::CommandType::DisableScissorTest);
+
+        auto untrackedCache = mmake<DrawBatchCache>();
+        o2Render.BeginDrawCapture(untrackedCache);
+        o2Render.DrawBuffer(PrimitiveType::Polygon, vertices, 3, indexes, 1, TextureRef::Null(), BlendMode::Normal);
+        runner.Check("Checks/StaticBatching/Cache/UntrackedDrawingBreaks", !o2Render.EndDrawCapture() &&
+                     untrackedCache->IsEmpty());
+    }
+
+    // Checks widget static batch capturing, replaying, invalidation by layout and content changes and fallback
+    static void RunWidgetStaticBatchingChecks(BenchmarksRunner& runner)
+    {
+        auto backSprite = mmake<Sprite>(Color4::White());
+
+        auto widget = mmake<Widget>();
+        *widget->layout = WidgetLayout::Based(BaseCorner::LeftBottom, Vec2F(200.0f, 200.0f));
+        widget->AddLayer("back", backSprite);
+        widget->AddLayer("front", mmake<Sprite>(Color4::Green()), Layout::BothStretch(10.0f, 10.0f, 10.0f, 10.0f));
+
+        auto child = mmake<Widget>();
+        *child->layout = WidgetLayout::Based(BaseCorner::LeftBottom, Vec2F(50.0f, 50.0f), Vec2F(20.0f, 20.0f));
+        child->AddLayer("back", mmake<Sprite>(Color4::Blue()));
+        widget->AddChild(child);
+
+        widget->UpdateTransform();
+
+        auto normalDrawing = mmake<DrawBatchCache>();
+        DrawObserved(widget, normalDrawing);
+
+        widget->SetStaticBatching(true);
+        widget->Draw();
+        runner.Check("Checks/StaticBatching/Widget/Captured", widget->IsStaticBatchActual());
+
+        auto replayedDrawing = mmake<DrawBatchCache>();
+        DrawObserved(widget, replayedDrawing);
+        runner.Check("Checks/StaticBatching/Widget/ReplayMergesBatches", replayedDrawing->GetBatches().Count() == 1 &&
+                     GetCachedVerticesCount(*replayedDrawing) == GetCachedVerticesCount(*normalDrawing));
+        runner.Check("Checks/StaticBatching/Widget/ReplayEqualsDrawing",
+                     IsCachedVerticesEqual(*replayedDrawing, *normalDrawing) &&
+                     replayedDrawing->GetDrawingDepth() == normalDrawing->GetDrawingDepth());
+
+        widget->layout->position = Vec2F(30.0f, 0.0f);
+        widget->UpdateTransform();
+        runner.Check("Checks/StaticBatching/Widget/InvalidatedByLayout", !widget->IsStaticBatchActual());
+
+        widget->Draw();
+        backSprite->SetColor(Color4::Red());
+        runner.Check("Checks/StaticBatching/Widget/InvalidatedByLayerContent", !widget->IsStaticBatchActual());
+
+        widget->Draw();
+        child->layout->position = Vec2F(40.0f, 40.0f);
+        child->UpdateTransform();
+        runner.Check("Checks/StaticBatching/Widget/InvalidatedByChild", !widget->IsStaticBatchActual());
+
+        // Redrawn cache must give same picture as normal drawing after all changes
+        widget->Draw();
+        auto changedReplayedDrawing = mmake<DrawBatchCache>();
+        DrawObserved(widget, changedReplayedDrawing);
+
+        widget->SetStaticBatching(false);
+        auto changedNormalDrawing = mmake<DrawBatchCache>();
+        DrawObserved(widget, changedNormalDrawing);
+        runner.Check("Checks/StaticBatching/Widget/ReplayEqualsDrawingAfterChanges",
+                     IsCachedVerticesEqual(*changedReplayedDrawing, *changedNormalDrawing));
+
+        // Functional drawable can draw anything, so widget is drawn normally each time
+        widget->SetStaticBatching(true);
+        widget->AddLayer("functional", mmake<FunctionalRectDrawable>([](const Basis&, const Color4&) {}));
+        widget->Draw();
+        widget->Draw();
+        runner.Check("Checks/StaticBatching/Widget/FunctionalLayerFallback", !widget->IsStaticBatchActual());
+    }
+
+    void RunStaticBatchingChecks(BenchmarksRunner& runner)
+    {
+        RunDrawBatchCacheChecks(runner);
+        RunWidgetStaticBatchingChecks(runner);
+    }
+}
@@ -1,12 +1,15 @@
 #include "CodeToolApp.h"
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <functional> 
 #include <iostream>
 #include <filesystem>
 #include <cstdarg>
 #include <cstring>
+#include <thread>
+#include "pugixml/pugixml.hpp"
 
 #undef GetClassName
 
@@ -50,8 +53,9 @@ void CodeToolApplication::SetArguments(char** args, int nargs)
     mSourcesPath = argsMap["sources"];
     mMSVCProjectPath = argsMap["msvs_project"];
     mXCodeProjectPath = argsMap["xcode_project"];
-    mNeedReset = argsMap.find("reset") != argsMap.end() || argsMap.find("r") != argsMap.end() || true;
+    mNeedReset = argsMap.find("reset") != argsMap.end() || argsMap.find("r") != argsMap.end();
     mVerbose = argsMap.find("verbose") != argsMap.end() || argsMap.find("v") != argsMap.end();
+    mThreadsCount = atoi(argsMap["threads"].c_str());
 
     mCache.parentProjects = Split(argsMap["parent_projects"], ' ');
 }
@@ -226,15 +230,14 @@ string CodeToolApplication::GetRelativePath(const string& from, const string& to
 
 void CodeToolApplication::LoadCache()
 {
-    if (mNeedReset)
-    {
-        for (auto& file : mCache.parentProjects)
-            mCache.Load(file, false);
-
+    if (!mNeedReset && mCache.Load(mSourcesPath + "/" + mCachePath))
         return;
-    }
 
-    mCache.Load(mSourcesPath + "/" + mCachePath);
+    // Cache is missing, has old format or parent projects were changed, all sources will be parsed
+    mNeedReset = true;
+
+    for (auto& file : mCache.parentProjects)
+        mCache.Load(file, false);
 }
 
 void CodeToolApplication::SaveCache()
@@ -476,40 +479,73 @@ void CodeToolApplication::UpdateProjectFilesFilter()
 
 void CodeToolApplication::UpdateCodeReflection()
 {
-    mParser = new CppSyntaxParser();
-
     // get all files in sources path
     mSourceFiles = GetFolderFiles(mSourcesPath);
 
-    // parse all headers
-    for (auto fileInfo : mSourceFiles)
+    // remove removed and changed sources from cache. Classes declared in them are changed
+    unordered_set<SyntaxFile*> removingFiles;
+    unordered_set<string> changedClasses;
+    bool attributesChanged = false;
+
+    for (auto file : mCache.originalFiles)
     {
-        if (!EndsWith(fileInfo.first, ".h"))
+        auto fnd = mSourceFiles.find(file->GetPath());
+        if (fnd != mSourceFiles.end() && fnd->second == file->GetLastEditedDate())
             continue;
 
-        ParseSource(fileInfo.first, fileInfo.second);
+        attributesChanged = CollectClassesNames(file->GetGlobalNamespace(), changedClasses) || attributesChanged;
+        removingFiles.insert(file);
+    }
+
+    mCache.RemoveOriginalFiles(removingFiles);
+
+    // parse new and changed headers
+    vector<string> parsingFiles;
+    for (auto& fileInfo : mSourceFiles)
+    {
+        if (EndsWith(fileInfo.first, ".h") && !mCache.FindOriginalFile(fileInfo.first))
+            parsingFiles.push_back(fileInfo.first);
     }
 
-    // remove old sources from cache
-    for (auto parseFileInfo = mCache.originalFiles.begin(); parseFileInfo != mCache.originalFiles.end();)
+    ParseSources(parsingFiles);
+
+    for (auto file : mParsedFiles)
+        attributesChanged = CollectClassesNames(file->GetGlobalNamespace(), changedClasses) || attributesChanged;
+
+    // parse headers dependent on changed classes, their meta must be regenerated too. Attributes are used
+    // in any meta, so all headers are dependent on them
+    unordered_set<SyntaxFile*> dependentFiles;
+    if (attributesChanged)
     {
-        auto fnd = find_if(mSourceFiles.begin(), mSourceFiles.end(), [&](auto x) { return x.first == (*parseFileInfo)->GetPath(); });
-        if (fnd == mSourceFiles.end())
+        unordered_set<SyntaxFile*> parsedFiles(mParsedFiles.begin(), mParsedFiles.end());
+        for (auto file : mCache.originalFiles)
         {
-            delete* parseFileInfo;
-            parseFileInfo = mCache.originalFiles.erase(parseFileInfo);
-            mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), *parseFileInfo));
+            if (parsedFiles.find(file) == parsedFiles.end())
+                dependentFiles.insert(file);
         }
-        else ++parseFileInfo;
+    }
+    else
+    {
+        auto dependentFilesList = GetDependentFiles(changedClasses);
+        dependentFiles.insert(dependentFilesList.begin(), dependentFilesList.end());
     }
 
+    vector<string> dependentFilesPaths;
+    for (auto file : dependentFiles)
+        dependentFilesPaths.push_back(file->GetPath());
+
+    sort(dependentFilesPaths.begin(), dependentFilesPaths.end());
+
+    mCache.RemoveOriginalFiles(dependentFiles);
+    ParseSources(dependentFilesPaths);
+
+    VerboseLog("Parsed %i changed and %i dependent files\n", (int)parsingFiles.size(), (int)dependentFilesPaths.size());
+
     mCache.UpdateGlobalNamespace();
 
     // update reflection
     for (auto file : mParsedFiles)
         UpdateSourceReflection(file);
-
-    delete mParser;
 }
 
 void CodeToolApplication::UpdateRegistratorsSource()
@@ -519,14 +555,22 @@ void CodeToolApplication::UpdateRegistratorsSource()
 
     string fileData;
 
-    for (auto& regi : mRegistatorsList)
+    // registrators are cached in files, collecting them by sources order
+    vector<string> registratorsList;
+    for (auto& fileInfo : mSourceFiles)
+    {
+        if (auto file = mCache.FindOriginalFile(fileInfo.first))
+            registratorsList.insert(registratorsList.end(), file->GetRegistrators().begin(), file->GetRegistrators().end());
+    }
+
+    for (auto& regi : registratorsList)
         fileData += "extern void __RegisterClass__" + regi + "();\n";
 
     fileData += "\n\n";
 
     fileData += "extern void InitializeTypes" + mProjectName + "()\n{\n";
 
-    for (auto& regi : mRegistatorsList)
+    for (auto& regi : registratorsList)
         fileData += "    __RegisterClass__" + regi + "();\n";
 
     fileData += "}";
@@ -537,33 +581,117 @@ void CodeToolApplication::UpdateRegistratorsSource()
         WriteFile(registratorSourcePath, fileData);
 }
 
-void CodeToolApplication::ParseSource(const string& path, const TimeStamp& editDate)
+void CodeToolApplication::ParseSources(const vector<string>& paths)
 {
-    // check edit date
-    for (auto cacheFile : mCache.originalFiles)
+    vector<SyntaxFile*> parsedFiles(paths.size(), nullptr);
+    atomic<size_t> nextFileIdx(0);
+
+    // each worker has own parser, files are taken by index, so results order doesn't depend on threads
+    auto parseFiles = [&]()
     {
-        if (path == cacheFile->GetPath())
+        CppSyntaxParser parser;
+        for (size_t i = nextFileIdx++; i < paths.size(); i = nextFileIdx++)
         {
-            if (editDate == cacheFile->GetLastEditedDate())
-                return;
+            SyntaxFile* syntaxFile = new SyntaxFile();
+            parser.ParseFile(*syntaxFile, paths[i], mSourceFiles.at(paths[i]));
+            parsedFiles[i] = syntaxFile;
+        }
+    };
 
-            delete cacheFile;
-            mCache.originalFiles.erase(find(mCache.originalFiles.begin(), mCache.originalFiles.end(), cacheFile));
-            mCache.files.erase(find(mCache.files.begin(), mCache.files.end(), cacheFile));
+    int threadsCount = mThreadsCount > 0 ? mThreadsCount : (int)thread::hardware_concurrency();
+    threadsCount = std::max(1, std::min(threadsCount, (int)paths.size()));
 
-            break;
+    vector<thread> workers;
+    for (int i = 1; i < threadsCount; i++)
+        workers.emplace_back(parseFiles);
+
+    parseFiles();
+
+    for (auto& worker : workers)
+        worker.join();
+
+    for (auto syntaxFile : parsedFiles)
+    {
+        mParsedFiles.push_back(syntaxFile);
+        mCache.AddOriginalFile(syntaxFile);
+
+        VerboseLog("Parsed %s\n", syntaxFile->GetPath().c_str());
+    }
+}
+
+// Returns class name without namespaces and template parameters
+static string GetClassShortName(const string& name)
+{
+    string res = name.substr(0, name.find('<'));
+
+    auto nspaceDelimer = res.rfind("::");
+    if (nspaceDelimer != string::npos)
+        res.erase(0, nspaceDelimer + 2);
+
+    return Trim(res);
+}
+
+bool CodeToolApplication::CollectClassesNames(SyntaxSection* section, unordered_set<string>& names) const
+{
+    bool hasAttributes = false;
+    for (auto cls : section->GetAllClasses())
+    {
+        names.insert(GetClassShortName(cls->GetName()));
+        hasAttributes = hasAttributes || !cls->GetAttributeCommentDef().empty() || !cls->GetAttributeShortDef().empty();
+    }
+
+    return hasAttributes;
+}
+
+vector<SyntaxFile*> CodeToolApplication::GetDependentFiles(unordered_set<string>& changedClasses) const
+{
+    unordered_set<SyntaxFile*> parsedFiles(mParsedFiles.begin(), mParsedFiles.end());
+
+    // base classes names of cached files
+    vector<pair<SyntaxFile*, vector<string>>> filesBaseClasses;
+    for (auto file : mCache.originalFiles)
+    {
+        if (parsedFiles.find(file) != parsedFiles.end())
+            continue;
+
+        vector<string> baseClasses;
+        for (auto cls : file->GetGlobalNamespace()->GetAllClasses())
+        {
+            for (auto& baseClass : cls->GetBaseClasses())
+                baseClasses.push_back(GetClassShortName(baseClass.GetClassName()));
         }
+
+        if (!baseClasses.empty())
+            filesBaseClasses.push_back({ file, baseClasses });
     }
 
-    // parse source
-    SyntaxFile* syntaxFile = new SyntaxFile();
-    mParser->ParseFile(*syntaxFile, path, editDate);
-    mParsedFiles.push_back(syntaxFile);
+    // names are compared without namespaces, so dependents list may be wider than required, but never narrower.
+    // Classes of dependent files are changed too, repeating until there are no new dependents
+    vector<SyntaxFile*> res;
+    bool hasNewDependents = true;
+    while (hasNewDependents)
+    {
+        hasNewDependents = false;
+        for (auto& fileInfo : filesBaseClasses)
+        {
+            if (!fileInfo.first)
+                continue;
+
+            bool isDependent = any_of(fileInfo.second.begin(), fileInfo.second.end(),
+                                      [&](const string& x) { return changedClasses.find(x) != changedClasses.end(); });
+
+            if (!isDependent)
+                continue;
+
+            res.push_back(fileInfo.first);
+            CollectClassesNames(fileInfo.first->GetGlobalNamespace(), changedClasses);
 
-    mCache.originalFiles.push_back(syntaxFile);
-    mCache.files.push_back(syntaxFile);
+            fileInfo.first = nullptr;
+            hasNewDependents = true;
+        }
+    }
 
-    VerboseLog("Parsed %s\n", path.c_str());
+    return res;
 }
 
 void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
@@ -571,6 +699,8 @@ void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
     string cppSource, cppSourceInitial;
     bool cppLoaded = false;
 
+    file->mRegistrators.clear();
+
     string hSource = file->GetData();
 
     if (hSource.find("@CODETOOLIGNORE") != string::npos)
@@ -659,7 +789,7 @@ void CodeToolApplication::UpdateSourceReflection(SyntaxFile* file)
             checkCppLoad();
 
             AddBeginMeta(hasSourceMeta, cppSource);
-            cppSource += GetClassDeclaration(cls);
+            cppSource += GetClassDeclaration(cls, file->mRegistrators);
         }
 
         AddBeginMeta(hasHeaderMeta, hSource);
@@ -698,7 +828,7 @@ void CodeToolApplication::AddEndMeta(bool hasMeta, string& res)
         res += "// --- END META ---\n";
 }
 
-string CodeToolApplication::GetClassDeclaration(SyntaxClass* cls)
+string CodeToolApplication::GetClassDeclaration(SyntaxClass* cls, vector<string>& registrators)
 {
     string res = "\n";
 
@@ -720,7 +850,7 @@ string CodeToolApplication::GetClassDeclaration(SyntaxClass* cls)
             c = '_';
     }
 
-    mRegistatorsList.push_back(classRegisterId);
+    registrators.push_back(classRegisterId);
 
     res += "DECLARE_CLASS(" + className + ", " + classRegisterId + ");\n";
 
@@ -1189,6 +1319,15 @@ bool CodeToolApplication::IsFunctionReflectable(SyntaxFunction* function, Syntax
 
 void CodeToolCache::UpdateGlobalNamespace()
 {
+    // Files order affects names resolving and attributes order, so it must not depend on which files were parsed
+    // incrementally: parent projects files go first, then original files sorted by path
+    sort(originalFiles.begin(), originalFiles.end(), [](SyntaxFile* a, SyntaxFile* b) { return a->GetPath() < b->GetPath(); });
+
+    files.erase(remove_if(files.begin(), files.end(), [&](SyntaxFile* x) { return FindOriginalFile(x->GetPath()) == x; }),
+                files.end());
+
+    files.insert(files.end(), originalFiles.begin(), originalFiles.end());
+
     for (auto file : files)
     {
         SyntaxSection* fileGlobalNamespace = file->GetGlobalNamespace();
@@ -1388,54 +1527,137 @@ void CodeToolCache::SearchAttributes(SyntaxSection* section, SyntaxClass* attrib
     }
 }
 
-void CodeToolCache::Save(const string& file) const
+SyntaxFile* CodeToolCache::FindOriginalFile(const string& path) const
 {
-    pugi::xml_document doc;
+    auto fnd = originalFilesIndex.find(path);
+    if (fnd != originalFilesIndex.end())
+        return fnd->second;
+
+    return nullptr;
+}
 
-    pugi::xml_node filesNode = doc.append_child("files");
-    for (auto file : originalFiles) {
-        auto file_node = filesNode.append_child("file");
-        file->SaveTo(file_node);
+void CodeToolCache::AddOriginalFile(SyntaxFile* file)
+{
+    originalFiles.push_back(file);
+    files.push_back(file);
+    originalFilesIndex[file->GetPath()] = file;
+}
+
+void CodeToolCache::RemoveOriginalFiles(const unordered_set<SyntaxFile*>& removingFiles)
+{
+    if (removingFiles.empty())
+        return;
+
+    auto isRemoving = [&](SyntaxFile* x) { return removingFiles.find(x) != removingFiles.end(); };
+    originalFiles.erase(remove_if(originalFiles.begin(), originalFiles.end(), isRemoving), originalFiles.end());
+    files.erase(remove_if(files.begin(), files.end(), isRemoving), files.end());
+
+    for (auto file : removingFiles)
+    {
+        originalFilesIndex.erase(file->GetPath());
+        delete file;
     }
+}
+
+void CodeToolCache::Save(const string& file) const
+{
+    BinaryCacheWriter writer;
+    writer.WriteString(mFormatSignature);
+    writer.WriteInt(mFormatVersion);
 
-    pugi::xml_node parentProjsNode = doc.append_child("parentProjects");
-    for (auto& proj : parentProjects)
-        parentProjsNode.append_child("project").append_attribute("path") = proj.c_str();
+    writer.WriteUInt(originalFiles.size());
+    for (auto file : originalFiles)
+        file->SaveTo(writer);
 
-    doc.save_file(file.c_str());
+    writer.WriteStrings(parentProjects);
+
+    // Parent projects caches hashes are the part of cache key: when parent changes, child is fully regenerated
+    for (auto& parentProject : parentProjects)
+        writer.WriteUInt(GetFileHash(parentProject));
+
+    ofstream fout(file.c_str(), ios::binary);
+    if (!fout.is_open())
+        return;
+
+    fout.write(writer.GetData().data(), writer.GetData().length());
 }
 
-void CodeToolCache::Load(const string& file, bool original /*= true*/)
+bool CodeToolCache::Load(const string& file, bool original /*= true*/)
 {
-    pugi::xml_document doc;
-    doc.load_file(file.c_str());
+    ifstream fin(file.c_str(), ios::binary);
+    if (!fin.is_open())
+        return false;
+
+    string data = string((istreambuf_iterator<char>(fin)), istreambuf_iterator<char>());
+    fin.close();
+
+    BinaryCacheReader reader(data);
+    if (reader.ReadString() != mFormatSignature || reader.ReadInt() != mFormatVersion)
+        return false;
 
-    pugi::xml_node filesNode = doc.child("files");
-    for (auto x : filesNode)
+    SyntaxFilesVec loadedFiles;
+    auto filesCount = reader.ReadUInt();
+    for (unsigned long long i = 0; i < filesCount && reader.IsOk(); i++)
     {
         SyntaxFile* newFile = new SyntaxFile();
-        newFile->LoadFrom(x);
-        files.push_back(newFile);
-
-        if (original)
-            originalFiles.push_back(newFile);
+        newFile->LoadFrom(reader);
+        loadedFiles.push_back(newFile);
     }
 
+    vector<string> loadedParentProjects = reader.ReadStrings();
+
+    vector<unsigned long long> loadedParentProjectsHashes;
+    for (size_t i = 0; i < loadedParentProjects.size() && reader.IsOk(); i++)
+        loadedParentProjectsHashes.push_back(reader.ReadUInt());
+
+    bool parentProjectsChanged = false;
     if (original)
     {
-        for (auto x : parentProjects)
-            Load(x, false);
+        parentProjectsChanged = loadedParentProjects != parentProjects;
+        for (size_t i = 0; i < loadedParentProjectsHashes.size() && !parentProjectsChanged; i++)
+            parentProjectsChanged = loadedParentProjectsHashes[i] != GetFileHash(loadedParentProjects[i]);
     }
-    else
+
+    if (!reader.IsOk() || parentProjectsChanged)
     {
-        pugi::xml_node parentProjsNode = doc.child("parentProjects");
-        for (auto x : parentProjsNode)
-        {
-            string path = x.attribute("path").as_string();
-            parentProjects.push_back(path);
-            Load(path, false);
-        }
+        for (auto x : loadedFiles)
+            delete x;
+
+        return false;
     }
+
+    for (auto x : loadedFiles)
+    {
+        if (original)
+            AddOriginalFile(x);
+        else
+            files.push_back(x);
+    }
+
+    // Parent projects of current project are set by arguments, parents of parent projects are read from their caches
+    for (auto& x : original ? parentProjects : loadedParentProjects)
+        Load(x, false);
+
+    return true;
+}
+
+unsigned long long CodeToolCache::GetFileHash(const string& file)
+{
+    ifstream fin(file.c_str(), ios::binary);
+    if (!fin.is_open())
+        return 0;
+
+    // FNV-1a
+    unsigned long long hash = 0xCBF29CE484222325ull;
+
+    char buffer[4096];
+    while (fin.read(buffer, sizeof(buffer)) || fin.gcount() > 0)
+    {
+        for (streamsize i = 0; i < fin.gcount(); i++)
+            hash = (hash ^ (unsigned char)buffer[i])*0x100000001B3ull;
+    }
+
+    return hash;
 }
 
 void CodeToolCache::AppendSection(SyntaxSection* currentSection, SyntaxSection* newSection)
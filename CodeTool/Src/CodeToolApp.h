@@ -1,6 +1,8 @@
 #pragma once
 
 #include <chrono>
+#include <unordered_map>
+#include <unordered_set>
 #include "CppSyntaxParser.h"
 
 class Timer
@@ -31,6 +33,8 @@ public:
     SyntaxClassesVec attributes;      // Allattribute classes
     vector<string>   parentProjects;  // Parent projects code tool caches, that used in current project
 
+    unordered_map<string, SyntaxFile*> originalFilesIndex; // Original syntax files by path
+
     // Updates global namespace
     void UpdateGlobalNamespace();
 
@@ -46,13 +50,30 @@ public:
     // Returns section by name in where
     SyntaxSection* FindSection(const string& what, SyntaxSection* where, bool withTypedefs = true);
 
+    // Returns original file by path, nullptr when file isn't cached
+    SyntaxFile* FindOriginalFile(const string& path) const;
+
+    // Adds parsed original file
+    void AddOriginalFile(SyntaxFile* file);
+
+    // Removes and deletes original files
+    void RemoveOriginalFiles(const unordered_set<SyntaxFile*>& removingFiles);
+
     // Saves data to file
     void Save(const string& file) const;
 
-    // Loads data from file
-    void Load(const string& file, bool original = true);
+    // Loads data from file. Returns false when file is missing, has incompatible format, or when original cache was
+    // made with other parent projects caches: parent classes could be changed, so project must be fully regenerated
+    bool Load(const string& file, bool original = true);
+
+protected:
+    static constexpr const char* mFormatSignature = "o2CodeToolCache"; // Cache file signature
+    static constexpr int         mFormatVersion = 2;                   // Cache format version, must be increased on changes
 
 protected:
+    // Returns hash of file content, 0 when file is missing
+    static unsigned long long GetFileHash(const string& file);
+
     void AppendSection(SyntaxSection* currentSection, SyntaxSection* newSection);
     void ResolveDependencies(SyntaxSection* section);
     void ResolveBaseClassDependencies(SyntaxSection* section);
@@ -85,22 +106,20 @@ public:
     static void VerboseLog(const char* format, ...);
 
 protected:
-    string                 mCachePath = "CodeToolCache.xml";
+    string                 mCachePath = "CodeToolCache.bin";
                            
     string                 mProjectName;
     string                 mSourcesPath;
     string                 mMSVCProjectPath;
     string                 mXCodeProjectPath;
     bool                   mNeedReset = true;
+    int                    mThreadsCount = 0;
     static bool            mVerbose;
                            
-    CppSyntaxParser*       mParser;
     vector<SyntaxFile*>    mParsedFiles;
     CodeToolCache          mCache;
     map<string, TimeStamp> mSourceFiles;
 
-    vector<string>         mRegistatorsList;
-
 protected:
     // Returns list of all files in path and in sub paths
     map<string, TimeStamp> GetFolderFiles(const string& path);
@@ -144,8 +163,14 @@ protected:
     // Generates classes registrators list source file
     void UpdateRegistratorsSource();
 
-    // Parses source file
-    void ParseSource(const string& path, const TimeStamp& editDate);
+    // Parses source files in parallel and adds them into cache
+    void ParseSources(const vector<string>& paths);
+
+    // Collects short names of classes declared in section. Returns is any of them is attribute class
+    bool CollectClassesNames(SyntaxSection* section, unordered_set<string>& names) const;
+
+    // Returns cached files, which classes are based on classes with changed names, including dependents of dependents
+    vector<SyntaxFile*> GetDependentFiles(unordered_set<string>& changedClasses) const;
 
     // Updates reflection for classes in source
     void UpdateSourceReflection(SyntaxFile* file);
@@ -156,8 +181,8 @@ protected:
     // Adds meta comment end section
     void AddEndMeta(bool hasMeta, string& res);
 
-    // Returns class declaration meta
-    string GetClassDeclaration(SyntaxClass* cls);
+    // Returns class declaration meta, adds class registrator into list
+    string GetClassDeclaration(SyntaxClass* cls, vector<string>& registrators);
 
     // Returns class reflection meta
     string GetClassMeta(SyntaxClass* cls);
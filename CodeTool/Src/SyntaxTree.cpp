@@ -31,23 +31,28 @@ SyntaxNamespace* SyntaxFile::GetGlobalNamespace() const
     return mGlobalNamespace;
 }
 
-void SyntaxFile::SaveTo(pugi::xml_node& node) const
+const vector<string>& SyntaxFile::GetRegistrators() const
 {
-    node.append_attribute("path") = mPath.c_str();
-    auto date = node.append_child("date");
-    mLastEditedDate.SaveTo(date);
-    auto globalNamespace = node.append_child("globalNamespace");
-    mGlobalNamespace->SaveTo(globalNamespace);
+    return mRegistrators;
 }
 
-void SyntaxFile::LoadFrom(const pugi::xml_node& node)
+void SyntaxFile::SaveTo(BinaryCacheWriter& writer) const
 {
-    mPath = node.attribute("path").as_string();
-    mLastEditedDate.LoadFrom(node.child("date"));
+    writer.WriteString(mPath);
+    mLastEditedDate.SaveTo(writer);
+    writer.WriteStrings(mRegistrators);
+    mGlobalNamespace->SaveTo(writer);
+}
+
+void SyntaxFile::LoadFrom(BinaryCacheReader& reader)
+{
+    mPath = reader.ReadString();
+    mLastEditedDate.LoadFrom(reader);
+    mRegistrators = reader.ReadStrings();
 
     delete mGlobalNamespace;
     mGlobalNamespace = new SyntaxNamespace();
-    mGlobalNamespace->LoadFrom(node.child("globalNamespace"));
+    mGlobalNamespace->LoadFrom(reader);
 }
 
 int ISyntaxExpression::GetBegin() const
@@ -257,71 +262,59 @@ const SyntaxAttributesVec& SyntaxSection::GetAttributes() const
     return mAttributes;
 }
 
-void SyntaxSection::SaveTo(pugi::xml_node& node) const
+void SyntaxSection::SaveTo(BinaryCacheWriter& writer) const
 {
-    node.append_attribute("name") = mName.c_str();
-    node.append_attribute("fullname") = mFullName.c_str();
+    writer.WriteString(mName);
+    writer.WriteString(mFullName);
 
-    pugi::xml_node sectionsNode = node.append_child("sections");
-    for (auto x : mSections) {
-        auto section = sectionsNode.append_child("section");
-        x->SaveTo(section);
+    writer.WriteUInt(mSections.size());
+    for (auto x : mSections)
+    {
+        writer.WriteBool(x->IsClass());
+        x->SaveTo(writer);
     }
 
-    pugi::xml_node typedefsNode = node.append_child("typedefs");
-    for (auto x : mTypedefs) {
-        auto td = typedefsNode.append_child("typedef");
-        x->SaveTo(td);
-    }
+    writer.WriteUInt(mTypedefs.size());
+    for (auto x : mTypedefs)
+        x->SaveTo(writer);
 
-    pugi::xml_node usingsNode = node.append_child("usings");
-    for (auto x : mUsingNamespaces) {
-        auto td = usingsNode.append_child("typedef");
-        x->SaveTo(td);
-    }
+    writer.WriteUInt(mUsingNamespaces.size());
+    for (auto x : mUsingNamespaces)
+        x->SaveTo(writer);
 }
 
-void SyntaxSection::LoadFrom(const pugi::xml_node& node)
+void SyntaxSection::LoadFrom(BinaryCacheReader& reader)
 {
-    mName = node.attribute("name").as_string();
-    mFullName = node.attribute("fullname").as_string();
+    mName = reader.ReadString();
+    mFullName = reader.ReadString();
 
-    pugi::xml_node sectionsNode = node.child("sections");
-    for (auto node:sectionsNode)
+    auto sectionsCount = reader.ReadUInt();
+    for (unsigned long long i = 0; i < sectionsCount && reader.IsOk(); i++)
     {
-        if (node.type() != pugi::node_element)
-            continue;
-
         SyntaxSection* newSection;
-        if (node.attribute("isClass"))
+        if (reader.ReadBool())
             newSection = new SyntaxClass();
         else
             newSection = new SyntaxNamespace();
 
-        newSection->LoadFrom(node);
+        newSection->LoadFrom(reader);
         newSection->mParentSection = this;
         mSections.push_back(newSection);
     }
 
-    pugi::xml_node typedefsNode = node.child("typedefs");
-    for (auto node:typedefsNode)
+    auto typedefsCount = reader.ReadUInt();
+    for (unsigned long long i = 0; i < typedefsCount && reader.IsOk(); i++)
     {
-        if (node.type() != pugi::node_element)
-            continue;
-
         SyntaxTypedef* newTypedef = new SyntaxTypedef();
-        newTypedef->LoadFrom(node);
+        newTypedef->LoadFrom(reader);
         mTypedefs.push_back(newTypedef);
     }
 
-    pugi::xml_node usingsNode = node.child("usings");
-    for (auto node:usingsNode)
+    auto usingsCount = reader.ReadUInt();
+    for (unsigned long long i = 0; i < usingsCount && reader.IsOk(); i++)
     {
-        if (node.type() != pugi::node_element)
-            continue;
-
         SyntaxUsingNamespace* newUsing = new SyntaxUsingNamespace();
-        newUsing->LoadFrom(node);
+        newUsing->LoadFrom(reader);
         mUsingNamespaces.push_back(newUsing);
     }
 }
@@ -450,39 +443,36 @@ const SyntaxAttributesVec& SyntaxClass::GetAttributes() const
     return SyntaxSection::GetAttributes();
 }
 
-void SyntaxClass::SaveTo(pugi::xml_node& node) const
+void SyntaxClass::SaveTo(BinaryCacheWriter& writer) const
 {
-    SyntaxSection::SaveTo(node);
+    SyntaxSection::SaveTo(writer);
 
-    node.append_attribute("isClass") = true;
-    node.append_attribute("isMeta") = mIsMeta;
-    node.append_attribute("templates") = mTemplateParameters.c_str();
-    node.append_attribute("protection") = (int)mClassSection;
-    node.append_attribute("attributeCommentDef") = mAttributeCommentDef.c_str();
-    node.append_attribute("attributeShortDef") = mAttributeShortDef.c_str();
+    writer.WriteBool(mIsMeta);
+    writer.WriteString(mTemplateParameters);
+    writer.WriteInt((int)mClassSection);
+    writer.WriteString(mAttributeCommentDef);
+    writer.WriteString(mAttributeShortDef);
 
-    pugi::xml_node baseClassesNode = node.append_child("baseClasses");
-    for (auto& x : mBaseClasses) {
-        auto nc = baseClassesNode.append_child("class");
-        x.SaveTo(nc);
-    }
+    writer.WriteUInt(mBaseClasses.size());
+    for (auto& x : mBaseClasses)
+        x.SaveTo(writer);
 }
 
-void SyntaxClass::LoadFrom(const pugi::xml_node& node)
+void SyntaxClass::LoadFrom(BinaryCacheReader& reader)
 {
-    SyntaxSection::LoadFrom(node);
+    SyntaxSection::LoadFrom(reader);
 
-    mIsMeta = node.attribute("isMeta").as_bool();
-    mTemplateParameters = node.attribute("templates").as_string();
-    mClassSection = (SyntaxProtectionSection)node.attribute("protection").as_int();
-    mAttributeCommentDef = node.attribute("attributeCommentDef").as_string();
-    mAttributeShortDef = node.attribute("attributeShortDef").as_string();
+    mIsMeta = reader.ReadBool();
+    mTemplateParameters = reader.ReadString();
+    mClassSection = (SyntaxProtectionSection)reader.ReadInt();
+    mAttributeCommentDef = reader.ReadString();
+    mAttributeShortDef = reader.ReadString();
 
-    pugi::xml_node baseClassesNode = node.child("baseClasses");
-    for (auto node : baseClassesNode)
+    auto baseClassesCount = reader.ReadUInt();
+    for (unsigned long long i = 0; i < baseClassesCount && reader.IsOk(); i++)
     {
         SyntaxClassInheritance x;
-        x.LoadFrom(node);
+        x.LoadFrom(reader);
         mBaseClasses.push_back(x);
     }
 }
@@ -620,16 +610,16 @@ SyntaxProtectionSection SyntaxClassInheritance::GetInheritanceType() const
     return mInheritanceType;
 }
 
-void SyntaxClassInheritance::SaveTo(pugi::xml_node& node) const
+void SyntaxClassInheritance::SaveTo(BinaryCacheWriter& writer) const
 {
-    node.append_attribute("name") = mClassName.c_str();
-    node.append_attribute("protection") = (int)mInheritanceType;
+    writer.WriteString(mClassName);
+    writer.WriteInt((int)mInheritanceType);
 }
 
-void SyntaxClassInheritance::LoadFrom(const pugi::xml_node& node)
+void SyntaxClassInheritance::LoadFrom(BinaryCacheReader& reader)
 {
-    mClassName = node.attribute("name").as_string();
-    mInheritanceType = (SyntaxProtectionSection)node.attribute("protection").as_int();
+    mClassName = reader.ReadString();
+    mInheritanceType = (SyntaxProtectionSection)reader.ReadInt();
 }
 
 bool SyntaxClassInheritance::operator==(const SyntaxClassInheritance& other) const
@@ -647,14 +637,14 @@ SyntaxSection* SyntaxUsingNamespace::GetUsingNamespace() const
     return mUsingNamespace;
 }
 
-void SyntaxUsingNamespace::SaveTo(pugi::xml_node& node) const
+void SyntaxUsingNamespace::SaveTo(BinaryCacheWriter& writer) const
 {
-    node.append_attribute("name") = mUsingNamespaceName.c_str();
+    writer.WriteString(mUsingNamespaceName);
 }
 
-void SyntaxUsingNamespace::LoadFrom(const pugi::xml_node& node)
+void SyntaxUsingNamespace::LoadFrom(BinaryCacheReader& reader)
 {
-    mUsingNamespaceName = node.attribute("name").as_string();
+    mUsingNamespaceName = reader.ReadString();
 }
 
 const string& SyntaxTypedef::GetWhatName() const
@@ -677,16 +667,16 @@ SyntaxSection* SyntaxTypedef::GetNewDef() const
     return mWhatSection;
 }
 
-void SyntaxTypedef::SaveTo(pugi::xml_node& node) const
+void SyntaxTypedef::SaveTo(BinaryCacheWriter& writer) const
 {
-    node.append_attribute("what") = mWhatName.c_str();
-    node.append_attribute("newDef") = mNewDefName.c_str();
+    writer.WriteString(mWhatName);
+    writer.WriteString(mNewDefName);
 }
 
-void SyntaxTypedef::LoadFrom(const pugi::xml_node& node)
+void SyntaxTypedef::LoadFrom(BinaryCacheReader& reader)
 {
-    mWhatName = node.attribute("what").as_string();
-    mNewDefName = node.attribute("newDef").as_string();
+    mWhatName = reader.ReadString();
+    mNewDefName = reader.ReadString();
 }
 
 TimeStamp::TimeStamp(int seconds /*= 0*/, int minutes /*= 0*/, int hours /*= 0*/, int days /*= 0*/, int months /*= 0*/,
@@ -694,24 +684,24 @@ TimeStamp::TimeStamp(int seconds /*= 0*/, int minutes /*= 0*/, int hours /*= 0*/
     second(seconds), minute(minutes), hour(hours), day(days), month(months), year(years)
 {}
 
-void TimeStamp::SaveTo(pugi::xml_node& node) const
+void TimeStamp::SaveTo(BinaryCacheWriter& writer) const
 {
-    node.append_attribute("year") = year;
-    node.append_attribute("month") = month;
-    node.append_attribute("day") = day;
-    node.append_attribute("hour") = hour;
-    node.append_attribute("minute") = minute;
-    node.append_attribute("second") = second;
+    writer.WriteInt(year);
+    writer.WriteInt(month);
+    writer.WriteInt(day);
+    writer.WriteInt(hour);
+    writer.WriteInt(minute);
+    writer.WriteInt(second);
 }
 
-void TimeStamp::LoadFrom(const pugi::xml_node& node)
+void TimeStamp::LoadFrom(BinaryCacheReader& reader)
 {
-    year = node.attribute("year").as_int();
-    month = node.attribute("month").as_int();
-    day = node.attribute("day").as_int();
-    hour = node.attribute("hour").as_int();
-    minute = node.attribute("minute").as_int();
-    second = node.attribute("second").as_int();
+    year = reader.ReadInt();
+    month = reader.ReadInt();
+    day = reader.ReadInt();
+    hour = reader.ReadInt();
+    minute = reader.ReadInt();
+    second = reader.ReadInt();
 }
 
 bool TimeStamp::operator!=(const TimeStamp& wt) const
@@ -734,3 +724,115 @@ const std::string& SyntaxDefineIf::GetDefinition() const
 {
     return mDefintion;
 }
+
+void BinaryCacheWriter::WriteUInt(unsigned long long value)
+{
+    while (value >= 0x80)
+    {
+        mData.push_back((char)((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+
+    mData.push_back((char)value);
+}
+
+void BinaryCacheWriter::WriteInt(int value)
+{
+    WriteUInt((unsigned int)value);
+}
+
+void BinaryCacheWriter::WriteBool(bool value)
+{
+    mData.push_back(value ? 1 : 0);
+}
+
+void BinaryCacheWriter::WriteString(const string& value)
+{
+    WriteUInt(value.length());
+    mData.append(value);
+}
+
+void BinaryCacheWriter::WriteStrings(const vector<string>& value)
+{
+    WriteUInt(value.size());
+    for (auto& x : value)
+        WriteString(x);
+}
+
+const string& BinaryCacheWriter::GetData() const
+{
+    return mData;
+}
+
+BinaryCacheReader::BinaryCacheReader(const string& data):
+    mData(data)
+{}
+
+unsigned long long BinaryCacheReader::ReadUInt()
+{
+    unsigned long long res = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (mCaret >= mData.length())
+            break;
+
+        unsigned char byte = (unsigned char)mData[mCaret++];
+        res |= (unsigned long long)(byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0)
+            return res;
+    }
+
+    mFailed = true;
+    return 0;
+}
+
+int BinaryCacheReader::ReadInt()
+{
+    return (int)(unsigned int)ReadUInt();
+}
+
+bool BinaryCacheReader::ReadBool()
+{
+    if (mCaret >= mData.length())
+    {
+        mFailed = true;
+        return false;
+    }
+
+    return mData[mCaret++] != 0;
+}
+
+string BinaryCacheReader::ReadString()
+{
+    auto length = ReadUInt();
+    if (mFailed || length > mData.length() - mCaret)
+    {
+        mFailed = true;
+        return string();
+    }
+
+    string res = mData.substr(mCaret, (size_t)length);
+    mCaret += (size_t)length;
+    return res;
+}
+
+vector<string> BinaryCacheReader::ReadStrings()
+{
+    vector<string> res;
+    auto count = ReadUInt();
+    for (unsigned long long i = 0; i < count && !mFailed; i++)
+        res.push_back(ReadString());
+
+    return res;
+}
+
+bool BinaryCacheReader::IsOk() const
+{
+    return !mFailed;
+}
+
+bool BinaryCacheReader::IsEnd() const
+{
+    return mCaret >= mData.length();
+}
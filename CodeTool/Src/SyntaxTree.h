@@ -3,7 +3,6 @@
 #include <string>
 #include <vector>
 #include <map>
-#include "pugixml/pugixml.hpp"
 
 #undef GetClassName
 
@@ -40,6 +39,66 @@ typedef vector<string>                StringsVec;
 
 enum class SyntaxProtectionSection { Public, Private, Protected };
 
+// Binary cache writer. Integers are stored as variable-length, strings are length-prefixed
+class BinaryCacheWriter
+{
+public:
+    // Writes unsigned integer
+    void WriteUInt(unsigned long long value);
+
+    // Writes integer
+    void WriteInt(int value);
+
+    // Writes boolean
+    void WriteBool(bool value);
+
+    // Writes string
+    void WriteString(const string& value);
+
+    // Writes strings list
+    void WriteStrings(const vector<string>& value);
+
+    // Returns written data
+    const string& GetData() const;
+
+protected:
+    string mData; // Written data
+};
+
+// Binary cache reader. When data is corrupted, reader fails and returns default values
+class BinaryCacheReader
+{
+public:
+    // Constructor by data
+    BinaryCacheReader(const string& data);
+
+    // Reads unsigned integer
+    unsigned long long ReadUInt();
+
+    // Reads integer
+    int ReadInt();
+
+    // Reads boolean
+    bool ReadBool();
+
+    // Reads string
+    string ReadString();
+
+    // Reads strings list
+    vector<string> ReadStrings();
+
+    // Returns is data read without errors
+    bool IsOk() const;
+
+    // Returns is all data read
+    bool IsEnd() const;
+
+protected:
+    const string& mData;           // Reading data
+    size_t        mCaret = 0;      // Current reading position
+    bool          mFailed = false; // Is reading failed
+};
+
 // Date time stamp
 struct TimeStamp
 {
@@ -50,11 +109,11 @@ struct TimeStamp
     bool operator==(const TimeStamp& wt) const;
     bool operator!=(const TimeStamp& wt) const;
 
-    // Saves data to xml node
-    void SaveTo(pugi::xml_node& node) const;
+    // Saves data to binary cache
+    void SaveTo(BinaryCacheWriter& writer) const;
 
-    // Loads data from xml node
-    void LoadFrom(const pugi::xml_node& node);
+    // Loads data from binary cache
+    void LoadFrom(BinaryCacheReader& reader);
 };
 
 // Abstract syntax tree file
@@ -79,11 +138,14 @@ public:
     // Returns global syntax namespace in this file
     SyntaxNamespace* GetGlobalNamespace() const;
 
-    // Saves data to xml node
-    void SaveTo(pugi::xml_node& node) const;
+    // Returns registrators of classes declared in file
+    const vector<string>& GetRegistrators() const;
+
+    // Saves data to binary cache
+    void SaveTo(BinaryCacheWriter& writer) const;
 
-    // Loads data from xml node
-    void LoadFrom(const pugi::xml_node& node);
+    // Loads data from binary cache
+    void LoadFrom(BinaryCacheReader& reader);
 
 protected:
     string mPath; // File path
@@ -91,6 +153,8 @@ protected:
 
     TimeStamp mLastEditedDate; // Last file edited date
 
+    vector<string> mRegistrators; // Registrators of classes declared in file. Cached, so registrators source can be built without parsing
+
     SyntaxNamespace* mGlobalNamespace = nullptr; // Global syntax namespace in file
 
     friend class CppSyntaxParser;
@@ -151,11 +215,11 @@ public:
     // Returns using namespace (if found)
     SyntaxSection* GetUsingNamespace() const;
 
-    // Saves data to xml node
-    void SaveTo(pugi::xml_node& node) const;
+    // Saves data to binary cache
+    void SaveTo(BinaryCacheWriter& writer) const;
 
-    // Loads data from xml node
-    void LoadFrom(const pugi::xml_node& node);
+    // Loads data from binary cache
+    void LoadFrom(BinaryCacheReader& reader);
 
 protected:
     string         mUsingNamespaceName;       // Using namespace name
@@ -181,11 +245,11 @@ public:
     // Returns new defined name (Y)
     SyntaxSection* GetNewDef() const;
 
-    // Saves data to xml node
-    void SaveTo(pugi::xml_node& node) const;
+    // Saves data to binary cache
+    void SaveTo(BinaryCacheWriter& writer) const;
 
-    // Loads data from xml node
-    void LoadFrom(const pugi::xml_node& node);
+    // Loads data from binary cache
+    void LoadFrom(BinaryCacheReader& reader);
 
 protected:
     string         mWhatName;              // What was used to defined name (X)
@@ -254,11 +318,11 @@ public:
     // Returns attributes definitions
     virtual const SyntaxAttributesVec& GetAttributes() const;
 
-    // Saves data to xml node
-    virtual void SaveTo(pugi::xml_node& node) const;
+    // Saves data to binary cache
+    virtual void SaveTo(BinaryCacheWriter& writer) const;
 
-    // Loads data from xml node
-    virtual void LoadFrom(const pugi::xml_node& node);
+    // Loads data from binary cache
+    virtual void LoadFrom(BinaryCacheReader& reader);
 
 protected:
     string mName;     // Short name of section
@@ -312,11 +376,11 @@ public:
     // Check equality operator
     bool operator==(const SyntaxClassInheritance& other) const;
 
-    // Saves data to xml node
-    void SaveTo(pugi::xml_node& node) const;
+    // Saves data to binary cache
+    void SaveTo(BinaryCacheWriter& writer) const;
 
-    // Loads data from xml node
-    void LoadFrom(const pugi::xml_node& node);
+    // Loads data from binary cache
+    void LoadFrom(BinaryCacheReader& reader);
 
 protected:
     string                  mClassName;       // Inheritance class name
@@ -383,11 +447,11 @@ public:
     // Returns attributes definitions
     const SyntaxAttributesVec& GetAttributes() const;
 
-    // Saves data to xml node
-    void SaveTo(pugi::xml_node& node) const;
+    // Saves data to binary cache
+    void SaveTo(BinaryCacheWriter& writer) const;
 
-    // Loads data from xml node
-    void LoadFrom(const pugi::xml_node& node);
+    // Loads data from binary cache
+    void LoadFrom(BinaryCacheReader& reader);
 
 protected:
     SyntaxClassInheritancsVec mBaseClasses; // Base classe
@@ -0,0 +1,198 @@
+#include "o2Editor/stdafx.h"
+#include "ActionData.h"
+
+#include "o2/Utils/FileSystem/File.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+
+namespace Editor
+{
+    ActionData::ActionData()
+    {}
+
+    ActionData::ActionData(const DataDocument& data)
+    {
+        Set(data);
+    }
+
+    ActionData::~ActionData()
+    {
+        if (!mSpillPath.IsEmpty())
+            o2FileSystem.FileDelete(mSpillPath);
+    }
+
+    bool ActionData::operator==(const ActionData& other) const
+    {
+        if (this == &other)
+            return true;
+
+        return GetPackedData() == other.GetPackedData();
+    }
+
+    void ActionData::Set(const DataDocument& data)
+    {
+        mBaseData = nullptr;
+        mBasePrefixLength = 0;
+        mBaseSuffixLength = 0;
+        mDeltaDepth = 0;
+
+        SetStoredData(data.SaveAsString(DataDocument::Format::Binary));
+    }
+
+    void ActionData::Rebase(const Ref<ActionData>& baseData)
+    {
+        if (baseData == mBaseData)
+            return;
+
+        // Base chain must not contain this data
+        for (auto data = baseData.Get(); data; data = data->mBaseData.Get())
+        {
+            if (data == this)
+                return;
+        }
+
+        String packedData = GetPackedData();
+
+        mBaseData = nullptr;
+        mBasePrefixLength = 0;
+        mBaseSuffixLength = 0;
+        mDeltaDepth = 0;
+
+        if (baseData && baseData->mDeltaDepth < maxDeltaDepth)
+        {
+            String basePackedData = baseData->GetPackedData();
+
+            int packedLength = packedData.Length();
+            int baseLength = basePackedData.Length();
+            int maxCommonLength = Math::Min(packedLength, baseLength);
+
+            int prefixLength = 0;
+            while (prefixLength < maxCommonLength && packedData[prefixLength] == basePackedData[prefixLength])
+                prefixLength++;
+
+            int suffixLength = 0;
+            while (suffixLength < maxCommonLength - prefixLength &&
+                   packedData[packedLength - suffixLength - 1] == basePackedData[baseLength - suffixLength - 1])
+            {
+                suffixLength++;
+            }
+
+            // Delta is used only when it saves most of memory, otherwise unpacking chain isn't worth it
+            if (prefixLength + suffixLength > packedLength/2)
+            {
+                mBaseData = baseData;
+                mBasePrefixLength = prefixLength;
+                mBaseSuffixLength = suffixLength;
+                mDeltaDepth = baseData->mDeltaDepth + 1;
+
+                packedData = packedData.SubStr(prefixLength, packedLength - suffixLength);
+            }
+        }
+
+        SetStoredData(packedData);
+    }
+
+    const Ref<ActionData>& ActionData::GetBaseData() const
+    {
+        return mBaseData;
+    }
+
+    void ActionData::Get(DataDocument& data) const
+    {
+        data.LoadFromData(GetPackedData(), DataDocument::Format::Binary);
+    }
+
+    size_t ActionData::GetMemorySize() const
+    {
+        if (IsSpilled())
+            return 0;
+
+        return mPackedData.capacity();
+    }
+
+    bool ActionData::IsSpilled() const
+    {
+        return !mSpillPath.IsEmpty();
+    }
+
+    void ActionData::Spill(const String& filePath)
+    {
+        if (IsSpilled() || mPackedData.IsEmpty())
+            return;
+
+        if (!o2FileSystem.IsFolderExist(o2FileSystem.GetParentPath(filePath)))
+            o2FileSystem.FolderCreate(o2FileSystem.GetParentPath(filePath));
+
+        OutFile file(filePath);
+        if (!file.IsOpened())
+            return;
+
+        file.WriteData(mPackedData.Data(), mPackedData.Length());
+
+        mSpillPath = filePath;
+        mPackedData = String();
+    }
+
+    String ActionData::GetPackedData() const
+    {
+        String storedData = GetStoredData();
+        if (!mBaseData)
+            return storedData;
+
+        String basePackedData = mBaseData->GetPackedData();
+        int baseLength = basePackedData.Length();
+        if (mBasePrefixLength + mBaseSuffixLength > baseLength)
+            return String();
+
+        return basePackedData.SubStr(0, mBasePrefixLength) + storedData +
+            basePackedData.SubStr(baseLength - mBaseSuffixLength, baseLength);
+    }
+
+    String ActionData::GetStoredData() const
+    {
+        if (mSpillPath.IsEmpty())
+            return mPackedData;
+
+        InFile file(mSpillPath);
+        if (!file.IsOpened())
+            return String();
+
+        String data;
+        data.resize(file.GetDataSize());
+        file.ReadData(data.data(), data.Length());
+
+        return data;
+    }
+
+    void ActionData::SetStoredData(const String& data)
+    {
+        if (!mSpillPath.IsEmpty())
+        {
+            o2FileSystem.FileDelete(mSpillPath);
+            mSpillPath.Clear();
+        }
+
+        mPackedData = data;
+        mPackedData.shrink_to_fit();
+    }
+
+    void ActionData::OnSerialize(DataValue& node) const
+    {
+        DataDocument data;
+        Get(data);
+        node["Data"] = static_cast<const DataValue&>(data);
+    }
+
+    void ActionData::OnDeserialized(const DataValue& node)
+    {
+        if (auto dataNode = node.FindMember("Data"))
+        {
+            DataDocument data;
+            (DataValue&)data = *dataNode;
+            Set(data);
+        }
+    }
+}
+// --- META ---
+
+DECLARE_CLASS(Editor::ActionData, Editor__ActionData);
+// --- END META ---
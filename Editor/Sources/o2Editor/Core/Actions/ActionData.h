@@ -0,0 +1,131 @@
+#pragma once
+
+#include "o2/Utils/Serialization/DataValue.h"
+#include "o2/Utils/Serialization/Serializable.h"
+
+using namespace o2;
+
+namespace Editor
+{
+    // -------------------------------------------------------------------------------------
+    // Compact storage of serialized action data. Keeps data packed in binary format,
+    // can spill it to disk when undo history is too big, and unpacks it on demand.
+    // Data can be stored as delta from base data: only bytes between common prefix and
+    // suffix with base packed data are kept. Deltas chain length is limited by maxDeltaDepth
+    // -------------------------------------------------------------------------------------
+    class ActionData: public ISerializable, public RefCounterable
+    {
+    public:
+        // Default constructor
+        ActionData();
+
+        // Constructor, packs data
+        ActionData(const DataDocument& data);
+
+        // Destructor. Removes spilled data file
+        ~ActionData();
+
+        // Check equals operator. Compares packed data
+        bool operator==(const ActionData& other) const;
+
+        // Packs and stores data wholly
+        void Set(const DataDocument& data);
+
+        // Stores data as delta from base data, when it saves most of memory. Otherwise stores data wholly
+        void Rebase(const Ref<ActionData>& baseData);
+
+        // Returns base data, this data is stored as delta from it. Returns null when data is stored wholly
+        const Ref<ActionData>& GetBaseData() const;
+
+        // Unpacks data into document. Reads it from disk when data was spilled
+        void Get(DataDocument& data) const;
+
+        // Unpacks data into value. Reads it from disk when data was spilled
+        template<typename _type>
+        void Get(_type& value) const;
+
+        // Returns size of packed data in memory, without base data. Returns 0 when data is spilled
+        size_t GetMemorySize() const;
+
+        // Returns is data spilled to disk
+        bool IsSpilled() const;
+
+        // Writes packed data into file and releases memory
+        void Spill(const String& filePath);
+
+        SERIALIZABLE(ActionData);
+
+    protected:
+        static constexpr int maxDeltaDepth = 8; // Max length of deltas chain, longer chains are slow to unpack
+
+        String mPackedData; // Data packed in binary format, or delta from base data. Empty when spilled
+        String mSpillPath;  // Path to file with spilled data. Empty when data is in memory
+
+        Ref<ActionData> mBaseData;             // Base data, this data is stored as delta from it. Null when data is stored wholly
+        int             mBasePrefixLength = 0; // Length of base packed data prefix, which is equal in this data
+        int             mBaseSuffixLength = 0; // Length of base packed data suffix, which is equal in this data
+        int             mDeltaDepth = 0;       // Count of base data in chain
+
+    protected:
+        // Returns packed data, reads it from disk when data was spilled and restores it from base data
+        String GetPackedData() const;
+
+        // Returns stored packed data or delta, reads it from disk when data was spilled
+        String GetStoredData() const;
+
+        // Stores packed data. Removes spilled data file
+        void SetStoredData(const String& data);
+
+        // Writes unpacked data
+        void OnSerialize(DataValue& node) const override;
+
+        // Packs deserialized data
+        void OnDeserialized(const DataValue& node) override;
+    };
+
+    template<typename _type>
+    void ActionData::Get(_type& value) const
+    {
+        DataDocument data;
+        Get(data);
+        data.Get(value);
+    }
+}
+// --- META ---
+
+CLASS_BASES_META(Editor::ActionData)
+{
+    BASE_CLASS(o2::ISerializable);
+    BASE_CLASS(o2::RefCounterable);
+}
+END_META;
+CLASS_FIELDS_META(Editor::ActionData)
+{
+    FIELD().PROTECTED().NAME(mPackedData);
+    FIELD().PROTECTED().NAME(mSpillPath);
+    FIELD().PROTECTED().NAME(mBaseData);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mBasePrefixLength);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mBaseSuffixLength);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mDeltaDepth);
+}
+END_META;
+CLASS_METHODS_META(Editor::ActionData)
+{
+
+    FUNCTION().PUBLIC().CONSTRUCTOR();
+    FUNCTION().PUBLIC().CONSTRUCTOR(const DataDocument&);
+    FUNCTION().PUBLIC().SIGNATURE(void, Set, const DataDocument&);
+    FUNCTION().PUBLIC().SIGNATURE(void, Rebase, const Ref<ActionData>&);
+    FUNCTION().PUBLIC().SIGNATURE(const Ref<ActionData>&, GetBaseData);
+    FUNCTION().PUBLIC().SIGNATURE(void, Get, DataDocument&);
+    FUNCTION().PUBLIC().SIGNATURE(size_t, GetMemorySize);
+    FUNCTION().PUBLIC().SIGNATURE(bool, IsSpilled);
+    FUNCTION().PUBLIC().SIGNATURE(void, Spill, const String&);
+    FUNCTION().PROTECTED().SIGNATURE(String, GetPackedData);
+    FUNCTION().PROTECTED().SIGNATURE(String, GetStoredData);
+    FUNCTION().PROTECTED().SIGNATURE(void, SetStoredData, const String&);
+    FUNCTION().PROTECTED().SIGNATURE(void, OnSerialize, DataValue&);
+    FUNCTION().PROTECTED().SIGNATURE(void, OnDeserialized, const DataValue&);
+}
+END_META;
+// --- END META ---
@@ -1,14 +1,25 @@
 #include "o2Editor/stdafx.h"
 #include "ActionsList.h"
 
+#include "o2/Utils/FileSystem/FileSystem.h"
 #include "o2Editor/Core/Actions/PropertyChange.h"
 #include "o2Editor/SceneWindow/SceneEditScreen.h"
 
 namespace Editor
 {
-    ActionsList::~ActionsList()
+    ActionsList::ActionsList():
+        mSpillPath(String(GetProjectTempPath()) + "UndoHistory/" + (String)UID())
     {}
 
+    ActionsList::~ActionsList()
+    {
+        mActions.Clear();
+        mForwardActions.Clear();
+
+        if (o2FileSystem.IsFolderExist(mSpillPath))
+            o2FileSystem.FolderRemove(mSpillPath);
+    }
+
     int ActionsList::GetUndoActionsCount() const
     {
         return mActions.Count();
@@ -41,6 +52,8 @@ namespace Editor
         {
             mActions.Last()->Undo();
             mForwardActions.Add(mActions.PopBack());
+
+            mSpilledActionsCount = Math::Min(mSpilledActionsCount, mActions.Count());
         }
     }
 
@@ -55,9 +68,15 @@ namespace Editor
 
     void ActionsList::DoneAction(const Ref<IAction>& action)
     {
+        if (!mActions.IsEmpty())
+            action->ReuseData(mActions.Last());
+
+        ClearForwardActions();
+
         mActions.Add(action);
+        AddActionMemoryUsage(action);
 
-        mForwardActions.Clear();
+        CheckHistoryMemoryLimit();
     }
 
     void ActionsList::DoneActorPropertyChangeAction(const String& path, const Vector<DataDocument>& prevValue,
@@ -72,6 +91,10 @@ namespace Editor
     {
         mActions.Clear();
         mForwardActions.Clear();
+
+        mDataUsesCount.Clear();
+        mHistoryMemoryUsage = 0;
+        mSpilledActionsCount = 0;
     }
 
     const Vector<Ref<IAction>> ActionsList::GetUndoActions() const
@@ -84,4 +107,96 @@ namespace Editor
         return mForwardActions;
     }
 
+    void ActionsList::SetHistoryMemoryLimit(size_t limit)
+    {
+        mHistoryMemoryLimit = limit;
+        CheckHistoryMemoryLimit();
+    }
+
+    size_t ActionsList::GetHistoryMemoryLimit() const
+    {
+        return mHistoryMemoryLimit;
+    }
+
+    size_t ActionsList::GetHistoryMemoryUsage() const
+    {
+        return mHistoryMemoryUsage;
+    }
+
+    void ActionsList::CheckHistoryMemoryLimit()
+    {
+        if (mHistoryMemoryUsage <= mHistoryMemoryLimit)
+            return;
+
+        // Keep the last action in memory, it's most likely to be undone
+        while (mHistoryMemoryUsage > mHistoryMemoryLimit && mSpilledActionsCount < mActions.Count() - 1)
+        {
+            Vector<Ref<ActionData>> actionData;
+            mActions[mSpilledActionsCount]->GetData(actionData);
+
+            // Spilling data with its bases. Shared data is spilled once, so it's subtracted once
+            for (auto& data : actionData)
+            {
+                for (auto spillingData = data.Get(); spillingData; spillingData = spillingData->GetBaseData().Get())
+                {
+                    if (spillingData->IsSpilled())
+                        continue;
+
+                    size_t dataSize = spillingData->GetMemorySize();
+                    spillingData->Spill(mSpillPath + "/" + (String)UID() + ".bin");
+
+                    if (spillingData->IsSpilled())
+                        mHistoryMemoryUsage -= Math::Min(mHistoryMemoryUsage, dataSize);
+                }
+            }
+
+            mSpilledActionsCount++;
+        }
+    }
+
+    void ActionsList::AddActionMemoryUsage(const Ref<IAction>& action)
+    {
+        Vector<Ref<ActionData>> actionData;
+        action->GetData(actionData);
+
+        for (auto& data : actionData)
+        {
+            for (auto usingData = data.Get(); usingData; usingData = usingData->GetBaseData().Get())
+            {
+                if (mDataUsesCount[usingData]++ == 0)
+                    mHistoryMemoryUsage += usingData->GetMemorySize();
+            }
+        }
+    }
+
+    void ActionsList::RemoveActionMemoryUsage(const Ref<IAction>& action)
+    {
+        Vector<Ref<ActionData>> actionData;
+        action->GetData(actionData);
+
+        for (auto& data : actionData)
+        {
+            for (auto usingData = data.Get(); usingData; usingData = usingData->GetBaseData().Get())
+            {
+                auto fnd = mDataUsesCount.find(usingData);
+                if (fnd == mDataUsesCount.end())
+                    continue;
+
+                // Spilled data has zero memory size, it was subtracted when spilled
+                if (--fnd->second == 0)
+                {
+                    mHistoryMemoryUsage -= Math::Min(mHistoryMemoryUsage, usingData->GetMemorySize());
+                    mDataUsesCount.erase(fnd);
+                }
+            }
+        }
+    }
+
+    void ActionsList::ClearForwardActions()
+    {
+        for (auto& action : mForwardActions)
+            RemoveActionMemoryUsage(action);
+
+        mForwardActions.Clear();
+    }
 }
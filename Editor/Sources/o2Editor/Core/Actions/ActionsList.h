@@ -4,13 +4,17 @@
 
 namespace Editor
 {
-    // ---------------------------------------------------
-    // Done editor actions list. Can undo and redo actions
-    // ---------------------------------------------------
+    // -------------------------------------------------------------------------------
+    // Done editor actions list. Can undo and redo actions.
+    // When actions data exceeds memory limit, data of oldest actions spills to disk
+    // -------------------------------------------------------------------------------
     class ActionsList: public RefCounterable
     {
     public:
-        // Destructor. Destroys stored actions
+        // Default constructor
+        ActionsList();
+
+        // Destructor. Destroys stored actions and removes spilled data
         ~ActionsList();
 
         // Returns count of undo actions
@@ -47,8 +51,39 @@ namespace Editor
         // Returns redo actions
         const Vector<Ref<IAction>> GetRedoActions() const;
 
+        // Sets memory limit for actions data in bytes. Data of oldest actions spills to disk when limit exceeded
+        void SetHistoryMemoryLimit(size_t limit);
+
+        // Returns memory limit for actions data in bytes
+        size_t GetHistoryMemoryLimit() const;
+
+        // Returns size of actions data stored in memory
+        size_t GetHistoryMemoryUsage() const;
+
     protected:
         Vector<Ref<IAction>> mActions;        // Done actions
         Vector<Ref<IAction>> mForwardActions; // Forward actions, what you can redo
+
+        size_t mHistoryMemoryLimit = 256*1024*1024; // Memory limit for actions data
+        size_t mHistoryMemoryUsage = 0;             // Size of unique actions data in memory, updated when actions list changes
+
+        Map<const ActionData*, int> mDataUsesCount; // Count of stored actions uses of data, including uses as base data
+
+        int mSpilledActionsCount = 0; // Count of first done actions, which data were spilled to disk
+
+        String mSpillPath; // Path to folder with spilled actions data
+
+    protected:
+        // Spills data of oldest actions until memory usage is under limit
+        void CheckHistoryMemoryLimit();
+
+        // Adds stored action data into memory usage. Shared data and deltas bases are counted once
+        void AddActionMemoryUsage(const Ref<IAction>& action);
+
+        // Subtracts action data from memory usage when it isn't used by other stored actions
+        void RemoveActionMemoryUsage(const Ref<IAction>& action);
+
+        // Removes forward actions and their memory usage
+        void ClearForwardActions();
     };
 }
@@ -16,7 +16,9 @@ namespace Editor
     {
         objectsIds = objects.Convert<SceneUID>([](auto& x) { return x->GetID(); });
 
-        objectsData.Set(objects);
+        DataDocument data;
+        data.Set(objects);
+        objectsData = mmake<ActionData>(data);
 
         insertParentId = parent ? parent->GetID() : 0;
         insertPrevObjectId = prevObject ? prevObject->GetID() : 0;
@@ -37,7 +39,7 @@ namespace Editor
         {
             int insertIdx = parent->GetEditableChildren().IndexOf(prevObject) + 1;
 
-            objectsData.Get(objects);
+            objectsData->Get(objects);
 
             for (auto& object : objects)
                 parent->AddEditableChild(object, insertIdx++);
@@ -46,7 +48,7 @@ namespace Editor
         {
             int insertIdx = o2Scene.GetRootEditableObjects().IndexOf(prevObject) + 1;
 
-            objectsData.Get(objects);
+            objectsData->Get(objects);
 
             for (auto& object : objects)
                 object->SetIndexInSiblings(insertIdx++);
@@ -68,6 +70,11 @@ namespace Editor
         o2EditorSceneScreen.ClearSelectionWithoutAction();
     }
 
+    void CreateAction::GetData(Vector<Ref<ActionData>>& data) const
+    {
+        if (objectsData)
+            data.Add(objectsData);
+    }
 }
 // --- META ---
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "o2/Utils/Types/Containers/Vector.h"
+#include "o2Editor/Core/Actions/ActionData.h"
 #include "o2Editor/Core/Actions/IAction.h"
 
 using namespace o2;
@@ -18,7 +19,7 @@ namespace Editor
     class CreateAction: public IAction
     {
     public:
-        DataDocument     objectsData;        // Serialized created objects
+        Ref<ActionData>  objectsData;        // Serialized created objects
         Vector<SceneUID> objectsIds;         // Created objects ids
         SceneUID         insertParentId;     // Parent id
         SceneUID         insertPrevObjectId; // Previous object id
@@ -39,6 +40,9 @@ namespace Editor
         // Removes created objects
         void Undo() override;
 
+        // Collects packed objects data
+        void GetData(Vector<Ref<ActionData>>& data) const override;
+
         SERIALIZABLE(CreateAction);
     };
 
@@ -66,6 +70,7 @@ CLASS_METHODS_META(Editor::CreateAction)
     FUNCTION().PUBLIC().SIGNATURE(String, GetName);
     FUNCTION().PUBLIC().SIGNATURE(void, Redo);
     FUNCTION().PUBLIC().SIGNATURE(void, Undo);
+    FUNCTION().PUBLIC().SIGNATURE(void, GetData, Vector<Ref<ActionData>>&);
 }
 END_META;
 // --- END META ---
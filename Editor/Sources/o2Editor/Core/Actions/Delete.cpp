@@ -18,7 +18,10 @@ namespace Editor
         for (auto& object : objects)
         {
             ObjectInfo info;
-            info.objectData.Set(object);
+            DataDocument objectData;
+            objectData.Set(object);
+            info.objectData = mmake<ActionData>(objectData);
+            info.objectId = object->GetID();
             info.idx = o2Scene.GetObjectHierarchyIdx(object);
 
             if (auto parent = object->GetEditableParent())
@@ -67,7 +70,7 @@ namespace Editor
     {
         for (auto& info : objectsInfos)
         {
-            auto object = o2Scene.GetEditableObjectByID((SceneUID)info.objectData["Value"]["Id"]);
+            auto object = o2Scene.GetEditableObjectByID(info.objectId);
 //             if (object)
 //                 delete object;
         }
@@ -89,7 +92,7 @@ namespace Editor
                 int idx = parent->GetEditableChildren().IndexOf([=](auto& x) { return x->GetID() == prevId; }) + 1;
 
                 Ref<SceneEditableObject> newObject;
-                info.objectData.Get(newObject);
+                info.objectData->Get(newObject);
                 parent->AddEditableChild(newObject, idx);
 
                 o2EditorSceneScreen.SelectObjectWithoutAction(newObject);
@@ -100,7 +103,7 @@ namespace Editor
                 int idx = o2Scene.GetRootActors().IndexOf([&](auto& x) { return x->GetID() == info.prevObjectId; }) + 1;
 
                 Ref<SceneEditableObject> newObject;
-                info.objectData.Get(newObject);
+                info.objectData->Get(newObject);
                 newObject->SetIndexInSiblings(idx);
 
                 o2EditorSceneScreen.SelectObjectWithoutAction(newObject);
@@ -112,9 +115,15 @@ namespace Editor
         o2EditorTree.UpdateTreeView();
     }
 
+    void DeleteAction::GetData(Vector<Ref<ActionData>>& data) const
+    {
+        for (auto& info : objectsInfos)
+            data.Add(info.objectData);
+    }
+
     bool DeleteAction::ObjectInfo::operator==(const ObjectInfo& other) const
     {
-        return objectData == other.objectData && parentId == other.parentId && prevObjectId == other.prevObjectId;
+        return *objectData == *other.objectData && parentId == other.parentId && prevObjectId == other.prevObjectId;
     }
 }
 // --- META ---
@@ -2,6 +2,7 @@
 
 #include "o2/Utils/Serialization/DataValue.h"
 #include "o2/Utils/Types/Containers/Vector.h"
+#include "o2Editor/Core/Actions/ActionData.h"
 #include "o2Editor/Core/Actions/IAction.h"
 
 using namespace o2;
@@ -22,10 +23,11 @@ namespace Editor
         class ObjectInfo: public ISerializable
         {
         public:
-            DataDocument objectData;   // Serialized object @SERIALIZABLE
-            SceneUID     parentId;       // Previous object parent @SERIALIZABLE
-            SceneUID     prevObjectId; // Previous object sibling @SERIALIZABLE
-            int          idx;          // Index in children @SERIALIZABLE
+            Ref<ActionData> objectData;   // Packed serialized object @SERIALIZABLE
+            SceneUID        objectId;     // Deleted object id @SERIALIZABLE
+            SceneUID        parentId;     // Previous object parent @SERIALIZABLE
+            SceneUID        prevObjectId; // Previous object sibling @SERIALIZABLE
+            int             idx;          // Index in children @SERIALIZABLE
 
             bool operator==(const ObjectInfo& other) const;
 
@@ -51,6 +53,9 @@ namespace Editor
         // Reverting deleted objects
         void Undo() override;
 
+        // Collects packed objects data
+        void GetData(Vector<Ref<ActionData>>& data) const override;
+
         SERIALIZABLE(DeleteAction);
     };
 }
@@ -74,6 +79,7 @@ CLASS_METHODS_META(Editor::DeleteAction)
     FUNCTION().PUBLIC().SIGNATURE(String, GetName);
     FUNCTION().PUBLIC().SIGNATURE(void, Redo);
     FUNCTION().PUBLIC().SIGNATURE(void, Undo);
+    FUNCTION().PUBLIC().SIGNATURE(void, GetData, Vector<Ref<ActionData>>&);
 }
 END_META;
 
@@ -85,6 +91,7 @@ END_META;
 CLASS_FIELDS_META(Editor::DeleteAction::ObjectInfo)
 {
     FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(objectData);
+    FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(objectId);
     FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(parentId);
     FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(prevObjectId);
     FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(idx);
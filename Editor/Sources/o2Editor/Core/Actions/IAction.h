@@ -1,6 +1,7 @@
 #pragma once
 
 #include "o2/Utils/Serialization/Serializable.h"
+#include "o2Editor/Core/Actions/ActionData.h"
 
 using namespace o2;
 
@@ -24,6 +25,12 @@ namespace Editor
         // Undoing action
         virtual void Undo() {}
 
+        // Collects packed action data. Data can be shared between actions, so memory is counted by unique data
+        virtual void GetData(Vector<Ref<ActionData>>& data) const {}
+
+        // Reuses data from previous action: shares equal data and stores changed data as delta
+        virtual void ReuseData(const Ref<IAction>& previousAction) {}
+
         SERIALIZABLE(IAction);
     };
 }
@@ -45,6 +52,8 @@ CLASS_METHODS_META(Editor::IAction)
     FUNCTION().PUBLIC().SIGNATURE(String, GetName);
     FUNCTION().PUBLIC().SIGNATURE(void, Redo);
     FUNCTION().PUBLIC().SIGNATURE(void, Undo);
+    FUNCTION().PUBLIC().SIGNATURE(void, GetData, Vector<Ref<ActionData>>&);
+    FUNCTION().PUBLIC().SIGNATURE(void, ReuseData, const Ref<IAction>&);
 }
 END_META;
 // --- END META ---
@@ -16,8 +16,10 @@ namespace Editor
                                                const Vector<DataDocument>& beforeValues,
                                                const Vector<DataDocument>& afterValues) :
         objectsIds(objects.Convert<SceneUID>([](const auto& x) { return x->GetID(); })),
-        propertyPath(propertyPath), beforeValues(beforeValues), afterValues(afterValues)
-    {}
+        propertyPath(propertyPath), beforeValues(PackValues(beforeValues)), afterValues(PackValues(afterValues))
+    {
+        RebaseAfterValues();
+    }
 
     String PropertyChangeAction::GetName() const
     {
@@ -34,7 +36,57 @@ namespace Editor
         SetProperties(beforeValues);
     }
 
-    void PropertyChangeAction::SetProperties(Vector<DataDocument>& values)
+    void PropertyChangeAction::GetData(Vector<Ref<ActionData>>& data) const
+    {
+        data.Add(beforeValues);
+        data.Add(afterValues);
+    }
+
+    void PropertyChangeAction::ReuseData(const Ref<IAction>& previousAction)
+    {
+        auto previous = DynamicCast<PropertyChangeAction>(previousAction);
+        if (!previous || previous->propertyPath != propertyPath || previous->objectsIds != objectsIds)
+            return;
+
+        // Values before change are usually equal to values after previous change, otherwise they differ slightly
+        for (int i = 0; i < beforeValues.Count() && i < previous->afterValues.Count(); i++)
+        {
+            if (*beforeValues[i] == *previous->afterValues[i])
+                beforeValues[i] = previous->afterValues[i];
+            else
+                beforeValues[i]->Rebase(previous->afterValues[i]);
+        }
+
+        RebaseAfterValues();
+    }
+
+    void PropertyChangeAction::RebaseAfterValues()
+    {
+        for (int i = 0; i < afterValues.Count() && i < beforeValues.Count(); i++)
+        {
+            if (afterValues[i] != beforeValues[i])
+                afterValues[i]->Rebase(beforeValues[i]);
+        }
+    }
+
+    Vector<Ref<ActionData>> PropertyChangeAction::PackValues(const Vector<DataDocument>& values)
+    {
+        Vector<Ref<ActionData>> result;
+        result.Reserve(values.Count());
+
+        for (auto& value : values)
+        {
+            auto packed = mmake<ActionData>(value);
+            if (!result.IsEmpty() && *result.Last() == *packed)
+                packed = result.Last();
+
+            result.Add(packed);
+        }
+
+        return result;
+    }
+
+    void PropertyChangeAction::SetProperties(const Vector<Ref<ActionData>>& values)
     {
         Vector<Ref<SceneEditableObject>> objects = objectsIds.Convert<Ref<SceneEditableObject>>([](SceneUID id) { 
             return o2Scene.GetEditableObjectByID(id); });
@@ -82,7 +134,11 @@ namespace Editor
             }
 
             if (fi && ptr)
-                fi->Deserialize(ptr, values[i]);
+            {
+                DataDocument value;
+                values[i]->Get(value);
+                fi->Deserialize(ptr, value);
+            }
 
             object->OnChanged();
 
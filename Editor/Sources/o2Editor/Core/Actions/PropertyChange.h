@@ -1,5 +1,6 @@
 #pragma once
 
+#include "o2Editor/Core/Actions/ActionData.h"
 #include "o2Editor/Core/Actions/IAction.h"
 
 using namespace o2;
@@ -11,17 +12,20 @@ namespace o2
 
 namespace Editor
 {
-    // -----------------------------------------------------
+    // ------------------------------------------------------
     // Scene object property change action.
-    // Storing path to value, values before and after change
-    // -----------------------------------------------------
+    // Storing path to value, values before and after change.
+    // Values are packed, equal values are shared between
+    // objects and with previous action. Values after change
+    // are stored as delta from values before change
+    // ------------------------------------------------------
     class PropertyChangeAction: public IAction
     {
     public:
-        Vector<SceneUID>     objectsIds;   // Changed objects
-        String               propertyPath; // Path to property
-        Vector<DataDocument> beforeValues; // Serialized values before change
-        Vector<DataDocument> afterValues;  // Serialized values after change
+        Vector<SceneUID>        objectsIds;   // Changed objects
+        String                  propertyPath; // Path to property
+        Vector<Ref<ActionData>> beforeValues; // Serialized values before change
+        Vector<Ref<ActionData>> afterValues;  // Serialized values after change
 
     public:
         // Default constructor
@@ -42,11 +46,24 @@ namespace Editor
         // Sets object's properties value as before change
         void Undo() override;
 
+        // Collects packed values
+        void GetData(Vector<Ref<ActionData>>& data) const override;
+
+        // Shares before values with after values of previous action, when it changed the same property.
+        // Different values are stored as delta from previous action values
+        void ReuseData(const Ref<IAction>& previousAction) override;
+
         SERIALIZABLE(PropertyChangeAction);
 
     protected:
+        // Packs values, equal neighbour values are shared
+        static Vector<Ref<ActionData>> PackValues(const Vector<DataDocument>& values);
+
+        // Stores values after change as delta from values before change
+        void RebaseAfterValues();
+
         // Sets object's properties values
-        void SetProperties(Vector<DataDocument>& value);
+        void SetProperties(const Vector<Ref<ActionData>>& values);
     };
 }
 // --- META ---
@@ -72,7 +89,11 @@ CLASS_METHODS_META(Editor::PropertyChangeAction)
     FUNCTION().PUBLIC().SIGNATURE(String, GetName);
     FUNCTION().PUBLIC().SIGNATURE(void, Redo);
     FUNCTION().PUBLIC().SIGNATURE(void, Undo);
-    FUNCTION().PROTECTED().SIGNATURE(void, SetProperties, Vector<DataDocument>&);
+    FUNCTION().PUBLIC().SIGNATURE(void, GetData, Vector<Ref<ActionData>>&);
+    FUNCTION().PUBLIC().SIGNATURE(void, ReuseData, const Ref<IAction>&);
+    FUNCTION().PROTECTED().SIGNATURE_STATIC(Vector<Ref<ActionData>>, PackValues, const Vector<DataDocument>&);
+    FUNCTION().PROTECTED().SIGNATURE(void, RebaseAfterValues);
+    FUNCTION().PROTECTED().SIGNATURE(void, SetProperties, const Vector<Ref<ActionData>>&);
 }
 END_META;
 // --- END META ---
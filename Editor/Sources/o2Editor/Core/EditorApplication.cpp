@@ -151,6 +151,8 @@ namespace Editor
         mConfig = mmake<EditorConfig>();
         mConfig->LoadConfigs();
 
+        SetHistoryMemoryLimit((size_t)mConfig->globalConfig.mUndoHistoryMemoryLimit*1024*1024);
+
         LoadUIStyle();
 
         mProperties = mmake<Properties>();
@@ -459,6 +461,15 @@ namespace Editor
             Application::PostUpdatePhysics();
     }
 
+    void EditorApplication::BeginThreadedPhysicsStep(float dt, int stepsCount, float alpha)
+    {
+        PROFILE_SAMPLE_FUNC();
+
+        ForcePopEditorScopeOnStack scope;
+
+        Application::BeginThreadedPhysicsStep(dt, mUpdateStep ? stepsCount : 0, alpha);
+    }
+
     void EditorApplication::UpdateScene(float dt)
     {
         PROFILE_SAMPLE_FUNC();
@@ -112,6 +112,9 @@ namespace Editor
         // After update physics
         void PostUpdatePhysics() override;
 
+        // Interpolates actors between last physics states and starts stepping physics on worker thread
+        void BeginThreadedPhysicsStep(float dt, int stepsCount, float alpha) override;
+
         // Updates scene
         void UpdateScene(float dt) override;
 
@@ -214,6 +217,7 @@ CLASS_METHODS_META(Editor::EditorApplication)
     FUNCTION().PROTECTED().SIGNATURE(void, PreUpdatePhysics);
     FUNCTION().PROTECTED().SIGNATURE(void, UpdatePhysics, float);
     FUNCTION().PROTECTED().SIGNATURE(void, PostUpdatePhysics);
+    FUNCTION().PROTECTED().SIGNATURE(void, BeginThreadedPhysicsStep, float, int, float);
     FUNCTION().PROTECTED().SIGNATURE(void, UpdateScene, float);
     FUNCTION().PROTECTED().SIGNATURE(void, FixedUpdateScene, float);
     FUNCTION().PROTECTED().SIGNATURE(void, DrawScene);
@@ -36,6 +36,8 @@ namespace Editor
 
             Map<String, WindowsLayout> mAvailableLayouts; // Available windows layouts @SERIALIZABLE
 
+            int mUndoHistoryMemoryLimit = 256; // Undo history memory limit in megabytes. Older actions data spills to disk @SERIALIZABLE
+
             SERIALIZABLE(GlobalConfig);
         };
 
@@ -136,6 +138,7 @@ CLASS_FIELDS_META(Editor::EditorConfig::GlobalConfig)
 {
     FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(mDefaultLayout);
     FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(mAvailableLayouts);
+    FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(256).NAME(mUndoHistoryMemoryLimit);
 }
 END_META;
 CLASS_METHODS_META(Editor::EditorConfig::GlobalConfig)
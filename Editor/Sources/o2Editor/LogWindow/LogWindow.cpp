@@ -6,6 +6,7 @@
 #include "o2/Scene/UI/WidgetLayer.h"
 #include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Scene/UI/Widgets/Button.h"
+#include "o2/Scene/UI/Widgets/EditBox.h"
 #include "o2/Scene/UI/Widgets/Label.h"
 #include "o2/Scene/UI/Widgets/List.h"
 #include "o2/Scene/UI/Widgets/LongList.h"
@@ -24,6 +25,13 @@ namespace Editor
 
         if (o2Input.IsKeyDown('K'))
             o2Debug.LogError("Error message " + (String)o2Time.GetLocalTime());
+
+        // Text search filters big logs by parts in background
+        if (mFilteredChunksCount < mMessagesChunks.Count())
+        {
+            FilterNextChunks();
+            mList->OnItemsUpdated();
+        }
     }
 
     Ref<RefCounterable> LogWindow::CastToRefCounterable(const Ref<LogWindow>& ref)
@@ -35,6 +43,7 @@ namespace Editor
         IEditorWindow(refCounter), mRegularMessagesEnabled(true), mWarningMessagesEnabled(true), mErrorMessagesEnabled(true), mRegularMessagesCount(0),
         mWarningMessagesCount(0), mErrorMessagesCount(0)
     {
+        UpdateChunksVisibleOffsets(0);
         InitializeWindow();
         //BindStream(o2Debug.GetLog());
     }
@@ -113,16 +122,21 @@ namespace Editor
         errorsToggle->onToggle = [&](bool value) { OnErrorMessagesToggled(value); };
         downPanel->AddChild(errorsToggle);
 
+        mSearchEditBox = o2UI.CreateWidget<EditBox>("backless");
+        *mSearchEditBox->layout = WidgetLayout::Based(BaseCorner::Right, Vec2F(150, 20), Vec2F(0, 0));
+        mSearchEditBox->onChanged += THIS_FUNC(OnSearchEdited);
+        downPanel->AddChild(mSearchEditBox);
+
         mLastMessageView = listItemSample->CloneAsRef<Widget>();
-        *mLastMessageView->layout = WidgetLayout::BothStretch(200, 1, 0, 1);
+        *mLastMessageView->layout = WidgetLayout::BothStretch(200, 1, 150, 1);
         downPanel->AddChild(mLastMessageView);
         mLastMessageView->Hide(true);
     }
 
     void LogWindow::OnClearPressed()
     {
-        mAllMessages.Clear();
-        mVisibleMessages.Clear();
+        mMessagesChunks.Clear();
+        UpdateChunksVisibleOffsets(0);
         mList->OnItemsUpdated();
 
         mRegularMessagesCount = 0;
@@ -154,41 +168,176 @@ namespace Editor
         UpdateVisibleMessages();
     }
 
+    void LogWindow::OnSearchEdited(const WString& search)
+    {
+        mSearchText = search;
+        UpdateVisibleMessages();
+    }
+
     void LogWindow::UpdateVisibleMessages()
     {
-        mVisibleMessages.Clear();
+        mFilterVersion++;
+
+        // Without text search counts are known by types indices, otherwise chunks are filtered by parts in updates
+        UpdateChunksVisibleOffsets(0);
+        FilterNextChunks();
+
+        mList->OnItemsUpdated(true);
+    }
+
+    bool LogWindow::IsMessageVisible(const LogMessage& message) const
+    {
+        bool typeEnabled = (message.type == LogMessage::Type::Regular && mRegularMessagesEnabled) ||
+            (message.type == LogMessage::Type::Warning && mWarningMessagesEnabled) ||
+            (message.type == LogMessage::Type::Error && mErrorMessagesEnabled);
+
+        return typeEnabled && (mSearchText.IsEmpty() || message.message.Contains(mSearchText));
+    }
+
+    int LogWindow::GetChunkVisibleMessagesCount(const MessagesChunk& chunk) const
+    {
+        if (chunk.filterVersion == mFilterVersion)
+            return chunk.visibleMessages.Count();
+
+        if (!mSearchText.IsEmpty())
+            return -1;
+
+        int res = 0;
+
+        if (mRegularMessagesEnabled)
+            res += chunk.typeMessages[(int)LogMessage::Type::Regular].Count();
+
+        if (mWarningMessagesEnabled)
+            res += chunk.typeMessages[(int)LogMessage::Type::Warning].Count();
+
+        if (mErrorMessagesEnabled)
+            res += chunk.typeMessages[(int)LogMessage::Type::Error].Count();
+
+        return res;
+    }
+
+    void LogWindow::FilterChunk(MessagesChunk& chunk)
+    {
+        chunk.visibleMessages.Clear();
 
-        for (auto& msg : mAllMessages)
+        // Without search text visibility depends only on type: merging sorted indices lists of enabled types
+        if (mSearchText.IsEmpty())
         {
-            msg.idx = mVisibleMessages.Count();
+            const Vector<int>* typesMessages[3];
+            int typesCount = 0, visibleCount = 0;
+
+            if (mRegularMessagesEnabled)
+                typesMessages[typesCount++] = &chunk.typeMessages[(int)LogMessage::Type::Regular];
+
+            if (mWarningMessagesEnabled)
+                typesMessages[typesCount++] = &chunk.typeMessages[(int)LogMessage::Type::Warning];
+
+            if (mErrorMessagesEnabled)
+                typesMessages[typesCount++] = &chunk.typeMessages[(int)LogMessage::Type::Error];
+
+            for (int i = 0; i < typesCount; i++)
+                visibleCount += typesMessages[i]->Count();
 
-            if (msg.type == LogMessage::Type::Regular && mRegularMessagesEnabled)
-                mVisibleMessages.Add(msg);
+            chunk.visibleMessages.Reserve(visibleCount);
 
-            if (msg.type == LogMessage::Type::Warning && mWarningMessagesEnabled)
-                mVisibleMessages.Add(msg);
+            int positions[3] = { 0, 0, 0 };
+            for (int i = 0; i < visibleCount; i++)
+            {
+                int minType = -1;
+                for (int j = 0; j < typesCount; j++)
+                {
+                    if (positions[j] < typesMessages[j]->Count() &&
+                        (minType < 0 || (*typesMessages[j])[positions[j]] < (*typesMessages[minType])[positions[minType]]))
+                    {
+                        minType = j;
+                    }
+                }
 
-            if (msg.type == LogMessage::Type::Error && mErrorMessagesEnabled)
-                mVisibleMessages.Add(msg);
+                chunk.visibleMessages.Add((*typesMessages[minType])[positions[minType]++]);
+            }
+
+            chunk.filterVersion = mFilterVersion;
+            return;
         }
 
-        mList->OnItemsUpdated(true);
+        for (int i = 0; i < chunk.count; i++)
+        {
+            if (IsMessageVisible(chunk.messages[i]))
+                chunk.visibleMessages.Add(i);
+        }
+
+        chunk.filterVersion = mFilterVersion;
+    }
+
+    void LogWindow::FilterNextChunks()
+    {
+        if (mFilteredChunksCount == mMessagesChunks.Count())
+            return;
+
+        int lastChunk = Math::Min(mFilteredChunksCount + filterChunksPerUpdate, mMessagesChunks.Count());
+        for (int i = mFilteredChunksCount; i < lastChunk; i++)
+            FilterChunk(*mMessagesChunks[i]);
+
+        UpdateChunksVisibleOffsets(mFilteredChunksCount);
+    }
+
+    void LogWindow::UpdateChunksVisibleOffsets(int fromChunk)
+    {
+        if (fromChunk > mFilteredChunksCount)
+            return;
+
+        mChunksVisibleOffsets.Resize(mMessagesChunks.Count() + 1);
+        mChunksVisibleOffsets[0] = 0;
+
+        for (int i = fromChunk; i < mMessagesChunks.Count(); i++)
+        {
+            int visibleCount = GetChunkVisibleMessagesCount(*mMessagesChunks[i]);
+            if (visibleCount < 0)
+            {
+                mFilteredChunksCount = i;
+                return;
+            }
+
+            mChunksVisibleOffsets[i + 1] = mChunksVisibleOffsets[i] + visibleCount;
+        }
+
+        mFilteredChunksCount = mMessagesChunks.Count();
     }
 
     int LogWindow::GetVisibleMessagesCount()
     {
-        return mVisibleMessages.Count();
+        return mChunksVisibleOffsets[mFilteredChunksCount];
     }
 
     Vector<void*> LogWindow::GetVisibleMessagesRange(int min, int max)
     {
         Vector<void*> res;
-        for (int i = min; i < max; i++)
-        {
-            if (i == mVisibleMessages.Count())
-                break;
 
-            res.Add((void*)(void*)&mVisibleMessages[i]);
+        max = Math::Min(max, GetVisibleMessagesCount());
+        if (min >= max)
+            return res;
+
+        // Searching chunk containing first message, offsets are sorted
+        int chunkIdx = (int)(std::upper_bound(mChunksVisibleOffsets.begin(), mChunksVisibleOffsets.begin() + mFilteredChunksCount + 1, min) -
+                             mChunksVisibleOffsets.begin()) - 1;
+
+        res.Reserve(max - min);
+
+        for (int i = min; i < max; chunkIdx++)
+        {
+            auto& chunk = *mMessagesChunks[chunkIdx];
+            if (chunk.filterVersion != mFilterVersion)
+                FilterChunk(chunk);
+
+            int chunkOffset = mChunksVisibleOffsets[chunkIdx];
+            int chunkEnd = Math::Min(max, chunkOffset + chunk.visibleMessages.Count());
+
+            for (; i < chunkEnd; i++)
+            {
+                auto& message = chunk.messages[chunk.visibleMessages[i - chunkOffset]];
+                message.idx = i;
+                res.Add((void*)&message);
+            }
         }
 
         return res;
@@ -208,91 +357,121 @@ namespace Editor
 
     void LogWindow::OutStrEx(const WString& str)
     {
-        bool isScrollDown = Math::Equals(mList->GetScroll().y, mList->GetScrollRange().bottom, 5.0f);
-
-        LogMessage msg;
-        msg.message = str;
-        msg.type = LogMessage::Type::Regular;
-        msg.idx = mAllMessages.Count();
-
-        mAllMessages.Add(msg);
-        if (mRegularMessagesEnabled)
-        {
-            msg.idx = mVisibleMessages.Count();
-            mVisibleMessages.Add(msg);
-        }
-
-        mList->OnItemsUpdated();
-
-        if (isScrollDown)
-            mList->SetScrollForcible(Vec2F(0, mList->GetScrollRange().top));
+        AddMessage(LogMessage::Type::Regular, str);
 
         mRegularMessagesCount++;
         mMessagesCountLabel->text = (String)mRegularMessagesCount;
-
-        UpdateLastMessageView();
     }
 
     void LogWindow::OutErrorEx(const WString& str)
     {
-        bool isScrollDown = Math::Equals(mList->GetScroll().y, mList->GetScrollRange().bottom, 5.0f);
+        AddMessage(LogMessage::Type::Error, str);
 
-        LogMessage msg;
-        msg.message = str;
-        msg.type = LogMessage::Type::Error;
-        msg.idx = mAllMessages.Count();
+        mErrorMessagesCount++;
+        mErrorsCountLabel->text = (String)mErrorMessagesCount;
+    }
 
-        mAllMessages.Add(msg);
-        if (mErrorMessagesEnabled)
+    void LogWindow::OutWarningEx(const WString& str)
+    {
+        AddMessage(LogMessage::Type::Warning, str);
+
+        mWarningMessagesCount++;
+        mWarningsCountLabel->text = (String)mWarningMessagesCount;
+    }
+
+    void LogWindow::AddMessage(LogMessage::Type type, const WString& str)
+    {
+        Vec2F scroll = mList->GetScroll();
+        bool isScrollDown = Math::Equals(scroll.y, mList->GetScrollRange().bottom, 5.0f);
+
+        int removedRowsCount = 0;
+        if (mMessagesChunks.IsEmpty() || mMessagesChunks.Last()->count == messagesChunkSize)
         {
-            msg.idx = mVisibleMessages.Count();
-            mVisibleMessages.Add(msg);
+            auto newChunk = mmake<MessagesChunk>();
+            newChunk->filterVersion = mFilterVersion;
+            mMessagesChunks.Add(newChunk);
+
+            removedRowsCount = RemoveOldMessages();
         }
 
-        mList->OnItemsUpdated();
+        auto& chunk = *mMessagesChunks.Last();
+
+        LogMessage& msg = chunk.messages[chunk.count];
+        msg.message = str;
+        msg.type = type;
+        msg.idx = 0;
+
+        chunk.typeMessages[(int)type].Add(chunk.count);
+
+        // Chunk filtered by current filter is kept actual, otherwise it's filtered on demand
+        if (chunk.filterVersion == mFilterVersion && IsMessageVisible(msg))
+            chunk.visibleMessages.Add(chunk.count);
+
+        chunk.count++;
+
+        UpdateChunksVisibleOffsets(mMessagesChunks.Count() - 1);
+
+        // List items can show removed messages and rows indices are shifted, so items are rebuilt
+        mList->OnItemsUpdated(removedRowsCount > 0);
 
         if (isScrollDown)
             mList->SetScrollForcible(Vec2F(0, mList->GetScrollRange().top));
+        else if (removedRowsCount > 0)
+        {
+            // Moving view back by removed rows, so it shows same messages
+            mList->UpdateTransform();
 
-        mErrorMessagesCount++;
-        mErrorsCountLabel->text = (String)mErrorMessagesCount;
+            float rowHeight = mList->GetItemSample()->layout->GetMinHeight();
+            mList->SetScrollForcible(scroll - Vec2F(0, (float)removedRowsCount*rowHeight));
+        }
 
         UpdateLastMessageView();
     }
 
-    void LogWindow::OutWarningEx(const WString& str)
+    int LogWindow::RemoveOldMessages()
     {
-        bool isScrollDown = Math::Equals(mList->GetScroll().y, mList->GetScrollRange().bottom, 5.0f);
+        int removeChunksCount = mMessagesChunks.Count() - Math::Max(mMaxMessagesCount/messagesChunkSize, 1);
+        if (removeChunksCount <= 0)
+            return 0;
 
-        LogMessage msg;
-        msg.message = str;
-        msg.type = LogMessage::Type::Warning;
-        msg.idx = mAllMessages.Count();
+        // Only filtered chunks are shown in list
+        int removedRowsCount = mChunksVisibleOffsets[Math::Min(removeChunksCount, mFilteredChunksCount)];
 
-        mAllMessages.Add(msg);
-        if (mWarningMessagesEnabled)
+        for (int i = 0; i < removeChunksCount; i++)
         {
-            msg.idx = mVisibleMessages.Count();
-            mVisibleMessages.Add(msg);
+            auto& chunk = *mMessagesChunks[i];
+            mRegularMessagesCount -= chunk.typeMessages[(int)LogMessage::Type::Regular].Count();
+            mWarningMessagesCount -= chunk.typeMessages[(int)LogMessage::Type::Warning].Count();
+            mErrorMessagesCount -= chunk.typeMessages[(int)LogMessage::Type::Error].Count();
         }
 
-        mList->OnItemsUpdated();
+        mMessagesChunks.RemoveRange(0, removeChunksCount);
 
-        if (isScrollDown)
-            mList->SetScrollForcible(Vec2F(0, mList->GetScrollRange().top));
+        mFilteredChunksCount = Math::Max(mFilteredChunksCount - removeChunksCount, 0);
+        UpdateChunksVisibleOffsets(0);
 
-        mWarningMessagesCount++;
+        mMessagesCountLabel->text = (String)mRegularMessagesCount;
         mWarningsCountLabel->text = (String)mWarningMessagesCount;
+        mErrorsCountLabel->text = (String)mErrorMessagesCount;
 
-        UpdateLastMessageView();
+        return removedRowsCount;
+    }
+
+    LogWindow::LogMessage* LogWindow::GetLastMessage() const
+    {
+        if (mMessagesChunks.IsEmpty() || mMessagesChunks.Last()->count == 0)
+            return nullptr;
+
+        auto& chunk = *mMessagesChunks.Last();
+        return &chunk.messages[chunk.count - 1];
     }
 
     void LogWindow::UpdateLastMessageView()
     {
-        if (mAllMessages.Count() > 0)
+        if (auto lastMessage = GetLastMessage())
         {
             mLastMessageView->Show(true);
-            SetupListMessage(mLastMessageView, (void*)(void*)&mAllMessages.Last());
+            SetupListMessage(mLastMessageView, (void*)lastMessage);
         }
         else mLastMessageView->Hide(true);
     }
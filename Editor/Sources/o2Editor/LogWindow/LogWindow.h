@@ -7,6 +7,7 @@ using namespace o2;
 
 namespace o2
 {
+    class EditBox;
     class Label;
     class LongList;
     class Text;
@@ -33,12 +34,29 @@ namespace Editor
 
             Type   type;     // Type of the log message
             String message;  // Content of the log message
-            int    idx;      // Index of the log message
+            int    idx;      // Index of the log message in visible list, used for rows striping
 
             // Overloading the equality operator to compare two LogMessage objects
             bool operator==(const LogMessage& other) const;
         };
 
+        static constexpr int messagesChunkSize = 1024;   // Count of messages in chunk
+        static constexpr int filterChunksPerUpdate = 16; // Count of chunks filtered by text search in one update
+
+        // -------------------------------------------------------------------------------------------------------
+        // Chunk of messages store. Messages are appended and never moved, so list items refer them without copying.
+        // Keeps indices of messages by type and indices of messages passed filter, built for filter version
+        // -------------------------------------------------------------------------------------------------------
+        struct MessagesChunk: public RefCounterable
+        {
+            LogMessage messages[messagesChunkSize]; // Messages, first count are used
+            int        count = 0;                   // Count of messages in chunk
+
+            Vector<int> typeMessages[3];    // Indices of messages by type
+            Vector<int> visibleMessages;    // Indices of messages passed filter
+            int         filterVersion = -1; // Version of filter, for which visible messages are built
+        };
+
     public:
         // Default constructor
         LogWindow(RefCounter* refCounter);
@@ -60,8 +78,16 @@ namespace Editor
         Ref<Text> mWarningsCountLabel; // Reference to the label displaying the count of warning messages
         Ref<Text> mErrorsCountLabel;   // Reference to the label displaying the count of error messages
 
-        Vector<LogMessage> mAllMessages;    // Vector storing all log messages
-        Vector<LogMessage> mVisibleMessages;// Vector storing visible log messages
+        Ref<EditBox> mSearchEditBox; // Messages text search edit box
+
+        Vector<Ref<MessagesChunk>> mMessagesChunks; // Chunks of stored messages. New messages are appended to last chunk
+
+        int mMaxMessagesCount = 100000; // Max count of stored messages. Oldest chunks are removed when it's exceeded
+
+        Vector<int> mChunksVisibleOffsets;    // Visible index of first message in each chunk. Last element is visible messages count
+        int         mFilteredChunksCount = 0; // Count of chunks from begin, for which visible messages count is known
+        int         mFilterVersion = 0;       // Version of filter, increased when filter is changed
+        String      mSearchText;              // Text search filter. Empty when search is disabled
 
         bool mRegularMessagesEnabled = true; // Flag indicating if regular messages are enabled
         bool mWarningMessagesEnabled = true; // Flag indicating if warning messages are enabled
@@ -87,9 +113,36 @@ namespace Editor
         // Called when error messages toggled
         void OnErrorMessagesToggled(bool value);
 
-        // Updates visible messages
+        // Called when search text edited
+        void OnSearchEdited(const WString& search);
+
+        // Updates visible messages. Invalidates filtered chunks, chunks are filtered on demand or in updates
         void UpdateVisibleMessages();
 
+        // Returns is message passes types and text search filter
+        bool IsMessageVisible(const LogMessage& message) const;
+
+        // Returns count of chunk visible messages. Returns -1 when chunk isn't filtered by text search yet
+        int GetChunkVisibleMessagesCount(const MessagesChunk& chunk) const;
+
+        // Builds chunk visible messages by current filter
+        void FilterChunk(MessagesChunk& chunk);
+
+        // Filters next chunks by text search, limited by filterChunksPerUpdate
+        void FilterNextChunks();
+
+        // Updates chunks visible offsets starting from chunk, stops at first chunk with unknown visible count
+        void UpdateChunksVisibleOffsets(int fromChunk);
+
+        // Adds message to store and updates list
+        void AddMessage(LogMessage::Type type, const WString& str);
+
+        // Removes oldest chunks when messages count exceeds max. Returns count of removed visible messages
+        int RemoveOldMessages();
+
+        // Returns last stored message. Returns null when there are no messages
+        LogMessage* GetLastMessage() const;
+
         // Returns visible items count
         int GetVisibleMessagesCount();
 
@@ -131,8 +184,13 @@ CLASS_FIELDS_META(Editor::LogWindow)
     FIELD().PROTECTED().NAME(mMessagesCountLabel);
     FIELD().PROTECTED().NAME(mWarningsCountLabel);
     FIELD().PROTECTED().NAME(mErrorsCountLabel);
-    FIELD().PROTECTED().NAME(mAllMessages);
-    FIELD().PROTECTED().NAME(mVisibleMessages);
+    FIELD().PROTECTED().NAME(mSearchEditBox);
+    FIELD().PROTECTED().NAME(mMessagesChunks);
+    FIELD().PROTECTED().DEFAULT_VALUE(100000).NAME(mMaxMessagesCount);
+    FIELD().PROTECTED().NAME(mChunksVisibleOffsets);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mFilteredChunksCount);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mFilterVersion);
+    FIELD().PROTECTED().NAME(mSearchText);
     FIELD().PROTECTED().DEFAULT_VALUE(true).NAME(mRegularMessagesEnabled);
     FIELD().PROTECTED().DEFAULT_VALUE(true).NAME(mWarningMessagesEnabled);
     FIELD().PROTECTED().DEFAULT_VALUE(true).NAME(mErrorMessagesEnabled);
@@ -152,7 +210,16 @@ CLASS_METHODS_META(Editor::LogWindow)
     FUNCTION().PROTECTED().SIGNATURE(void, OnRegularMessagesToggled, bool);
     FUNCTION().PROTECTED().SIGNATURE(void, OnWarningMessagesToggled, bool);
     FUNCTION().PROTECTED().SIGNATURE(void, OnErrorMessagesToggled, bool);
+    FUNCTION().PROTECTED().SIGNATURE(void, OnSearchEdited, const WString&);
     FUNCTION().PROTECTED().SIGNATURE(void, UpdateVisibleMessages);
+    FUNCTION().PROTECTED().SIGNATURE(bool, IsMessageVisible, const LogMessage&);
+    FUNCTION().PROTECTED().SIGNATURE(int, GetChunkVisibleMessagesCount, const MessagesChunk&);
+    FUNCTION().PROTECTED().SIGNATURE(void, FilterChunk, MessagesChunk&);
+    FUNCTION().PROTECTED().SIGNATURE(void, FilterNextChunks);
+    FUNCTION().PROTECTED().SIGNATURE(void, UpdateChunksVisibleOffsets, int);
+    FUNCTION().PROTECTED().SIGNATURE(void, AddMessage, LogMessage::Type, const WString&);
+    FUNCTION().PROTECTED().SIGNATURE(int, RemoveOldMessages);
+    FUNCTION().PROTECTED().SIGNATURE(LogMessage*, GetLastMessage);
     FUNCTION().PROTECTED().SIGNATURE(int, GetVisibleMessagesCount);
     FUNCTION().PROTECTED().SIGNATURE(Vector<void*>, GetVisibleMessagesRange, int, int);
     FUNCTION().PROTECTED().SIGNATURE(void, SetupListMessage, const Ref<Widget>&, void*);
@@ -218,8 +218,11 @@ namespace Editor
                 if (!layer->visible)
                     continue;
 
-                for (auto& drawable : layer->GetDrawables()) 
-                    drawable->Draw();
+                for (auto& drawable : layer->GetDrawables())
+                {
+                    if (drawable)
+                        drawable->Draw();
+                }
             }
 
             o2Scene.EndDrawingScene();
@@ -24,6 +24,7 @@ extern void __RegisterClass__Editor__AssetsIconsScrollArea();
 extern void __RegisterClass__Editor__AssetsWindow();
 extern void __RegisterClass__Editor__AssetsFoldersTree();
 extern void __RegisterClass__Editor__FoldersTree();
+extern void __RegisterClass__Editor__ActionData();
 extern void __RegisterClass__Editor__CreateAction();
 extern void __RegisterClass__Editor__DeleteAction();
 extern void __RegisterClass__Editor__DeleteAction__ObjectInfo();
@@ -182,6 +183,7 @@ extern void InitializeTypeso2Editor()
     __RegisterClass__Editor__AssetsWindow();
     __RegisterClass__Editor__AssetsFoldersTree();
     __RegisterClass__Editor__FoldersTree();
+    __RegisterClass__Editor__ActionData();
     __RegisterClass__Editor__CreateAction();
     __RegisterClass__Editor__DeleteAction();
     __RegisterClass__Editor__DeleteAction__ObjectInfo();
@@ -17,6 +17,7 @@
 #include "o2/Utils/Debug/StackTrace.h"
 #include "o2/Utils/Editor/EditorScope.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 #include "o2/Utils/System/Time/Time.h"
 #include "o2/Utils/System/Time/Timer.h"
 #include "o2/Utils/Tasks/TaskManager.h"
@@ -62,6 +63,12 @@ namespace o2
         PROFILE_SAMPLE_FUNC();
 
         InitalizeSystems();
+
+#if defined PLATFORM_WINDOWS || defined PLATFORM_LINUX
+        if (mHeadless)
+            mNeedPlatformInitialization = false;
+#endif
+
         InitializePlatform();
 
         mRender = mmake<Render>();
@@ -72,6 +79,56 @@ namespace o2
         mReady = true;
     }
 
+    void Application::InitializeHeadless()
+    {
+        mHeadless = true;
+        BasicInitialize();
+
+        mLog->Out("Application launched headless");
+
+        OnStarted();
+        onStarted.Invoke();
+        o2Events.OnApplicationStarted();
+    }
+
+    void Application::AdvanceFrames(int framesCount)
+    {
+        for (int i = 0; i < framesCount; i++)
+            ProcessFrame();
+    }
+
+    void Application::CloseHeadless()
+    {
+        o2Events.OnApplicationClosing();
+        OnClosing();
+        onClosing.Invoke();
+    }
+
+    bool Application::IsHeadless() const
+    {
+        return mHeadless;
+    }
+
+    void Application::SetFrameDeltaTime(float dt)
+    {
+        mFrameDeltaTime = dt;
+    }
+
+    float Application::GetFrameDeltaTime() const
+    {
+        return mFrameDeltaTime;
+    }
+
+    void Application::SetFrameDeltaTimeFunc(const Function<float(int)>& func)
+    {
+        mFrameDeltaTimeFunc = func;
+    }
+
+    int Application::GetProcessedFramesCount() const
+    {
+        return mProcessedFramesCount;
+    }
+
     void Application::OnResized(const Vec2I& size)
     {
         mWindowedSize = size;
@@ -111,11 +168,18 @@ namespace o2
         mPhysics->PostUpdate();
     }
 
+    void Application::BeginThreadedPhysicsStep(float dt, int stepsCount, float alpha)
+    {
+        PROFILE_SAMPLE_FUNC();
+        mPhysics->PresentInterpolated(alpha);
+        mPhysics->BeginThreadedStep(dt, stepsCount);
+    }
+
     void Application::InitalizeSystems()
     {
         PROFILE_SAMPLE_FUNC();
 
-        srand((UInt)time(NULL));
+        srand(mHeadless ? 0 : (UInt)time(NULL));
 
         mTime = mmake<Time>();
 
@@ -181,6 +245,8 @@ namespace o2
         if (!mReady)
             return;
 
+        FrameAllocator::BeginFrame();
+
         float dt = 0, realDt = 0;
 
         {
@@ -189,17 +255,26 @@ namespace o2
             if (mCursorInfiniteModeEnabled)
                 CheckCursorInfiniteMode();
 
-            float maxFPSDeltaTime = 1.0f/(float)maxFPS;
-
-            realDt = mTimer.GetDeltaTime();
-
-            if (realDt < maxFPSDeltaTime)
+            float drivenDt = GetDrivenFrameDeltaTime();
+            if (drivenDt >= 0.0f)
             {
-                std::this_thread::sleep_for(std::chrono::milliseconds((int)((maxFPSDeltaTime - realDt)*1000.0f)));
-                realDt = maxFPSDeltaTime;
+                mTimer.Reset();
+                realDt = dt = drivenDt;
             }
+            else
+            {
+                float maxFPSDeltaTime = 1.0f/(float)maxFPS;
+
+                realDt = mTimer.GetDeltaTime();
+
+                if (realDt < maxFPSDeltaTime)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds((int)((maxFPSDeltaTime - realDt)*1000.0f)));
+                    realDt = maxFPSDeltaTime;
+                }
 
-            dt = Math::Clamp(realDt, 0.001f, 0.05f);
+                dt = Math::Clamp(realDt, 0.001f, 0.05f);
+            }
         }
 
         mInput->PreUpdate();
@@ -219,33 +294,48 @@ namespace o2
 
             mAccumulatedDT += dt;
             float fixedDT = 1.0f/(float)fixedFPS;
+            bool threadedPhysics = o2Config.physics.threadedStepping;
+            int physicsStepsCount = 0;
             while (mAccumulatedDT > fixedDT)
             {
                 OnFixedUpdate(fixedDT);
                 FixedUpdateScene(fixedDT);
 
-                PreUpdatePhysics();
-                UpdatePhysics(fixedDT);
-                PostUpdatePhysics();
+                if (threadedPhysics)
+                    physicsStepsCount++;
+                else
+                {
+                    PreUpdatePhysics();
+                    UpdatePhysics(fixedDT);
+                    PostUpdatePhysics();
+                }
 
                 mAccumulatedDT -= fixedDT;
             }
+
+            // Physics steps of this frame are running on worker thread, while actors are shown in between of
+            // states of previous frame steps
+            if (threadedPhysics)
+                BeginThreadedPhysicsStep(fixedDT, physicsStepsCount, mAccumulatedDT/fixedDT);
         }
 
         PostUpdateEventSystem();
-        
-        mMainListenersLayer->OnBeginDraw();
-        SetupGraphicsScaledCamera();
-        mMainListenersLayer->camera = o2Render.GetCamera();
 
-        DrawScene();
-        OnDraw();
+        if (!mHeadless)
+        {
+            mMainListenersLayer->OnBeginDraw();
+            SetupGraphicsScaledCamera();
+            mMainListenersLayer->camera = o2Render.GetCamera();
+
+            DrawScene();
+            OnDraw();
 
-        DrawUIManager();
-        DrawDebug();
+            DrawUIManager();
+            DrawDebug();
 
-        mMainListenersLayer->OnEndDraw();
-        mMainListenersLayer->OnDrawn(Camera::Default().GetBasis());
+            mMainListenersLayer->OnEndDraw();
+            mMainListenersLayer->OnDrawn(Camera::Default().GetBasis());
+        }
 
         mRender->End();
 
@@ -254,9 +344,26 @@ namespace o2
 
         mAssets->CheckAssetsUnload();
 
+        mProcessedFramesCount++;
+
         PROFILE_FRAME();
     }
 
+    float Application::GetDrivenFrameDeltaTime() const
+    {
+        if (!mFrameDeltaTimeFunc.IsEmpty())
+            return mFrameDeltaTimeFunc(mProcessedFramesCount);
+
+        if (mFrameDeltaTime > 0.0f)
+            return mFrameDeltaTime;
+
+        // Headless application has no real frames timing, it's updated with fixed frame rate by default
+        if (mHeadless)
+            return 1.0f/(float)fixedFPS;
+
+        return -1.0f;
+    }
+
     void Application::DrawScene()
     {
         PROFILE_SAMPLE_FUNC();
@@ -155,6 +155,32 @@ namespace o2
         // Returns is application ready to use
         static bool IsReady();
 
+        // Initializes application in headless mode: without platform window and graphics API. Frames are processed
+        // by AdvanceFrames(), random is seeded with constant value
+        void InitializeHeadless();
+
+        // Processes frames as fast as possible, without platform messages and frame rate limiting
+        void AdvanceFrames(int framesCount);
+
+        // Calls application closing events. Used in headless mode instead of finishing platform application cycle
+        void CloseHeadless();
+
+        // Returns is application running without platform window and graphics API
+        bool IsHeadless() const;
+
+        // Sets constant frame delta time. When it's positive, frames are updated with it instead of real time and
+        // without frame rate limiting
+        void SetFrameDeltaTime(float dt);
+
+        // Returns constant frame delta time. Zero when frames are updated with real time
+        float GetFrameDeltaTime() const;
+
+        // Sets function, returning delta time for frame by its index. Overrides constant frame delta time
+        void SetFrameDeltaTimeFunc(const Function<float(int)>& func);
+
+        // Returns count of processed frames
+        int GetProcessedFramesCount() const;
+
         IOBJECT(Application);
 
 #if defined PLATFORM_WINDOWS
@@ -235,6 +261,11 @@ namespace o2
         
         float mGraphicsScale = 1.0f; // Application graphics scale. Used in mac for retina displays
 
+        bool                 mHeadless = false;         // Is application running without platform window and graphics API
+        float                mFrameDeltaTime = 0.0f;    // Constant frame delta time. Zero when frames are updated with real time
+        Function<float(int)> mFrameDeltaTimeFunc;       // Function returning delta time for frame by index
+        int                  mProcessedFramesCount = 0; // Count of processed frames
+
     protected:
         // Basic initialization for all platforms
         virtual void BasicInitialize();
@@ -257,6 +288,9 @@ namespace o2
         // After update physics
         virtual void PostUpdatePhysics();
 
+        // Interpolates actors between last physics states and starts stepping physics on worker thread
+        virtual void BeginThreadedPhysicsStep(float dt, int stepsCount, float alpha);
+
         // Draws scene
         virtual void DrawScene();
 
@@ -314,6 +348,10 @@ namespace o2
         // Processing frame update, drawing and input messages
         virtual void ProcessFrame();
 
+        // Returns delta time for current frame: constant or returned by delta time function. Negative when frames are
+        // updated with real time
+        float GetDrivenFrameDeltaTime() const;
+
         // Checks that cursor is near border and moves to opposite border if needs
         void CheckCursorInfiniteMode();
 
@@ -367,6 +405,10 @@ CLASS_FIELDS_META(o2::Application)
     FIELD().PROTECTED().DEFAULT_VALUE(0.0f).NAME(mAccumulatedDT);
     FIELD().PROTECTED().NAME(mMainListenersLayer);
     FIELD().PROTECTED().DEFAULT_VALUE(1.0f).NAME(mGraphicsScale);
+    FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mHeadless);
+    FIELD().PROTECTED().DEFAULT_VALUE(0.0f).NAME(mFrameDeltaTime);
+    FIELD().PROTECTED().NAME(mFrameDeltaTimeFunc);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mProcessedFramesCount);
 }
 END_META;
 CLASS_METHODS_META(o2::Application)
@@ -399,6 +441,14 @@ CLASS_METHODS_META(o2::Application)
     FUNCTION().PUBLIC().SIGNATURE(String, GetBinPath);
     FUNCTION().PUBLIC().SIGNATURE(float, GetGraphicsScale);
     FUNCTION().PUBLIC().SIGNATURE_STATIC(bool, IsReady);
+    FUNCTION().PUBLIC().SIGNATURE(void, InitializeHeadless);
+    FUNCTION().PUBLIC().SIGNATURE(void, AdvanceFrames, int);
+    FUNCTION().PUBLIC().SIGNATURE(void, CloseHeadless);
+    FUNCTION().PUBLIC().SIGNATURE(bool, IsHeadless);
+    FUNCTION().PUBLIC().SIGNATURE(void, SetFrameDeltaTime, float);
+    FUNCTION().PUBLIC().SIGNATURE(float, GetFrameDeltaTime);
+    FUNCTION().PUBLIC().SIGNATURE(void, SetFrameDeltaTimeFunc, const Function<float(int)>&);
+    FUNCTION().PUBLIC().SIGNATURE(int, GetProcessedFramesCount);
 #if  defined PLATFORM_WINDOWS
     FUNCTION().PUBLIC().SIGNATURE(void, Initialize);
     FUNCTION().PUBLIC().SIGNATURE(void, Launch);
@@ -429,6 +479,7 @@ CLASS_METHODS_META(o2::Application)
     FUNCTION().PROTECTED().SIGNATURE(void, PreUpdatePhysics);
     FUNCTION().PROTECTED().SIGNATURE(void, UpdatePhysics, float);
     FUNCTION().PROTECTED().SIGNATURE(void, PostUpdatePhysics);
+    FUNCTION().PROTECTED().SIGNATURE(void, BeginThreadedPhysicsStep, float, int, float);
     FUNCTION().PROTECTED().SIGNATURE(void, DrawScene);
     FUNCTION().PROTECTED().SIGNATURE(void, UpdateEventSystem);
     FUNCTION().PROTECTED().SIGNATURE(void, PostUpdateEventSystem);
@@ -448,6 +499,7 @@ CLASS_METHODS_META(o2::Application)
     FUNCTION().PROTECTED().SIGNATURE(void, InitalizeSystems);
     FUNCTION().PROTECTED().SIGNATURE(void, DeinitializeSystems);
     FUNCTION().PROTECTED().SIGNATURE(void, ProcessFrame);
+    FUNCTION().PROTECTED().SIGNATURE(float, GetDrivenFrameDeltaTime);
     FUNCTION().PROTECTED().SIGNATURE(void, CheckCursorInfiniteMode);
 }
 END_META;
@@ -92,6 +92,9 @@ namespace o2
 
     void ActorAsset::SetActor(const Ref<Actor>& actor)
     {
+        if (mActor)
+            mActor->InvalidateInstantiationTemplate();
+
         mActor = actor;
 
         if (mActor)
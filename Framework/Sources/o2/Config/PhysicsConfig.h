@@ -15,6 +15,8 @@ namespace o2
 
         float debugDrawAlpha = 0.5f; // Debug draw transparency @SERIALIZABLE
 
+        bool threadedStepping = false; // Is world stepped on worker thread one frame ahead, actors are interpolated @SERIALIZABLE
+
         SERIALIZABLE(PhysicsConfig);
     };
 }
@@ -32,6 +34,7 @@ CLASS_FIELDS_META(o2::PhysicsConfig)
     FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(8).NAME(velocityIterations);
     FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(3).NAME(positionIterations);
     FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.5f).NAME(debugDrawAlpha);
+    FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(threadedStepping);
 }
 END_META;
 CLASS_METHODS_META(o2::PhysicsConfig)
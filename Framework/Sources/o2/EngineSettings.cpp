@@ -85,6 +85,20 @@ const char* GetAssetsRootPath()
     return "Assets/";
 }
 
+const char* GetProjectTempPath()
+{
+    static char path[256] = "";
+    static bool initialized = false;
+    if (!initialized)
+    {
+        initialized = true;
+        strcat(path, GetProjectRootPath());
+        strcat(path, "Temp/");
+    }
+
+    return path;
+}
+
 const char* GetAssetsPath()
 {
     static char path[256] = "";
@@ -3,8 +3,8 @@
 
 #define DEBUG
 
-// Enables memory managing
-#if defined DEBUG
+// Enables memory managing: managed allocations are tracked by allocation source. Enabled in debug builds and with memory analyzing
+#if defined MEMORY_MANAGE_ENABLE || defined MEMORY_ANALYZE_ENABLE
 #define ENABLE_MEMORY_MANAGE true
 #else
 #define ENABLE_MEMORY_MANAGE false
@@ -23,6 +23,20 @@
 #define ENABLE_MEMORY_ANALYZE false
 #endif
 
+// Enables atomic reference counting, Ref<> and WeakRef<> can be shared between threads
+#if defined THREAD_SAFE_REFS_ENABLE
+#define ENABLE_THREAD_SAFE_REFS true
+#else
+#define ENABLE_THREAD_SAFE_REFS false
+#endif
+
+// Installs terminate and fatal signals handlers, which write remaining async log records on crash
+#if defined LOG_CRASH_HANDLERS_ENABLE
+#define ENABLE_LOG_CRASH_HANDLERS true
+#else
+#define ENABLE_LOG_CRASH_HANDLERS false
+#endif
+
 // Describes that engine running as editor or not
 #if defined O2_EDITOR_ENABLED
 #define IS_EDITOR true
@@ -71,6 +85,9 @@ const char* GetProjectRootPath();
 // Assets path. Relative from project root
 const char* GetAssetsRootPath();
 
+// Temporary files path, like caches and spilled editor data. Relative from executable
+const char* GetProjectTempPath();
+
 // Basic atlas path (from assets path)
 const char* GetBasicAtlasPath();
 
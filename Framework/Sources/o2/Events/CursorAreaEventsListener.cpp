@@ -25,6 +25,11 @@ namespace o2
         return true;
     }
 
+    RectF CursorAreaEventsListener::GetCursorAreaBounds() const
+    {
+        return mScissorRect;
+    }
+
     bool CursorAreaEventsListener::IsScrollable() const
     {
         return false;
@@ -36,6 +36,10 @@ namespace o2
         // Returns true if point is in this object
         virtual bool IsUnderPoint(const Vec2F& point);
 
+        // Returns rectangle outside of which IsUnderPoint is always false. Used for hit testing acceleration,
+        // must be overridden together with IsUnderPoint. By default returns scissor rect at drawing moment
+        virtual RectF GetCursorAreaBounds() const;
+
         // Returns is listener scrollable
         virtual bool IsScrollable() const;
 
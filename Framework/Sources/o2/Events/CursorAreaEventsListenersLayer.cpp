@@ -78,6 +78,7 @@ namespace o2
 
         cursorEventAreaListeners.Reverse();
         mDragListeners.Reverse();
+        mListenersGridDirty = true;
 
         mLastUnderCursorListeners = mUnderCursorListeners;
         mUnderCursorListeners.Clear();
@@ -138,6 +139,8 @@ namespace o2
     {
         cursorEventAreaListeners.Clear();
         mDragListeners.Clear();
+        mListenersGrid.Clear();
+        mListenersGridDirty = true;
     }
 
     void CursorAreaEventListenersLayer::BreakCursorEvent()
@@ -157,6 +160,7 @@ namespace o2
     void CursorAreaEventListenersLayer::UnregCursorAreaListener(CursorAreaEventsListener* listener)
     {
         cursorEventAreaListeners.RemoveFirst([&](auto& x) { return x == listener; });
+        mListenersGridDirty = true;
     }
 
     void CursorAreaEventListenersLayer::UnregDragListener(DragableObject* listener)
@@ -164,23 +168,32 @@ namespace o2
         mDragListeners.RemoveFirst([&](auto& x) { return x == listener; });
     }
 
-    Vector<Ref<CursorAreaEventsListener>> CursorAreaEventListenersLayer::GetAllCursorListenersUnderCursor(const Vec2F& cursorPos) const
+    FrameVector<Ref<CursorAreaEventsListener>> CursorAreaEventListenersLayer::GetAllCursorListenersUnderCursor(const Vec2F& cursorPos) const
+    {
+        FrameVector<Ref<CursorAreaEventsListener>> res;
+        CollectCursorListenersUnderCursor(cursorPos, res);
+        return res;
+    }
+
+    void CursorAreaEventListenersLayer::CollectCursorListenersUnderCursor(const Vec2F& cursorPos,
+                                                                          FrameVector<Ref<CursorAreaEventsListener>>& result) const
     {
-        Vector<Ref<CursorAreaEventsListener>> res;
         Vec2F localCursorPos = ToLocal(cursorPos);
-        for (auto& listenerWeak : cursorEventAreaListeners)
+
+        FrameVector<int> candidates;
+        GetListenersCandidates(localCursorPos, candidates);
+
+        for (int idx : candidates)
         {
-            auto listener = listenerWeak.Lock();
+            auto listener = cursorEventAreaListeners[idx].Lock();
             if (!listener || !listener->IsUnderPoint(localCursorPos) || !listener->mScissorRect.IsInside(localCursorPos) || !listener->mInteractable)
                 continue;
 
             if (auto layer = DynamicCast<CursorAreaEventListenersLayer>(listener))
-                res += layer->GetAllCursorListenersUnderCursor(localCursorPos);
+                layer->CollectCursorListenersUnderCursor(localCursorPos, result);
             else
-                res.Add(listener);
+                result.Add(listener);
         }
-
-        return res;
     }
 
     bool CursorAreaEventListenersLayer::IsUnderPoint(const Vec2F& point)
@@ -188,6 +201,11 @@ namespace o2
         return drawnTransform.IsPointInside(point);
     }
 
+    RectF CursorAreaEventListenersLayer::GetCursorAreaBounds() const
+    {
+        return drawnTransform.AABB();
+    }
+
     bool CursorAreaEventListenersLayer::IsInputTransparent() const
     {
         return isTransparent;
@@ -212,13 +230,48 @@ namespace o2
         return localCursor;
     }
 
+    void CursorAreaEventListenersLayer::GetListenersCandidates(const Vec2F& point, FrameVector<int>& result) const
+    {
+        int count = cursorEventAreaListeners.Count();
+        if (count < mMinListenersCountForGrid)
+        {
+            result.Clear();
+            result.Reserve(count);
+            for (int i = 0; i < count; i++)
+                result.Add(i);
+
+            return;
+        }
+
+        if (mListenersGridDirty || mListenersGrid.GetCount() != count)
+        {
+            Vector<RectF> bounds;
+            bounds.Reserve(count);
+            for (auto& listenerWeak : cursorEventAreaListeners)
+            {
+                if (auto listener = listenerWeak.Lock())
+                    bounds.Add(listener->GetCursorAreaBounds().GetIntersection(listener->mScissorRect));
+                else
+                    bounds.Add(RectF());
+            }
+
+            mListenersGrid.Build(bounds);
+            mListenersGridDirty = false;
+        }
+
+        mListenersGrid.GetCandidates(point, result);
+    }
+
     void CursorAreaEventListenersLayer::ProcessCursorTracing(const Input::Cursor& cursor)
     {
         auto localCursor = ConvertLocalCursor(cursor);
 
-        for (auto& listenerWeak : cursorEventAreaListeners)
+        FrameVector<int> candidates;
+        GetListenersCandidates(localCursor.position, candidates);
+
+        for (int idx : candidates)
         {
-            auto listener = listenerWeak.Lock();
+            auto listener = cursorEventAreaListeners[idx].Lock();
             if (!listener || !listener->IsUnderPoint(localCursor.position) || !listener->mScissorRect.IsInside(localCursor.position))
                 continue;
 
@@ -1,7 +1,9 @@
 #pragma once
 #include "o2/Events/CursorAreaEventsListener.h"
+#include "o2/Events/CursorAreaListenersGrid.h"
 #include "o2/Render/Camera.h"
 #include "o2/Utils/Math/Basis.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 #include "o2/Utils/Types/Containers/Vector.h"
 
 namespace o2
@@ -61,12 +63,15 @@ namespace o2
         // Unregistering drag events listener
         void UnregDragListener(DragableObject* listener);
 
-        // Returns all cursor listeners under cursor arranged by depth
-        Vector<Ref<CursorAreaEventsListener>> GetAllCursorListenersUnderCursor(const Vec2F& cursorPos) const;
+        // Returns all cursor listeners under cursor arranged by depth. Result is valid only in current frame
+        FrameVector<Ref<CursorAreaEventsListener>> GetAllCursorListenersUnderCursor(const Vec2F& cursorPos) const;
 
         // Returns true if point is in this object
         bool IsUnderPoint(const Vec2F& point) override;
 
+        // Returns drawn transform bounds
+        RectF GetCursorAreaBounds() const override;
+
         // Returns true when input events can be handled by down listeners
         bool IsInputTransparent() const override;
 
@@ -86,6 +91,11 @@ namespace o2
 
         Vector<Ref<DragableObject>> mDragListeners; // Drag events listeners
 
+        static constexpr int mMinListenersCountForGrid = 32; // Minimal count of listeners when spatial grid is used for hit testing
+
+        mutable CursorAreaListenersGrid mListenersGrid;             // Spatial grid over listeners bounds, rebuilt lazily once per frame
+        mutable bool                    mListenersGridDirty = true; // True when listeners list was changed and grid must be rebuilt
+
     private:
         // Called when cursor enters this object
         void OnCursorEnter(const Input::Cursor& cursor) override;
@@ -96,6 +106,12 @@ namespace o2
         // Converts cursor to local coordinates
         Input::Cursor ConvertLocalCursor(const Input::Cursor& cursor) const;
 
+        // Collects all cursor listeners under cursor arranged by depth, including sub layers listeners
+        void CollectCursorListenersUnderCursor(const Vec2F& cursorPos, FrameVector<Ref<CursorAreaEventsListener>>& result) const;
+
+        // Collects indices of listeners which can be under point, in listeners order. Uses spatial grid for big listeners lists
+        void GetListenersCandidates(const Vec2F& point, FrameVector<int>& result) const;
+
         // processes cursor tracing for cursor
         void ProcessCursorTracing(const Input::Cursor& cursor);
 
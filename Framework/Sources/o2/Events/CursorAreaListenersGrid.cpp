@@ -0,0 +1,159 @@
+#include "o2/stdafx.h"
+#include "CursorAreaListenersGrid.h"
+
+namespace o2
+{
+    void CursorAreaListenersGrid::Build(const Vector<RectF>& bounds)
+    {
+        Clear();
+
+        mBounds = bounds;
+
+        auto isBounded = [](const RectF& rect) { return rect.Width() < mMaxBoundedSize && rect.Height() < mMaxBoundedSize; };
+
+        int boundedCount = 0;
+        for (auto& rect : mBounds)
+        {
+            if (!isBounded(rect))
+                continue;
+
+            mArea = boundedCount == 0 ? rect : mArea.Expand(rect);
+            boundedCount++;
+        }
+
+        if (boundedCount == 0)
+        {
+            for (int i = 0; i < mBounds.Count(); i++)
+                mCommonItems.Add(i);
+
+            return;
+        }
+
+        int cellsPerSide = Math::Clamp((int)Math::Ceil(Math::Sqrt((float)boundedCount)), 1, mMaxCellsPerSide);
+        mCellsX = mArea.Width() > FLT_EPSILON ? cellsPerSide : 1;
+        mCellsY = mArea.Height() > FLT_EPSILON ? cellsPerSide : 1;
+        mInvCellSize.x = mArea.Width() > FLT_EPSILON ? mCellsX/mArea.Width() : 0.0f;
+        mInvCellSize.y = mArea.Height() > FLT_EPSILON ? mCellsY/mArea.Height() : 0.0f;
+
+        int cellsCount = mCellsX*mCellsY;
+        int maxCoveredCells = Math::Max(cellsCount/2, 4);
+
+        // First pass counts items in cells, second one fills cells lists. Listeners are
+        // iterated in ascending order, so each cell list is sorted
+        mCellsOffsets.Resize(cellsCount + 1);
+        for (auto& offset : mCellsOffsets)
+            offset = 0;
+
+        FrameVector<bool> isCommon(mBounds.Count(), false);
+        for (int i = 0; i < mBounds.Count(); i++)
+        {
+            auto& rect = mBounds[i];
+            if (!isBounded(rect))
+            {
+                isCommon[i] = true;
+                mCommonItems.Add(i);
+                continue;
+            }
+
+            int x0 = GetCellX(rect.left), x1 = GetCellX(rect.right);
+            int y0 = GetCellY(rect.bottom), y1 = GetCellY(rect.top);
+
+            if ((x1 - x0 + 1)*(y1 - y0 + 1) > maxCoveredCells)
+            {
+                isCommon[i] = true;
+                mCommonItems.Add(i);
+                continue;
+            }
+
+            for (int y = y0; y <= y1; y++)
+            {
+                for (int x = x0; x <= x1; x++)
+                    mCellsOffsets[y*mCellsX + x + 1]++;
+            }
+        }
+
+        for (int i = 0; i < cellsCount; i++)
+            mCellsOffsets[i + 1] += mCellsOffsets[i];
+
+        mCellsItems.Resize(mCellsOffsets.Last());
+
+        FrameVector<int> cellsCarets(mCellsOffsets.begin(), mCellsOffsets.end() - 1);
+        for (int i = 0; i < mBounds.Count(); i++)
+        {
+            if (isCommon[i])
+                continue;
+
+            auto& rect = mBounds[i];
+            int x0 = GetCellX(rect.left), x1 = GetCellX(rect.right);
+            int y0 = GetCellY(rect.bottom), y1 = GetCellY(rect.top);
+
+            for (int y = y0; y <= y1; y++)
+            {
+                for (int x = x0; x <= x1; x++)
+                    mCellsItems[cellsCarets[y*mCellsX + x]++] = i;
+            }
+        }
+    }
+
+    void CursorAreaListenersGrid::Clear()
+    {
+        mBounds.Clear();
+        mArea = RectF();
+        mInvCellSize = Vec2F();
+        mCellsX = 0;
+        mCellsY = 0;
+        mCellsOffsets.Clear();
+        mCellsItems.Clear();
+        mCommonItems.Clear();
+    }
+
+    int CursorAreaListenersGrid::GetCount() const
+    {
+        return mBounds.Count();
+    }
+
+    void CursorAreaListenersGrid::GetCandidates(const Vec2F& point, FrameVector<int>& result) const
+    {
+        result.Clear();
+
+        const int* cellBegin = nullptr;
+        const int* cellEnd = nullptr;
+        if (mCellsX > 0 && IsInsideBounds(mArea, point))
+        {
+            int cell = GetCellY(point.y)*mCellsX + GetCellX(point.x);
+            cellBegin = mCellsItems.data() + mCellsOffsets[cell];
+            cellEnd = mCellsItems.data() + mCellsOffsets[cell + 1];
+        }
+
+        const int* commonBegin = mCommonItems.data();
+        const int* commonEnd = mCommonItems.data() + mCommonItems.Count();
+
+        // Merging cell and common lists, both are sorted
+        while (cellBegin != cellEnd || commonBegin != commonEnd)
+        {
+            int idx;
+            if (cellBegin != cellEnd && (commonBegin == commonEnd || *cellBegin < *commonBegin))
+                idx = *cellBegin++;
+            else
+                idx = *commonBegin++;
+
+            if (IsInsideBounds(mBounds[idx], point))
+                result.Add(idx);
+        }
+    }
+
+    bool CursorAreaListenersGrid::IsInsideBounds(const RectF& bounds, const Vec2F& point)
+    {
+        return point.x >= bounds.left && point.x <= bounds.right && point.y >= bounds.bottom && point.y <= bounds.top;
+    }
+
+    int CursorAreaListenersGrid::GetCellX(float x) const
+    {
+        return Math::Clamp((int)((x - mArea.left)*mInvCellSize.x), 0, mCellsX - 1);
+    }
+
+    int CursorAreaListenersGrid::GetCellY(float y) const
+    {
+        return Math::Clamp((int)((y - mArea.bottom)*mInvCellSize.y), 0, mCellsY - 1);
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+    // -------------------------------------------------------------------------------------------
+    // Uniform grid over cursor listeners bounds. Listeners are identified by index in the layer's
+    // listeners list. Candidates are returned in ascending order, so listeners priority is kept
+    // -------------------------------------------------------------------------------------------
+    class CursorAreaListenersGrid
+    {
+    public:
+        // Rebuilds grid by listeners bounds. Index of bounds is listener index
+        void Build(const Vector<RectF>& bounds);
+
+        // Removes all listeners from grid
+        void Clear();
+
+        // Returns count of indexed listeners
+        int GetCount() const;
+
+        // Collects indices of listeners which bounds contains point, in ascending order
+        void GetCandidates(const Vec2F& point, FrameVector<int>& result) const;
+
+    protected:
+        static constexpr int   mMaxCellsPerSide = 64;     // Max count of cells by one axis
+        static constexpr float mMaxBoundedSize = 1000000; // Listeners bigger than this are checked always
+
+        Vector<RectF> mBounds; // Listeners bounds
+
+        RectF mArea;           // Area covered by grid
+        Vec2F mInvCellSize;    // Inverted size of one cell
+        int   mCellsX = 0;     // Count of cells by x
+        int   mCellsY = 0;     // Count of cells by y
+
+        Vector<int> mCellsOffsets; // Offsets of cells lists in mCellsItems. Size is cells count + 1
+        Vector<int> mCellsItems;   // Listeners indices by cells, each cell list is sorted
+        Vector<int> mCommonItems;  // Indices of listeners that are too big for cells, checked always
+
+    protected:
+        // Returns is point inside bounds, including borders
+        static bool IsInsideBounds(const RectF& bounds, const Vec2F& point);
+
+        // Returns cell coordinate by x
+        int GetCellX(float x) const;
+
+        // Returns cell coordinate by y
+        int GetCellY(float y) const;
+    };
+}
@@ -136,9 +136,11 @@ namespace o2
         if (o2Input.IsKeyDown(VK_F1))
         {
             int line = 0;
-            auto allUnderCursor = o2Input.IsKeyDown(VK_CONTROL) ? 
-                GetAllCursorListenersUnderCursor(0) : 
-                mCursorAreaListenersBasicLayer->mUnderCursorListeners[0];
+            FrameVector<Ref<CursorAreaEventsListener>> allUnderCursor;
+            if (o2Input.IsKeyDown(VK_CONTROL))
+                allUnderCursor = GetAllCursorListenersUnderCursor(0);
+            else
+                allUnderCursor.Add(mCursorAreaListenersBasicLayer->mUnderCursorListeners[0]);
 
             for (auto& listener : allUnderCursor)
             {
@@ -226,7 +228,7 @@ namespace o2
 
     bool EventSystem::eventsListenersEnabledByDefault = true;
 
-    Vector<Ref<CursorAreaEventsListener>> EventSystem::GetAllCursorListenersUnderCursor(CursorId cursorId) const
+    FrameVector<Ref<CursorAreaEventsListener>> EventSystem::GetAllCursorListenersUnderCursor(CursorId cursorId) const
     {
         return mCursorAreaListenersBasicLayer->GetAllCursorListenersUnderCursor(o2Input.GetCursorPos(cursorId));
     }
@@ -269,6 +271,9 @@ namespace o2
 
     void EventSystem::PushCursorAreaEventsListenersLayer(const Ref<CursorAreaEventListenersLayer>& layer)
     {
+        // Listeners drawn into nested layer can't be registered again from cached drawing
+        o2Render.BreakDrawCapture();
+
         if (layer)
         {
             layer->mParentLayer = mInstance->mCurrentCursorAreaEventsLayer;
@@ -304,6 +309,37 @@ namespace o2
         mInstance->mCurrentCursorAreaEventsLayer->cursorEventAreaListeners.Add(listener);
     }
 
+    int EventSystem::GetDrawnCursorAreaListenersCount()
+    {
+        if (!IsSingletonInitialzed())
+            return 0;
+
+        return mInstance->mCurrentCursorAreaEventsLayer->cursorEventAreaListeners.Count();
+    }
+
+    void EventSystem::GetDrawnCursorAreaListeners(int begin, Vector<WeakRef<CursorAreaEventsListener>>& listeners)
+    {
+        if (!IsSingletonInitialzed())
+            return;
+
+        auto& drawnListeners = mInstance->mCurrentCursorAreaEventsLayer->cursorEventAreaListeners;
+        for (int i = begin; i < drawnListeners.Count(); i++)
+            listeners.Add(drawnListeners[i]);
+    }
+
+    void EventSystem::RedrawCursorAreaListeners(const Vector<WeakRef<CursorAreaEventsListener>>& listeners)
+    {
+        if (!IsSingletonInitialzed())
+            return;
+
+        for (auto& listenerRef : listeners)
+        {
+            auto listener = listenerRef.Lock();
+            if (listener && listener->IsInteractable() && listener->IsListeningEvents())
+                mInstance->mCurrentCursorAreaEventsLayer->cursorEventAreaListeners.Add(listener);
+        }
+    }
+
     void EventSystem::UnregCursorAreaListener(CursorAreaEventsListener* listener)
     {
         auto listenerLayer = dynamic_cast<CursorAreaEventListenersLayer*>(listener);
@@ -34,8 +34,8 @@ namespace o2
         // Destructor
         ~EventSystem();
 
-        // Returns all cursor listeners under cursor arranged by depth
-        Vector<Ref<CursorAreaEventsListener>> GetAllCursorListenersUnderCursor(CursorId cursorId) const;
+        // Returns all cursor listeners under cursor arranged by depth. Result is valid only in current frame
+        FrameVector<Ref<CursorAreaEventsListener>> GetAllCursorListenersUnderCursor(CursorId cursorId) const;
 
         // Breaks cursor event. All pressed listeners will be unpressed with specific event OnPressBreak
         void BreakCursorEvent();
@@ -103,6 +103,16 @@ namespace o2
         // Registering cursor area events listener
         static void DrawnCursorAreaListener(const Ref<CursorAreaEventsListener>& listener);
 
+        // Returns count of drawn cursor area listeners in current layer
+        static int GetDrawnCursorAreaListenersCount();
+
+        // Copies drawn cursor area listeners of current layer, starting from index
+        static void GetDrawnCursorAreaListeners(int begin, Vector<WeakRef<CursorAreaEventsListener>>& listeners);
+
+        // Registers listeners drawn earlier again. Used when drawing is replayed from cache, so listeners keep their
+        // scissor rects from previous drawing
+        static void RedrawCursorAreaListeners(const Vector<WeakRef<CursorAreaEventsListener>>& listeners);
+
         // Unregistering cursor area events listener
         static void UnregCursorAreaListener(CursorAreaEventsListener* listener);
 
@@ -137,6 +147,7 @@ namespace o2
         friend class CursorEventsListener;
         friend class DragableObject;
         friend class KeyboardEventsListener;
+        friend class Widget;
         friend class WndProcFunc;
     };
 }
@@ -2,10 +2,13 @@
 #include "PhysicsWorld.h"
 
 #include "Box2D/Dynamics/b2Body.h"
+#include "Box2D/Dynamics/Contacts/b2Contact.h"
+#include "Box2D/Dynamics/Joints/b2Joint.h"
 #include "o2/Config/ProjectConfig.h"
 #include "o2/Scene/Physics/ICollider.h"
 #include "o2/Scene/Physics/RigidBody.h"
 #include "o2/Render/Render.h"
+#include "o2/Utils/System/Time/Timer.h"
 
 namespace o2
 {
@@ -21,47 +24,205 @@ namespace o2
         mPrevPhysicsScale = o2Config.physics.scale;
     }
 
+    PhysicsWorld::~PhysicsWorld()
+    {
+        if (!mStepThread.joinable())
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(mStepMutex);
+            mStopStepThread = true;
+        }
+
+        mStepRequestedCondition.notify_one();
+        mStepThread.join();
+    }
+
     void PhysicsWorld::PreUpdate()
     {
+        Timer timer;
+
         CheckPhysicsScale();
 
         mIsUpdatingPhysicsNow = true;
 
         mWorld.SetGravity(o2Config.physics.gravity);
 
-        float invScale = 1.0f/o2Config.physics.scale;
+        mStepStats = StepStats();
+        mStepStats.bodiesCount = mWorld.GetBodyCount();
 
+        // Body transform is updated only when actor has moved, because it's expensive for box2d: body's
+        // proxies are moved in broadphase and contacts are updated. Static bodies usually never move
+        float invScale = 1.0f/o2Config.physics.scale;
         for (b2Body* body = mWorld.GetBodyList(); body; body = body->GetNext())
         {
             auto rigidBody = (RigidBody*)body->GetUserData();
-            auto transform = rigidBody->transform;
+            auto transformData = rigidBody->transform->mData;
 
-            body->SetTransform(transform->GetWorldPosition()*invScale, transform->GetWorldAngle());
+            bool actorChanged = !rigidBody->mIsSynced ||
+                transformData->position != rigidBody->mSyncedPosition ||
+                transformData->angle != rigidBody->mSyncedAngle ||
+                !(transformData->parentTransform == rigidBody->mSyncedParentTransform);
+
+            if (actorChanged)
+                SyncBodyFromActor(rigidBody, invScale);
         }
+
+        mStepStats.preUpdateTime = timer.GetTime();
     }
 
     void PhysicsWorld::Update(float dt)
     {
+        Timer timer;
+
         mWorld.Step(dt, o2Config.physics.velocityIterations, o2Config.physics.positionIterations);
+
+        mStepStats.stepTime = timer.GetTime();
+        mStepStats.contactsCount = mWorld.GetContactCount();
+
+        for (b2Contact* contact = mWorld.GetContactList(); contact; contact = contact->GetNext())
+        {
+            if (contact->IsTouching())
+                mStepStats.touchingContactsCount++;
+        }
+
+        mStepStats.awakeIslandsCount = CountAwakeIslands();
     }
 
     void PhysicsWorld::PostUpdate()
     {
+        Timer timer;
+
+        // Only moving bodies are synchronized back. Position and angle are written together, so actor is marked
+        // dirty once and its hierarchy is updated once. Body that has just fallen asleep is synchronized last time
         float scale = o2Config.physics.scale;
         for (b2Body* body = mWorld.GetBodyList(); body; body = body->GetNext())
         {
+            if (body->GetType() == b2_staticBody)
+                continue;
+
             auto rigidBody = (RigidBody*)body->GetUserData();
-            auto transform = rigidBody->transform;
 
-            transform->SetWorldPosition(Vec2F(body->GetPosition())*scale);
-            transform->SetWorldAngle(body->GetAngle());
+            bool isAwake = body->IsAwake();
+            if (!isAwake && !rigidBody->mWasAwake)
+                continue;
+
+            rigidBody->mWasAwake = isAwake;
+
+            if (isAwake)
+                mStepStats.awakeBodiesCount++;
+
+            SyncActorFromBody(rigidBody, Vec2F(body->GetPosition())*scale, body->GetAngle());
+        }
+
+        mIsUpdatingPhysicsNow = false;
+
+        mStepStats.postUpdateTime = timer.GetTime();
+    }
+
+    void PhysicsWorld::BeginThreadedStep(float dt, int stepsCount)
+    {
+        WaitThreadedStep();
+
+        if (stepsCount == 0)
+            return;
+
+        // Bodies are synchronized from actors on main thread, while nobody touches world
+        PreUpdate();
+        mIsUpdatingPhysicsNow = false;
+
+        if (!mStepThread.joinable())
+            mStepThread = std::thread(&PhysicsWorld::StepThreadLoop, this);
+
+        {
+            std::lock_guard<std::mutex> lock(mStepMutex);
+
+            mStepStatesIndex++;
+            mRequestedStepDT = dt;
+            mRequestedStepsCount = stepsCount;
+            mStepRequested = true;
+            mIsThreadedStepping = true;
+        }
+
+        mStepRequestedCondition.notify_one();
+    }
+
+    void PhysicsWorld::WaitThreadedStep()
+    {
+        if (!mIsThreadedStepping)
+            return;
+
+        std::unique_lock<std::mutex> lock(mStepMutex);
+        mStepFinishedCondition.wait(lock, [&]() { return !mStepRequested; });
+        mIsThreadedStepping = false;
+    }
+
+    bool PhysicsWorld::IsThreadedStepping() const
+    {
+        return mIsThreadedStepping;
+    }
+
+    void PhysicsWorld::PresentInterpolated(float alpha)
+    {
+        WaitThreadedStep();
+
+        if (mStepStatesIndex == 0)
+            return;
+
+        Timer timer;
+
+        mIsUpdatingPhysicsNow = true;
+
+        mStepStats.awakeBodiesCount = 0;
+        mStepStats.actorsSyncedFromBodies = 0;
+
+        // Body that has fallen asleep is placed at its final state last time, and then skipped like in PostUpdate
+        alpha = Math::Clamp01(alpha);
+        for (b2Body* body = mWorld.GetBodyList(); body; body = body->GetNext())
+        {
+            if (body->GetType() == b2_staticBody)
+                continue;
+
+            auto rigidBody = (RigidBody*)body->GetUserData();
+            if (rigidBody->mStepStatesIndex != mStepStatesIndex)
+                continue;
+
+            // Actor moved after last synchronization keeps its transform, body is updated from it at next step
+            auto transformData = rigidBody->transform->mData;
+            bool actorChanged = !rigidBody->mIsSynced ||
+                transformData->position != rigidBody->mSyncedPosition ||
+                transformData->angle != rigidBody->mSyncedAngle ||
+                !(transformData->parentTransform == rigidBody->mSyncedParentTransform);
+
+            if (actorChanged)
+                continue;
+
+            bool isAwake = body->IsAwake();
+            if (!isAwake && !rigidBody->mWasAwake)
+                continue;
+
+            rigidBody->mWasAwake = isAwake;
+
+            if (isAwake)
+            {
+                mStepStats.awakeBodiesCount++;
+
+                SyncActorFromBody(rigidBody,
+                                  Math::Lerp(rigidBody->mPrevStepPosition, rigidBody->mStepPosition, alpha),
+                                  Math::Lerp(rigidBody->mPrevStepAngle, rigidBody->mStepAngle, alpha));
+            }
+            else
+                SyncActorFromBody(rigidBody, rigidBody->mStepPosition, rigidBody->mStepAngle);
         }
 
         mIsUpdatingPhysicsNow = false;
+
+        mStepStats.postUpdateTime = timer.GetTime();
     }
 
     void PhysicsWorld::DrawDebug()
     {
+        WaitThreadedStep();
         mWorld.DrawDebugData();
     }
 
@@ -70,6 +231,157 @@ namespace o2
         return mIsUpdatingPhysicsNow;
     }
 
+    const PhysicsWorld::StepStats& PhysicsWorld::GetLastStepStats() const
+    {
+        return mStepStats;
+    }
+
+    void PhysicsWorld::SyncBodyFromActor(RigidBody* rigidBody, float invScale)
+    {
+        auto transformData = rigidBody->transform->mData;
+
+        Vec2F worldPosition = transformData->position*transformData->parentTransform;
+        float worldAngle = transformData->angle + transformData->parentTransform.GetAngle();
+        rigidBody->mBody->SetTransform(worldPosition*invScale, worldAngle);
+
+        rigidBody->mSyncedPosition = transformData->position;
+        rigidBody->mSyncedAngle = transformData->angle;
+        rigidBody->mSyncedParentTransform = transformData->parentTransform;
+        rigidBody->mIsSynced = true;
+
+        mStepStats.bodiesSyncedFromActors++;
+    }
+
+    void PhysicsWorld::SyncActorFromBody(RigidBody* rigidBody, const Vec2F& worldPosition, float worldAngle)
+    {
+        auto transform = rigidBody->transform;
+        auto transformData = transform->mData;
+
+        transform->CheckParentInvTransform();
+        transformData->position = worldPosition*transformData->parentInvertedTransform;
+        transformData->angle = worldAngle - transformData->parentTransform.GetAngle();
+        transform->SetDirty();
+
+        rigidBody->mSyncedPosition = transformData->position;
+        rigidBody->mSyncedAngle = transformData->angle;
+        rigidBody->mSyncedParentTransform = transformData->parentTransform;
+        rigidBody->mIsSynced = true;
+
+        mStepStats.actorsSyncedFromBodies++;
+    }
+
+    int PhysicsWorld::CountAwakeIslands()
+    {
+        // Same traversal as box2d islands building: static bodies don't connect islands
+        int markStepIndex = ++mIslandsMarkIndex;
+
+        int islandsCount = 0;
+        for (b2Body* seed = mWorld.GetBodyList(); seed; seed = seed->GetNext())
+        {
+            auto seedRigidBody = (RigidBody*)seed->GetUserData();
+            if (seedRigidBody->mIslandMarkStep == markStepIndex || !seed->IsAwake() || !seed->IsActive() ||
+                seed->GetType() == b2_staticBody)
+            {
+                continue;
+            }
+
+            islandsCount++;
+
+            seedRigidBody->mIslandMarkStep = markStepIndex;
+            mIslandsStack.Clear();
+            mIslandsStack.Add(seed);
+
+            while (!mIslandsStack.IsEmpty())
+            {
+                b2Body* body = mIslandsStack.PopBack();
+                if (body->GetType() == b2_staticBody)
+                    continue;
+
+                auto markOther = [&](b2Body* other)
+                {
+                    auto otherRigidBody = (RigidBody*)other->GetUserData();
+                    if (otherRigidBody->mIslandMarkStep == markStepIndex)
+                        return;
+
+                    otherRigidBody->mIslandMarkStep = markStepIndex;
+                    mIslandsStack.Add(other);
+                };
+
+                for (b2ContactEdge* edge = body->GetContactList(); edge; edge = edge->next)
+                {
+                    if (edge->contact->IsTouching() && edge->contact->IsEnabled())
+                        markOther(edge->other);
+                }
+
+                for (b2JointEdge* edge = body->GetJointList(); edge; edge = edge->next)
+                    markOther(edge->other);
+            }
+        }
+
+        return islandsCount;
+    }
+
+    void PhysicsWorld::StepAndCaptureStates(float dt, int stepsCount)
+    {
+        for (int i = 0; i < stepsCount; i++)
+        {
+            if (i == stepsCount - 1)
+                CaptureBodiesStates(true);
+
+            Update(dt);
+        }
+
+        CaptureBodiesStates(false);
+    }
+
+    void PhysicsWorld::CaptureBodiesStates(bool previous)
+    {
+        float scale = o2Config.physics.scale;
+        for (b2Body* body = mWorld.GetBodyList(); body; body = body->GetNext())
+        {
+            if (body->GetType() == b2_staticBody)
+                continue;
+
+            auto rigidBody = (RigidBody*)body->GetUserData();
+            Vec2F position = Vec2F(body->GetPosition())*scale;
+            float angle = body->GetAngle();
+
+            if (previous)
+            {
+                rigidBody->mPrevStepPosition = position;
+                rigidBody->mPrevStepAngle = angle;
+            }
+            else
+            {
+                rigidBody->mStepPosition = position;
+                rigidBody->mStepAngle = angle;
+                rigidBody->mStepStatesIndex = mStepStatesIndex;
+            }
+        }
+    }
+
+    void PhysicsWorld::StepThreadLoop()
+    {
+        std::unique_lock<std::mutex> lock(mStepMutex);
+        while (true)
+        {
+            mStepRequestedCondition.wait(lock, [&]() { return mStepRequested || mStopStepThread; });
+
+            if (mStopStepThread)
+                break;
+
+            float dt = mRequestedStepDT;
+            int stepsCount = mRequestedStepsCount;
+
+            lock.unlock();
+            StepAndCaptureStates(dt, stepsCount);
+            lock.lock();
+
+            mStepRequested = false;
+            mStepFinishedCondition.notify_all();
+        }
+    }
+
     void PhysicsWorld::CheckPhysicsScale()
     {
         if (Math::Equals(mPrevPhysicsScale, o2Config.physics.scale))
@@ -80,9 +392,7 @@ namespace o2
         for (b2Body* body = mWorld.GetBodyList(); body; body = body->GetNext())
         {
             auto rigidBody = (RigidBody*)body->GetUserData();
-            auto transform = rigidBody->transform;
-
-            body->SetTransform(transform->GetWorldPosition()*invScale, transform->GetWorldAngle());
+            SyncBodyFromActor(rigidBody, invScale);
 
             auto colliders = rigidBody->mColliders;
             for (auto& collider : colliders)
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include "Box2D/Common/b2Draw.h"
 #include "Box2D/Dynamics/b2World.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/Ref.h"
 
 // Render physics macros
@@ -10,15 +15,39 @@
 
 namespace o2
 {
+    class RigidBody;
+
     // -------------------
     // Box2D Physics world
     // -------------------
     class PhysicsWorld : public Singleton<PhysicsWorld>
     {
+    public:
+        // ------------------------------
+        // Statistics of last physics step
+        // ------------------------------
+        struct StepStats
+        {
+            int bodiesCount = 0;            // Total count of bodies
+            int awakeBodiesCount = 0;       // Count of awake dynamic and kinematic bodies
+            int contactsCount = 0;          // Total count of contacts, including not touching
+            int touchingContactsCount = 0;  // Count of touching contacts
+            int awakeIslandsCount = 0;      // Count of awake islands, connected by touching contacts and joints
+            int bodiesSyncedFromActors = 0; // Count of bodies, updated from changed actors transforms
+            int actorsSyncedFromBodies = 0; // Count of actors transforms, updated from moved bodies
+
+            float preUpdateTime = 0.0f;  // Time of synchronizing bodies with actors, in seconds
+            float stepTime = 0.0f;       // Time of physics step, in seconds
+            float postUpdateTime = 0.0f; // Time of synchronizing actors with bodies, in seconds
+        };
+
     public:
         // Default constructor
         PhysicsWorld(RefCounter* refCounter);
 
+        // Destructor. Stops stepping thread
+        ~PhysicsWorld();
+
         // Synchronize physics bodies with actors
         void PreUpdate();
 
@@ -28,12 +57,28 @@ namespace o2
         // Synchronize actors with bodies
         void PostUpdate();
 
+        // Synchronizes bodies with actors and starts stepping world on worker thread. Bodies states before and
+        // after last step are captured for interpolation. Waits previous threaded step before
+        void BeginThreadedStep(float dt, int stepsCount);
+
+        // Waits until threaded step is finished. Must be called before accessing bodies from main thread
+        void WaitThreadedStep();
+
+        // Returns is world stepping on worker thread now
+        bool IsThreadedStepping() const;
+
+        // Sets actors transforms interpolated between bodies states of last threaded step. Waits threaded step before
+        void PresentInterpolated(float alpha);
+
         // Draws debug graphics
         void DrawDebug();
 
         // Returns True when PreUpdate has just called, until PostUpdate finished
         bool IsUpdatingPhysicsNow() const;
 
+        // Returns statistics of last physics step. With threaded stepping it's valid after WaitThreadedStep()
+        const StepStats& GetLastStepStats() const;
+
     private:
         b2World mWorld;
 
@@ -41,10 +86,44 @@ namespace o2
 
         float mPrevPhysicsScale = 0.0f; // Previous physics scale
 
+        StepStats mStepStats; // Statistics of last physics step
+
+        Vector<b2Body*> mIslandsStack;          // Bodies stack buffer for counting awake islands
+        int             mIslandsMarkIndex = 0; // Index of bodies marking while counting awake islands
+
+        std::thread             mStepThread;                 // Worker thread for threaded stepping, started on first step
+        std::mutex              mStepMutex;                  // Guards step request and finish
+        std::condition_variable mStepRequestedCondition;     // Wakes stepping thread
+        std::condition_variable mStepFinishedCondition;      // Notifies of step finished
+        bool                    mStepRequested = false;      // Is step requested and not finished yet, guarded by step mutex
+        bool                    mStopStepThread = false;     // Is stepping thread stopping, guarded by step mutex
+        std::atomic<bool>       mIsThreadedStepping = false; // Is threaded step started and not waited yet
+        float                   mRequestedStepDT = 0.0f;     // Delta time of requested step
+        int                     mRequestedStepsCount = 0;    // Count of requested steps
+        int                     mStepStatesIndex = 0;        // Index of last threaded step, bodies states are stamped with it
+
     private:
         // Checks phsyics scale config; updates bodies and colliders with new scale
         void CheckPhysicsScale();
 
+        // Sets body transform from actor's transform, remembers synchronized transform
+        void SyncBodyFromActor(RigidBody* rigidBody, float invScale);
+
+        // Sets actor's transform from body's world position and angle, remembers synchronized transform
+        void SyncActorFromBody(RigidBody* rigidBody, const Vec2F& worldPosition, float worldAngle);
+
+        // Counts awake islands: groups of awake bodies connected by touching contacts and joints
+        int CountAwakeIslands();
+
+        // Steps world requested count of times, captures bodies states before and after last step
+        void StepAndCaptureStates(float dt, int stepsCount);
+
+        // Captures world positions and angles of not static bodies; previous or current states
+        void CaptureBodiesStates(bool previous);
+
+        // Stepping thread loop
+        void StepThreadLoop();
+
         friend class RigidBody;
     }; 
     
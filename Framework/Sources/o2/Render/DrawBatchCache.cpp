@@ -0,0 +1,159 @@
+#include "o2/stdafx.h"
+#include "DrawBatchCache.h"
+
+#include "o2/Render/RectDrawable.h"
+
+namespace o2
+{
+    void DrawBatchCache::Clear()
+    {
+        mVertices.Clear();
+        mIndexes.Clear();
+        mBatches.Clear();
+        mCommands.Clear();
+        mDependencies.Clear();
+        mDrawingDepth = 0.0f;
+    }
+
+    void DrawBatchCache::Add(PrimitiveType primitiveType, const Vertex* vertices, UInt verticesCount,
+                             const VertexIndex* indexes, UInt elementsCount, const TextureRef& texture,
+                             BlendMode blendMode, UInt maxVertices, UInt maxIndexes, float drawingDepth,
+                             UInt buffersCount /*= 1*/)
+    {
+        UInt indexesCount = primitiveType == PrimitiveType::Line ? elementsCount*2 : elementsCount*3;
+
+        bool newBatch = mCommands.IsEmpty() || mCommands.Last().type != CommandType::DrawBatch;
+        if (!newBatch)
+        {
+            auto& last = mBatches.Last();
+            newBatch = last.texture != texture ||
+                last.blendMode != blendMode ||
+                last.primitiveType != primitiveType ||
+                last.verticesCount + verticesCount >= maxVertices ||
+                last.indexesCount + indexesCount >= maxIndexes;
+        }
+
+        if (newBatch)
+        {
+            Batch batch;
+            batch.texture = texture;
+            batch.blendMode = blendMode;
+            batch.primitiveType = primitiveType;
+            batch.verticesOffset = (UInt)mVertices.Count();
+            batch.indexesOffset = (UInt)mIndexes.Count();
+            mBatches.Add(batch);
+
+            Command command;
+            command.type = CommandType::DrawBatch;
+            command.batchIdx = mBatches.Count() - 1;
+            command.drawingDepth = drawingDepth - (float)buffersCount;
+            mCommands.Add(command);
+        }
+
+        auto& batch = mBatches.Last();
+
+        mVertices.insert(mVertices.end(), vertices, vertices + verticesCount);
+
+        mIndexes.reserve(mIndexes.size() + indexesCount);
+        for (UInt i = 0; i < indexesCount; i++)
+            mIndexes.push_back(indexes[i] + batch.verticesCount);
+
+        batch.verticesCount += verticesCount;
+        batch.indexesCount += indexesCount;
+        batch.elementsCount += elementsCount;
+        batch.buffersCount += buffersCount;
+    }
+
+    void DrawBatchCache::AddCommand(CommandType type, float drawingDepth, const RectI& scissorRect /*= RectI()*/)
+    {
+        Command command;
+        command.type = type;
+        command.scissorRect = scissorRect;
+        command.drawingDepth = drawingDepth;
+        mCommands.Add(command);
+    }
+
+    void DrawBatchCache::AddDependency(const Ref<IRectDrawable>& drawable)
+    {
+        if (!drawable)
+            return;
+
+        Dependency dependency;
+        dependency.drawable = drawable;
+        dependency.drawingVersion = drawable->GetDrawingVersion();
+        mDependencies.Add(dependency);
+    }
+
+    void DrawBatchCache::AddDependencies(const DrawBatchCache& other)
+    {
+        mDependencies.Add(other.mDependencies);
+    }
+
+    bool DrawBatchCache::IsActual() const
+    {
+        for (auto& dependency : mDependencies)
+        {
+            auto drawable = dependency.drawable.Lock();
+            if (!drawable || drawable->GetDrawingVersion() != dependency.drawingVersion)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool DrawBatchCache::IsEmpty() const
+    {
+        return mCommands.IsEmpty();
+    }
+
+    void DrawBatchCache::SetDrawingDepth(float depth)
+    {
+        mDrawingDepth = depth;
+    }
+
+    float DrawBatchCache::GetDrawingDepth() const
+    {
+        return mDrawingDepth;
+    }
+
+    const Vector<DrawBatchCache::Command>& DrawBatchCache::GetCommands() const
+    {
+        return mCommands;
+    }
+
+    const Vector<DrawBatchCache::Batch>& DrawBatchCache::GetBatches() const
+    {
+        return mBatches;
+    }
+
+    Vertex* DrawBatchCache::GetVertices(const Batch& batch)
+    {
+        return mVertices.Data() + batch.verticesOffset;
+    }
+
+    VertexIndex* DrawBatchCache::GetIndexes(const Batch& batch)
+    {
+        return mIndexes.Data() + batch.indexesOffset;
+    }
+
+    size_t DrawBatchCache::GetMemorySize() const
+    {
+        return mVertices.capacity()*sizeof(Vertex) + mIndexes.capacity()*sizeof(VertexIndex) +
+            mBatches.capacity()*sizeof(Batch) + mCommands.capacity()*sizeof(Command) +
+            mDependencies.capacity()*sizeof(Dependency);
+    }
+}
+// --- META ---
+
+ENUM_META(o2::DrawBatchCache::CommandType)
+{
+    ENUM_ENTRY(BeginRenderToStencilBuffer);
+    ENUM_ENTRY(DisableScissorTest);
+    ENUM_ENTRY(DisableStencilTest);
+    ENUM_ENTRY(DrawBatch);
+    ENUM_ENTRY(EnableScissorTest);
+    ENUM_ENTRY(EnableStencilTest);
+    ENUM_ENTRY(EndRenderToStencilBuffer);
+}
+END_ENUM_META;
+// --- END META ---
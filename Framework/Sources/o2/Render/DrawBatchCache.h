@@ -0,0 +1,129 @@
+#pragma once
+
+#include "o2/Render/TextureRef.h"
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vertex.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/Ref.h"
+
+namespace o2
+{
+    class IRectDrawable;
+
+    // ---------------------------------------------------------------------------------------
+    // Cached stream of drawing buffers. Collects vertices and indexes passed into render and
+    // merges neighbouring buffers with same texture, blend mode and primitive type into one
+    // batch. Scissor and stencil changes are stored as commands between batches. Drawing
+    // order is kept, so replaying gives the same picture with fewer DIPs.
+    // Cache is actual while drawing versions of drawables it depends on are not changed
+    // ---------------------------------------------------------------------------------------
+    class DrawBatchCache: public RefCounterable
+    {
+    public:
+        // -------------------
+        // Cached command type
+        // -------------------
+        enum class CommandType
+        {
+            DrawBatch, EnableScissorTest, DisableScissorTest, BeginRenderToStencilBuffer, EndRenderToStencilBuffer,
+            EnableStencilTest, DisableStencilTest
+        };
+
+        // -------------------------------------------
+        // Batch of buffers with same drawing settings
+        // -------------------------------------------
+        struct Batch
+        {
+            TextureRef    texture;                                // Batch texture
+            BlendMode     blendMode = BlendMode::Normal;          // Batch blend mode
+            PrimitiveType primitiveType = PrimitiveType::Polygon; // Batch primitives type
+
+            UInt verticesOffset = 0; // First vertex index in cache vertices
+            UInt verticesCount = 0;  // Vertices count
+            UInt indexesOffset = 0;  // First index in cache indexes
+            UInt indexesCount = 0;   // Indexes count
+            UInt elementsCount = 0;  // Primitives count
+            UInt buffersCount = 0;   // Count of merged buffers. Drawing depth is increased by it
+        };
+
+        // ----------------------------------------------------------------------------
+        // Cached command: batch drawing or render state change, replayed in same order
+        // ----------------------------------------------------------------------------
+        struct Command
+        {
+            CommandType type = CommandType::DrawBatch; // Command type
+            int         batchIdx = -1;                 // Batch index for DrawBatch command
+            RectI       scissorRect;                   // Scissor rect for EnableScissorTest command, in world space
+            float       drawingDepth = 0.0f;           // Drawing depth before command, relative to capture beginning
+        };
+
+        // --------------------------------------------------------------
+        // Drawable which buffers were captured, with its drawing version
+        // --------------------------------------------------------------
+        struct Dependency
+        {
+            WeakRef<IRectDrawable> drawable;           // Captured drawable
+            UInt                   drawingVersion = 0; // Drawing version of drawable at capture
+        };
+
+    public:
+        // Removes all cached data
+        void Clear();
+
+        // Adds buffer into cache. Indexes are remapped relative to batch. Starts new batch when drawing settings are
+        // different, there is a command after last batch or batch becomes bigger than max vertices or indexes count.
+        // Drawing depth is relative to capture beginning, after drawing buffer. Buffer can be a batch of few buffers
+        void Add(PrimitiveType primitiveType, const Vertex* vertices, UInt verticesCount, const VertexIndex* indexes,
+                 UInt elementsCount, const TextureRef& texture, BlendMode blendMode, UInt maxVertices, UInt maxIndexes,
+                 float drawingDepth, UInt buffersCount = 1);
+
+        // Adds render state change command. Drawing depth is relative to capture beginning
+        void AddCommand(CommandType type, float drawingDepth, const RectI& scissorRect = RectI());
+
+        // Adds drawable into dependencies with its current drawing version
+        void AddDependency(const Ref<IRectDrawable>& drawable);
+
+        // Adds dependencies of other cache, used when other cache is replayed during capturing
+        void AddDependencies(const DrawBatchCache& other);
+
+        // Returns true when all dependencies are alive and their drawing versions are not changed
+        bool IsActual() const;
+
+        // Returns is cache empty
+        bool IsEmpty() const;
+
+        // Sets drawing depth increase of whole cached drawing
+        void SetDrawingDepth(float depth);
+
+        // Returns drawing depth increase of whole cached drawing
+        float GetDrawingDepth() const;
+
+        // Returns cached commands
+        const Vector<Command>& GetCommands() const;
+
+        // Returns cached batches
+        const Vector<Batch>& GetBatches() const;
+
+        // Returns batch vertices
+        Vertex* GetVertices(const Batch& batch);
+
+        // Returns batch indexes
+        VertexIndex* GetIndexes(const Batch& batch);
+
+        // Returns memory size used by cache
+        size_t GetMemorySize() const;
+
+    protected:
+        Vector<Vertex>      mVertices;            // Cached vertices of all batches
+        Vector<VertexIndex> mIndexes;             // Cached indexes of all batches, relative to batch first vertex
+        Vector<Batch>       mBatches;             // Batches in drawing order
+        Vector<Command>     mCommands;            // Batches drawing and render state commands in drawing order
+        Vector<Dependency>  mDependencies;        // Drawables which buffers were captured
+        float               mDrawingDepth = 0.0f; // Drawing depth increase of whole cached drawing
+    };
+}
+// --- META ---
+
+PRE_ENUM_META(o2::DrawBatchCache::CommandType);
+// --- END META ---
@@ -2,9 +2,31 @@
 #include "ParticlesEffects.h"
 
 #include "o2/Render/Particles/ParticlesEmitter.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 
 namespace o2
 {
+    // Fills particles lifetime coefficients, used as curves positions
+    static void GetParticlesLifetimeCoefs(const Vector<Particle>& particles, FrameVector<float>& coefs)
+    {
+        int count = particles.Count();
+        coefs.resize(count);
+
+        for (int i = 0; i < count; i++)
+            coefs[i] = 1.0f - particles[i].timeLeft/particles[i].lifetime;
+    }
+
+    // Allowed difference of curves lookup tables from keys evaluation, relative to curve values range
+    static constexpr float curveLookupTableMaxError = 0.002f;
+
+    // Bakes curve lookup table if it isn't baked. Curves are evaluated for all particles each frame. Table is used
+    // only while it repeats keys accurately, so steps aren't smoothed. Table baked by user is kept with its settings
+    static void CheckCurveLookupTable(const Ref<Curve>& curve)
+    {
+        if (!curve->IsLookupTableBaked())
+            curve->BakeLookupTable(256, curveLookupTableMaxError);
+    }
+
     void ParticlesEffect::Update(float dt, ParticlesEmitter* emitter)
     {}
 
@@ -37,36 +59,19 @@ namespace o2
         colorGradient->onKeysChanged += [this]() { OnChanged(); };
     }
 
-    void ParticlesColorEffect::OnParticleEmitted(Particle& particle)
-    {
-        int particleIndex = particle.index;
-
-        CheckDataBufferSize(particleIndex);
-
-        mColorData[particleIndex].cacheKey = 0;
-    }
-
     void ParticlesColorEffect::Update(float dt, ParticlesEmitter* emitter)
     {
         auto& particles = GetParticlesDirect(emitter);
+        int count = particles.Count();
 
-        CheckDataBufferSize(particles.Count());
+        FrameVector<float> lifeTimeCoefs;
+        GetParticlesLifetimeCoefs(particles, lifeTimeCoefs);
 
-        for (auto& p : particles)
-        {
-            int particleIndex = p.index;
+        FrameVector<Color4> colors(count);
+        colorGradient->EvaluateBatch(lifeTimeCoefs.data(), colors.data(), count);
 
-            auto& colorData = mColorData[particleIndex];
-            float lifeTimeCoef = 1.0f - p.timeLeft / p.lifetime;
-            //o2Debug.Log("lifeTimeCoef: %f (%f, %f), particle id: %i", lifeTimeCoef, p.timeLeft, p.lifetime, particleIndex);
-            p.color = colorGradient->Evaluate(lifeTimeCoef, true, colorData.cacheKey);
-        }
-    }
-
-    void ParticlesColorEffect::CheckDataBufferSize(int particlesCount)
-    {
-        for (int i = mColorData.size(); i <= particlesCount; i++)
-            mColorData.Add(ParticleColorData());
+        for (int i = 0; i < count; i++)
+            particles[i].color = colors[i];
     }
 
     void ParticlesColorEffect::OnDeserialized(const DataValue& node)
@@ -101,28 +106,26 @@ namespace o2
 
         CheckDataBufferSize(particleIndex);
 
-        auto& colorData = mColorData[particleIndex];
-        colorData.cacheKeyA = 0;
-        colorData.cacheKeyB = 0;
-        colorData.coef = Math::Random(0.0f, 1.0f);
+        mColorData[particleIndex].coef = Math::Random(0.0f, 1.0f);
     }
 
     void ParticlesRandomColorEffect::Update(float dt, ParticlesEmitter* emitter)
     {
         auto& particles = GetParticlesDirect(emitter);
 
-        CheckDataBufferSize(particles.Count());
+        int count = particles.Count();
 
-        for (auto& p : particles)
-        {
-            int particleIndex = p.index;
+        CheckDataBufferSize(count);
 
-            auto& colorData = mColorData[particleIndex];
-            auto lifeTimeCoef = 1.0f - p.timeLeft / p.lifetime;
-            auto colorA = colorGradientA->Evaluate(lifeTimeCoef, true, colorData.cacheKeyA);
-            auto colorB = colorGradientB->Evaluate(lifeTimeCoef, true, colorData.cacheKeyB);
-            p.color = Math::Lerp(colorA, colorB, colorData.coef);
-        }
+        FrameVector<float> lifeTimeCoefs;
+        GetParticlesLifetimeCoefs(particles, lifeTimeCoefs);
+
+        FrameVector<Color4> colorsA(count), colorsB(count);
+        colorGradientA->EvaluateBatch(lifeTimeCoefs.data(), colorsA.data(), count);
+        colorGradientB->EvaluateBatch(lifeTimeCoefs.data(), colorsB.data(), count);
+
+        for (int i = 0; i < count; i++)
+            particles[i].color = Math::Lerp(colorsA[i], colorsB[i], mColorData[particles[i].index].coef);
     }
 
     ParticlesSizeEffect::ParticlesSizeEffect()
@@ -138,8 +141,6 @@ namespace o2
         CheckDataBufferSize(particleIndex);
 
         mData[particleIndex].initialSize = particle.size;
-        mData[particleIndex].cacheKey = 0;
-        mData[particleIndex].cacheKeyApprox = 0;
         mData[particleIndex].randomCoef = Math::Random(0.0f, 1.0f);
     }
 
@@ -147,15 +148,22 @@ namespace o2
     {
         auto& particles = GetParticlesDirect(emitter);
 
-        CheckDataBufferSize(particles.Count());
+        int count = particles.Count();
 
-        for (auto& p : particles)
-        {
-            int particleIndex = p.index;
+        CheckDataBufferSize(count);
+        CheckCurveLookupTable(curve);
 
-            auto& sizeData = mData[particleIndex];
-            p.size = sizeData.initialSize*curve->Evaluate(1.0f - p.timeLeft/p.lifetime, sizeData.randomCoef, true, sizeData.cacheKey, sizeData.cacheKeyApprox);
-        }
+        FrameVector<float> lifeTimeCoefs;
+        GetParticlesLifetimeCoefs(particles, lifeTimeCoefs);
+
+        FrameVector<float> randomCoefs(count), values(count);
+        for (int i = 0; i < count; i++)
+            randomCoefs[i] = mData[particles[i].index].randomCoef;
+
+        curve->EvaluateBatch(lifeTimeCoefs.data(), randomCoefs.data(), values.data(), count);
+
+        for (int i = 0; i < count; i++)
+            particles[i].size = mData[particles[i].index].initialSize*values[i];
     }
 
     void ParticlesSizeEffect::CheckDataBufferSize(int particlesCount)
@@ -182,8 +190,6 @@ namespace o2
         CheckDataBufferSize(particleIndex);
 
         mData[particleIndex].initialAngle = particle.angle;
-        mData[particleIndex].cacheKey = 0;
-        mData[particleIndex].cacheKeyApprox = 0;
         mData[particleIndex].randomCoef = Math::Random(0.0f, 1.0f);
     }
 
@@ -191,15 +197,22 @@ namespace o2
     {
         auto& particles = GetParticlesDirect(emitter);
 
-        CheckDataBufferSize(particles.Count());
+        int count = particles.Count();
 
-        for (auto& p : particles)
-        {
-            int particleIndex = p.index;
+        CheckDataBufferSize(count);
+        CheckCurveLookupTable(curve);
 
-            auto& data = mData[particleIndex];
-            p.angle = data.initialAngle + curve->Evaluate(1.0f - p.timeLeft/p.lifetime, data.randomCoef, true, data.cacheKey, data.cacheKeyApprox);
-        }
+        FrameVector<float> lifeTimeCoefs;
+        GetParticlesLifetimeCoefs(particles, lifeTimeCoefs);
+
+        FrameVector<float> randomCoefs(count), values(count);
+        for (int i = 0; i < count; i++)
+            randomCoefs[i] = mData[particles[i].index].randomCoef;
+
+        curve->EvaluateBatch(lifeTimeCoefs.data(), randomCoefs.data(), values.data(), count);
+
+        for (int i = 0; i < count; i++)
+            particles[i].angle = mData[particles[i].index].initialAngle + values[i];
     }
 
     void ParticlesAngleEffect::CheckDataBufferSize(int particlesCount)
@@ -226,8 +239,6 @@ namespace o2
         CheckDataBufferSize(particleIndex);
 
         mData[particleIndex].initialSpeed = particle.angleSpeed;
-        mData[particleIndex].cacheKey = 0;
-        mData[particleIndex].cacheKeyApprox = 0;
         mData[particleIndex].randomCoef = Math::Random(0.0f, 1.0f);
     }
 
@@ -235,15 +246,22 @@ namespace o2
     {
         auto& particles = GetParticlesDirect(emitter);
 
-        CheckDataBufferSize(particles.Count());
+        int count = particles.Count();
 
-        for (auto& p : particles)
-        {
-            int particleIndex = p.index;
+        CheckDataBufferSize(count);
+        CheckCurveLookupTable(curve);
 
-            auto& data = mData[particleIndex];
-            p.angleSpeed = data.initialSpeed + curve->Evaluate(1.0f - p.timeLeft/p.lifetime, data.randomCoef, true, data.cacheKey, data.cacheKeyApprox);
-        }
+        FrameVector<float> lifeTimeCoefs;
+        GetParticlesLifetimeCoefs(particles, lifeTimeCoefs);
+
+        FrameVector<float> randomCoefs(count), values(count);
+        for (int i = 0; i < count; i++)
+            randomCoefs[i] = mData[particles[i].index].randomCoef;
+
+        curve->EvaluateBatch(lifeTimeCoefs.data(), randomCoefs.data(), values.data(), count);
+
+        for (int i = 0; i < count; i++)
+            particles[i].angleSpeed = mData[particles[i].index].initialSpeed + values[i];
     }
 
     void ParticlesAngleSpeedEffect::CheckDataBufferSize(int particlesCount)
@@ -274,12 +292,7 @@ namespace o2
 
         mData[particleIndex].initialVelocity = particle.velocity;
 
-        mData[particleIndex].cacheXKey = 0;
-        mData[particleIndex].cacheXKeyApprox = 0;
         mData[particleIndex].randomXCoef = Math::Random(0.0f, 1.0f);
-
-        mData[particleIndex].cacheYKey = 0;
-        mData[particleIndex].cacheYKeyApprox = 0;
         mData[particleIndex].randomYCoef = Math::Random(0.0f, 1.0f);
     }
 
@@ -287,18 +300,28 @@ namespace o2
     {
         auto& particles = GetParticlesDirect(emitter);
 
-        CheckDataBufferSize(particles.Count());
+        int count = particles.Count();
 
-        for (auto& p : particles)
-        {
-            int particleIndex = p.index;
+        CheckDataBufferSize(count);
+        CheckCurveLookupTable(XCurve);
+        CheckCurveLookupTable(YCurve);
 
-            auto& data = mData[particleIndex];
-            float x = XCurve->Evaluate(1.0f - p.timeLeft/p.lifetime, data.randomXCoef, true, data.cacheXKey, data.cacheXKeyApprox);
-            float y = YCurve->Evaluate(1.0f - p.timeLeft/p.lifetime, data.randomYCoef, true, data.cacheYKey, data.cacheYKeyApprox);
+        FrameVector<float> lifeTimeCoefs;
+        GetParticlesLifetimeCoefs(particles, lifeTimeCoefs);
 
-            p.velocity = data.initialVelocity + Vec2F(x, y);
+        FrameVector<float> randomXCoefs(count), randomYCoefs(count), xValues(count), yValues(count);
+        for (int i = 0; i < count; i++)
+        {
+            auto& data = mData[particles[i].index];
+            randomXCoefs[i] = data.randomXCoef;
+            randomYCoefs[i] = data.randomYCoef;
         }
+
+        XCurve->EvaluateBatch(lifeTimeCoefs.data(), randomXCoefs.data(), xValues.data(), count);
+        YCurve->EvaluateBatch(lifeTimeCoefs.data(), randomYCoefs.data(), yValues.data(), count);
+
+        for (int i = 0; i < count; i++)
+            particles[i].velocity = mData[particles[i].index].initialVelocity + Vec2F(xValues[i], yValues[i]);
     }
 
     void ParticlesVelocityEffect::CheckDataBufferSize(int particlesCount)
@@ -330,8 +353,6 @@ namespace o2
 
         mData[particleIndex].initialPosition = particle.position;
 
-        mData[particleIndex].timeCacheKey = 0;
-        mData[particleIndex].timeCacheKeyApprox = 0;
         mData[particleIndex].timeRandomCoef = Math::Random(0.0f, 1.0f);
 
         mData[particleIndex].splineCacheKey = 0;
@@ -343,18 +364,28 @@ namespace o2
     {
         auto& particles = GetParticlesDirect(emitter);
 
-        CheckDataBufferSize(particles.Count());
+        int count = particles.Count();
+
+        CheckDataBufferSize(count);
+        CheckCurveLookupTable(timeCurve);
+
+        FrameVector<float> lifeTimeCoefs;
+        GetParticlesLifetimeCoefs(particles, lifeTimeCoefs);
+
+        FrameVector<float> timeRandomCoefs(count), times(count);
+        for (int i = 0; i < count; i++)
+            timeRandomCoefs[i] = mData[particles[i].index].timeRandomCoef;
+
+        timeCurve->EvaluateBatch(lifeTimeCoefs.data(), timeRandomCoefs.data(), times.data(), count);
 
         float splineLength = spline->Length();
 
-        for (auto& p : particles)
+        for (int i = 0; i < count; i++)
         {
-            int particleIndex = p.index;
-
-            auto& data = mData[particleIndex];
-            float t = timeCurve->Evaluate(1.0f - p.timeLeft/p.lifetime, data.timeRandomCoef, true, data.timeCacheKey, data.timeCacheKeyApprox);
+            auto& p = particles[i];
+            auto& data = mData[p.index];
 
-            p.position = data.initialPosition + spline->Evaluate(t*splineLength, data.splineRandomCoef, true, 
+            p.position = data.initialPosition + spline->Evaluate(times[i]*splineLength, data.splineRandomCoef, true,
                                                                  data.splineCacheKey, data.splineCacheKeyApprox);
         }
     }
@@ -80,9 +80,6 @@ namespace o2
     public:
         ParticlesColorEffect();
 
-        // Called when particle is emitted, used to initialize effect data
-        void OnParticleEmitted(Particle& particle) override;
-
         // Update particles color over time
         void Update(float dt, ParticlesEmitter* emitter) override;
 
@@ -90,22 +87,6 @@ namespace o2
         CLONEABLE_REF(ParticlesColorEffect);
 
     private:
-        struct ParticleColorData
-        {
-            int cacheKey = 0;
-
-            bool operator==(const ParticleColorData& other) const
-            {
-                return cacheKey == other.cacheKey;
-            }
-        };
-
-        Vector<ParticleColorData> mColorData; // Color data buffer
-
-    private:
-        // Check if color data buffer size is enough
-        void CheckDataBufferSize(int particlesCount);
-
         // Called when deserialization is done, used to subscribe to color gradient changes
         void OnDeserialized(const DataValue& node) override;
     };
@@ -135,14 +116,11 @@ namespace o2
     private:
         struct ParticleColorData
         {
-            int cacheKeyA = 0;
-            int cacheKeyB = 0;
-
             float coef = 0.0f;
 
             bool operator==(const ParticleColorData& other) const
             {
-                return cacheKeyA == other.cacheKeyA && cacheKeyB == other.cacheKeyB && coef == other.coef;
+                return coef == other.coef;
             }
         };
 
@@ -181,14 +159,11 @@ namespace o2
         {
             Vec2F initialSize;
 
-            int cacheKey = 0;
-            int cacheKeyApprox = 0;
-
             float randomCoef = 0.0f;
 
             bool operator==(const ParticleData& other) const
             {
-                return cacheKey == other.cacheKey;
+                return randomCoef == other.randomCoef;
             }
         };
 
@@ -227,14 +202,11 @@ namespace o2
         {
             float initialAngle = 0.0f;
 
-            int cacheKey = 0;
-            int cacheKeyApprox = 0;
-
             float randomCoef = 0.0f;
 
             bool operator==(const ParticleData& other) const
             {
-                return cacheKey == other.cacheKey;
+                return randomCoef == other.randomCoef;
             }
         };
 
@@ -273,14 +245,11 @@ namespace o2
         {
             float initialSpeed = 0.0f;
 
-            int cacheKey = 0;
-            int cacheKeyApprox = 0;
-
             float randomCoef = 0.0f;
 
             bool operator==(const ParticleData& other) const
             {
-                return cacheKey == other.cacheKey;
+                return randomCoef == other.randomCoef;
             }
         };
 
@@ -320,17 +289,12 @@ namespace o2
         {
             Vec2F initialVelocity;
 
-            int cacheXKey = 0;
-            int cacheXKeyApprox = 0;
             float randomXCoef = 0.0f;
-
-            int cacheYKey = 0;
-            int cacheYKeyApprox = 0;
             float randomYCoef = 0.0f;
 
             bool operator==(const ParticleData& other) const
             {
-                return cacheXKey == other.cacheXKey && cacheYKey == other.cacheYKey;
+                return randomXCoef == other.randomXCoef && randomYCoef == other.randomYCoef;
             }
         };
 
@@ -370,8 +334,6 @@ namespace o2
         {
             Vec2F initialPosition;
 
-            int timeCacheKey = 0;
-            int timeCacheKeyApprox = 0;
             float timeRandomCoef = 0.0f;
 
             int splineCacheKey = 0;
@@ -380,7 +342,7 @@ namespace o2
 
             bool operator==(const ParticleData& other) const
             {
-                return timeCacheKey == other.timeCacheKey && splineCacheKey == other.splineCacheKey;
+                return timeRandomCoef == other.timeRandomCoef && splineCacheKey == other.splineCacheKey;
             }
         };
 
@@ -447,16 +409,13 @@ END_META;
 CLASS_FIELDS_META(o2::ParticlesColorEffect)
 {
     FIELD().PUBLIC().SERIALIZABLE_ATTRIBUTE().NAME(colorGradient);
-    FIELD().PRIVATE().NAME(mColorData);
 }
 END_META;
 CLASS_METHODS_META(o2::ParticlesColorEffect)
 {
 
     FUNCTION().PUBLIC().CONSTRUCTOR();
-    FUNCTION().PUBLIC().SIGNATURE(void, OnParticleEmitted, Particle&);
     FUNCTION().PUBLIC().SIGNATURE(void, Update, float, ParticlesEmitter*);
-    FUNCTION().PRIVATE().SIGNATURE(void, CheckDataBufferSize, int);
     FUNCTION().PRIVATE().SIGNATURE(void, OnDeserialized, const DataValue&);
 }
 END_META;
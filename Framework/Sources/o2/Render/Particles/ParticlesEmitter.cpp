@@ -109,6 +109,8 @@ namespace o2
         if (!mEnabled)
             return;
 
+        mDrawingVersion++;
+
 #if IS_EDITOR
         mIsUpdating = true;
 
@@ -20,6 +20,7 @@ namespace o2
 
         mColor = other.mColor;
         mEnabled = other.mEnabled;
+        mDrawingVersion++;
 
         ColorChanged();
         EnableChanged();
@@ -40,6 +41,7 @@ namespace o2
     void IRectDrawable::SetColor(const Color4& color)
     {
         mColor = color;
+        mDrawingVersion++;
         ColorChanged();
     }
 
@@ -51,6 +53,7 @@ namespace o2
     void IRectDrawable::SetTransparency(float transparency)
     {
         mColor.SetAF(transparency);
+        mDrawingVersion++;
         ColorChanged();
     }
 
@@ -62,6 +65,7 @@ namespace o2
     void IRectDrawable::SetBlendMode(BlendMode blendMode)
     {
         mBlendMode = blendMode;
+        mDrawingVersion++;
         BlendModeChanged();
     }
 
@@ -73,6 +77,7 @@ namespace o2
     void IRectDrawable::SetEnabled(bool enabled)
     {
         mEnabled = enabled;
+        mDrawingVersion++;
         EnableChanged();
     }
 
@@ -86,6 +91,11 @@ namespace o2
         return mDrawingScissorRect.IsInside(point) && Transform::IsPointInside(point);
     }
 
+    UInt IRectDrawable::GetDrawingVersion() const
+    {
+        return mDrawingVersion;
+    }
+
     FunctionalRectDrawable::FunctionalRectDrawable(const Function<void(const Basis& transform, const Color4& color)>& draw, 
                                                    const Vec2F& size /*= Vec2F()*/, const Vec2F& position /*= Vec2F()*/, 
                                                    float angle /*= 0.0f*/, const Vec2F& scale /*= Vec2F(1.0f, 1.0f)*/, 
@@ -104,6 +114,9 @@ namespace o2
         if (!mEnabled)
             return;
 
+        // Drawing function can draw anything, so cached drawing of it is never actual
+        mDrawingVersion++;
+
         draw(GetBasis(), mColor);
 
         OnDrawn();
@@ -71,6 +71,10 @@ namespace o2
         // Returns true if point is under drawable
         bool IsUnderPoint(const Vec2F& point) override;
 
+        // Returns drawing version. It's increased when drawable mesh, color or state is changed, used to check
+        // actuality of cached drawing
+        UInt GetDrawingVersion() const;
+
         SERIALIZABLE(IRectDrawable);
         CLONEABLE_REF(IRectDrawable);
 
@@ -79,6 +83,8 @@ namespace o2
         BlendMode mBlendMode = BlendMode::Normal; // Blend mode @SERIALIZABLE
         bool      mEnabled = true;                // True, when drawable enabled and needs to draw @SERIALIZABLE
 
+        UInt mDrawingVersion = 0; // Drawing version, increased when drawable mesh, color or state is changed
+
     protected:
         // Called when color was changed
         virtual void ColorChanged() {}
@@ -136,6 +142,7 @@ CLASS_FIELDS_META(o2::IRectDrawable)
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mColor);
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(BlendMode::Normal).NAME(mBlendMode);
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(mEnabled);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mDrawingVersion);
 }
 END_META;
 CLASS_METHODS_META(o2::IRectDrawable)
@@ -153,6 +160,7 @@ CLASS_METHODS_META(o2::IRectDrawable)
     FUNCTION().PUBLIC().SIGNATURE(void, SetEnabled, bool);
     FUNCTION().PUBLIC().SIGNATURE(bool, IsEnabled);
     FUNCTION().PUBLIC().SIGNATURE(bool, IsUnderPoint, const Vec2F&);
+    FUNCTION().PUBLIC().SIGNATURE(UInt, GetDrawingVersion);
     FUNCTION().PROTECTED().SIGNATURE(void, ColorChanged);
     FUNCTION().PROTECTED().SIGNATURE(void, BlendModeChanged);
     FUNCTION().PROTECTED().SIGNATURE(void, EnableChanged);
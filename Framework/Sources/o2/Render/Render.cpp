@@ -5,6 +5,7 @@
 #include "o2/Application/Input.h"
 #include "o2/Assets/Assets.h"
 #include "o2/Assets/Types/AtlasAsset.h"
+#include "o2/Render/DrawBatchCache.h"
 #include "o2/Render/Font.h"
 #include "o2/Render/Mesh.h"
 #include "o2/Render/Sprite.h"
@@ -26,13 +27,30 @@ namespace o2
         mLog = mmake<LogStream>("Render");
         o2Debug.GetLog()->BindStream(mLog);
 
-        InitializePlatform();
+        mHeadless = o2Application.IsHeadless();
+
+        if (!mHeadless)
+            InitializePlatform();
 
         mResolution = o2Application.GetContentSize();
-        mMaxTextureSize = GetPlatformMaxTextureSize();
-        mDPI = GetPlatformDPI();
 
-        InitializeSandardShader();
+        if (!mHeadless)
+        {
+            mMaxTextureSize = GetPlatformMaxTextureSize();
+            mDPI = GetPlatformDPI();
+
+            InitializeSandardShader();
+        }
+        else
+        {
+            mMaxTextureSize = Vec2I(8192, 8192);
+            mDPI = Vec2I(96, 96);
+
+            // Buffers sizes limit batches of drawing capture
+            mVertexBufferSize = USHRT_MAX;
+            mIndexBufferSize = USHRT_MAX;
+        }
+
         InitializeWhiteTexture();
         InitializeFreeType();
         InitializeLinesIndexBuffer();
@@ -52,7 +70,8 @@ namespace o2
         mSolidLineTexture = nullptr;
         mDashLineTexture = nullptr;
 
-        DeinitializePlatform();
+        if (!mHeadless)
+            DeinitializePlatform();
 
         mFonts.Clear();
         mTextures.Clear();
@@ -118,11 +137,15 @@ namespace o2
         mCurrentPrimitiveType = PrimitiveType::Polygon;
         mDrawingDepth = 0.0f;
         mClippingEverything = false;
+        mTrackedDrawingCounter = 0;
 
         mScissorInfos.Clear();
         mStackScissors.Clear();
 
-        PlatformBegin();
+        // Headless render keeps frame state on CPU side only
+        if (!mHeadless)
+            PlatformBegin();
+
         SetupViewMatrix(mResolution);
         UpdateCameraTransforms();
 
@@ -143,9 +166,164 @@ namespace o2
 
         mDrawingDepth += 1.0f;
 
+        // Buffers are captured even when clipped, clipping is checked again when cache is replayed
+        if (mDrawCapture && !mDrawCaptureBroken)
+        {
+            if (mTrackedDrawingCounter > 0)
+            {
+                mDrawCapture->Add(primitiveType, vertices, verticesCount, indexes, elementsCount, texture, blendMode,
+                                  mVertexBufferSize, mIndexBufferSize, mDrawingDepth - mDrawCaptureBeginDepth);
+            }
+            else
+                BreakDrawCapture();
+        }
+
         if (mClippingEverything)
             return;
 
+        SubmitBuffer(primitiveType, vertices, verticesCount, indexes, elementsCount, texture, blendMode);
+    }
+
+    void Render::BeginDrawCapture(const Ref<DrawBatchCache>& cache)
+    {
+        mDrawCapture = cache;
+        mDrawCapture->Clear();
+        mDrawCaptureBroken = false;
+        mDrawCaptureBeginDepth = mDrawingDepth;
+        mDrawCaptureScissorsCount = 0;
+        mDrawCaptureStencilDrawing = mStencilDrawing;
+        mDrawCaptureStencilTest = mStencilTest;
+    }
+
+    bool Render::EndDrawCapture()
+    {
+        if (!mDrawCapture)
+            return false;
+
+        // Replaying must leave render in same state as captured drawing
+        if (mDrawCaptureScissorsCount != 0 || mDrawCaptureStencilDrawing != mStencilDrawing ||
+            mDrawCaptureStencilTest != mStencilTest)
+        {
+            BreakDrawCapture();
+        }
+
+        bool res = !mDrawCaptureBroken;
+
+        if (mDrawCaptureBroken)
+            mDrawCapture->Clear();
+        else
+            mDrawCapture->SetDrawingDepth(mDrawingDepth - mDrawCaptureBeginDepth);
+
+        mDrawCapture = nullptr;
+        mDrawCaptureBroken = false;
+
+        return res;
+    }
+
+    bool Render::IsDrawCapturing() const
+    {
+        return mDrawCapture != nullptr;
+    }
+
+    void Render::BreakDrawCapture()
+    {
+        if (mDrawCapture)
+            mDrawCaptureBroken = true;
+    }
+
+    void Render::BeginTrackedDrawing(const Ref<IRectDrawable>& drawable)
+    {
+        mTrackedDrawingCounter++;
+
+        if (mDrawCapture && !mDrawCaptureBroken)
+            mDrawCapture->AddDependency(drawable);
+    }
+
+    void Render::EndTrackedDrawing()
+    {
+        mTrackedDrawingCounter--;
+    }
+
+    void Render::DrawCachedBatches(DrawBatchCache& cache)
+    {
+        if (!mReady)
+            return;
+
+        if (mDrawCapture && !mDrawCaptureBroken)
+            mDrawCapture->AddDependencies(cache);
+
+        float beginDepth = mDrawingDepth;
+        for (auto& command : cache.GetCommands())
+        {
+            mDrawingDepth = beginDepth + command.drawingDepth;
+
+            switch (command.type)
+            {
+            case DrawBatchCache::CommandType::DrawBatch:
+            {
+                auto& batch = cache.GetBatches()[command.batchIdx];
+                mDrawingDepth += (float)batch.buffersCount;
+
+                // Cached buffers are tracked by cache dependencies, so they don't break capture
+                if (mDrawCapture && !mDrawCaptureBroken)
+                {
+                    mDrawCapture->Add(batch.primitiveType, cache.GetVertices(batch), batch.verticesCount,
+                                      cache.GetIndexes(batch), batch.elementsCount, batch.texture, batch.blendMode,
+                                      mVertexBufferSize, mIndexBufferSize, mDrawingDepth - mDrawCaptureBeginDepth,
+                                      batch.buffersCount);
+                }
+
+                if (!mClippingEverything)
+                {
+                    SubmitBuffer(batch.primitiveType, cache.GetVertices(batch), batch.verticesCount,
+                                 cache.GetIndexes(batch), batch.elementsCount, batch.texture, batch.blendMode);
+                }
+
+                break;
+            }
+
+            case DrawBatchCache::CommandType::EnableScissorTest:
+                EnableScissorTest(command.scissorRect);
+                break;
+
+            case DrawBatchCache::CommandType::DisableScissorTest:
+                DisableScissorTest();
+                break;
+
+            case DrawBatchCache::CommandType::BeginRenderToStencilBuffer:
+                BeginRenderToStencilBuffer();
+                break;
+
+            case DrawBatchCache::CommandType::EndRenderToStencilBuffer:
+                EndRenderToStencilBuffer();
+                break;
+
+            case DrawBatchCache::CommandType::EnableStencilTest:
+                EnableStencilTest();
+                break;
+
+            case DrawBatchCache::CommandType::DisableStencilTest:
+                DisableStencilTest();
+                break;
+            }
+        }
+
+        mDrawingDepth = beginDepth + cache.GetDrawingDepth();
+    }
+
+    void Render::AddDrawCaptureCommand(DrawBatchCache::CommandType type, const RectI& scissorRect /*= RectI()*/)
+    {
+        if (mDrawCapture && !mDrawCaptureBroken)
+            mDrawCapture->AddCommand(type, mDrawingDepth - mDrawCaptureBeginDepth, scissorRect);
+    }
+
+    void Render::SubmitBuffer(PrimitiveType primitiveType, Vertex* vertices, UInt verticesCount,
+                              VertexIndex* indexes, UInt elementsCount, const TextureRef& texture,
+                              BlendMode blendMode)
+    {
+        if (mHeadless)
+            return;
+
         UInt indexesCount;
         if (primitiveType == PrimitiveType::Line)
             indexesCount = elementsCount * 2;
@@ -228,7 +406,8 @@ namespace o2
 
         DrawPrimitives();
 
-        PlatformEnd();
+        if (!mHeadless)
+            PlatformEnd();
 
         CheckTexturesUnloading();
         CheckFontsUnloading();
@@ -245,7 +424,9 @@ namespace o2
 
         mCurrentDrawTexture = nullptr;
 
-        PlatformResetState();
+        if (!mHeadless)
+            PlatformResetState();
+
         SetupViewMatrix(mResolution);
         UpdateCameraTransforms();
     }
@@ -289,6 +470,7 @@ namespace o2
         if (mCurrentResolution == mPrevResolution && mCamera == mPrevCamera)
             return;
 
+        BreakDrawCapture();
         DrawPrimitives();
 
         Vec2F resf = (Vec2F)mCurrentResolution;
@@ -323,7 +505,8 @@ namespace o2
         mtxMultiply(finalCamMtx, modelMatrix, camTransfMatr);
         mtxMultiply(mvp, projMat, finalCamMtx);
 
-        PlatformSetupCameraTransforms(mvp);
+        if (!mHeadless)
+            PlatformSetupCameraTransforms(mvp);
 
         mPrevCamera = mCamera;
         mPrevResolution = mCurrentResolution;
@@ -334,8 +517,11 @@ namespace o2
         if (mStencilDrawing || mStencilTest)
             return;
 
+        AddDrawCaptureCommand(DrawBatchCache::CommandType::BeginRenderToStencilBuffer);
         DrawPrimitives();
-        PlatformBeginStencilDrawing();
+
+        if (!mHeadless)
+            PlatformBeginStencilDrawing();
 
         mStencilDrawing = true;
     }
@@ -345,8 +531,11 @@ namespace o2
         if (!mStencilDrawing)
             return;
 
+        AddDrawCaptureCommand(DrawBatchCache::CommandType::EndRenderToStencilBuffer);
         DrawPrimitives(); 
-        PlatformEndStencilDrawing();
+
+        if (!mHeadless)
+            PlatformEndStencilDrawing();
 
         mStencilDrawing = false;
     }
@@ -356,8 +545,11 @@ namespace o2
         if (mStencilTest || mStencilDrawing)
             return;
 
+        AddDrawCaptureCommand(DrawBatchCache::CommandType::EnableStencilTest);
         DrawPrimitives();
-        PlatformEnableStencilTest();
+
+        if (!mHeadless)
+            PlatformEnableStencilTest();
 
         mStencilTest = true;
     }
@@ -367,14 +559,20 @@ namespace o2
         if (!mStencilTest)
             return;
 
+        AddDrawCaptureCommand(DrawBatchCache::CommandType::DisableStencilTest);
         DrawPrimitives();
-        PlatformDisableStencilTest();
+
+        if (!mHeadless)
+            PlatformDisableStencilTest();
 
         mStencilTest = false;
     }
 
     void Render::EnableScissorTest(const RectI& rect)
     {
+        AddDrawCaptureCommand(DrawBatchCache::CommandType::EnableScissorTest, rect);
+        mDrawCaptureScissorsCount++;
+
         DrawPrimitives();
 
         RectI summaryScissorRect = rect;
@@ -390,21 +588,25 @@ namespace o2
             }
             else
             {
-                PlatformEnableScissorTest();
+                if (!mHeadless)
+                    PlatformEnableScissorTest();
+
                 mClippingEverything = false;
             }
         }
         else
         {
-            PlatformEnableScissorTest();
+            if (!mHeadless)
+                PlatformEnableScissorTest();
+
             mClippingEverything = false;
         }
 
         mScissorInfos.Add(ScissorInfo(summaryScissorRect, mDrawingDepth));
         mStackScissors.Add(ScissorStackEntry(rect, summaryScissorRect));
 
-        RectI screenScissorRect = CalculateScreenSpaceScissorRect(summaryScissorRect);
-        PlatformSetScissorRect(screenScissorRect);
+        if (!mHeadless)
+            PlatformSetScissorRect(CalculateScreenSpaceScissorRect(summaryScissorRect));
     }
 
     void Render::DisableScissorTest(bool forcible /*= false*/)
@@ -415,11 +617,21 @@ namespace o2
             return;
         }
 
+        // Disabling scissors enabled before capture can't be replayed
+        if (forcible || mDrawCaptureScissorsCount == 0)
+            BreakDrawCapture();
+        else
+        {
+            AddDrawCaptureCommand(DrawBatchCache::CommandType::DisableScissorTest);
+            mDrawCaptureScissorsCount--;
+        }
+
         DrawPrimitives();
 
         if (forcible)
         {
-            PlatformDisableScissorTest();
+            if (!mHeadless)
+                PlatformDisableScissorTest();
 
             while (!mStackScissors.IsEmpty() && !mStackScissors.Last().renderTarget)
                 mStackScissors.PopBack();
@@ -430,7 +642,9 @@ namespace o2
         {
             if (mStackScissors.Count() == 1)
             {
-                PlatformDisableScissorTest();
+                if (!mHeadless)
+                    PlatformDisableScissorTest();
+
                 mStackScissors.PopBack();
 
                 mScissorInfos.Last().endDepth = mDrawingDepth;
@@ -446,13 +660,15 @@ namespace o2
 
                 if (mStackScissors.Last().renderTarget)
                 {
-                    PlatformDisableScissorTest();
+                    if (!mHeadless)
+                        PlatformDisableScissorTest();
+
                     mClippingEverything = false;
                 }
                 else
                 {
-                    RectI screenScissorRect = CalculateScreenSpaceScissorRect(lastClipRect);
-                    PlatformSetScissorRect(screenScissorRect);
+                    if (!mHeadless)
+                        PlatformSetScissorRect(CalculateScreenSpaceScissorRect(lastClipRect));
 
                     mClippingEverything = lastClipRect == RectI();
                 }
@@ -482,17 +698,21 @@ namespace o2
             return;
         }
 
+        BreakDrawCapture();
         DrawPrimitives();
 
         if (!mStackScissors.IsEmpty())
         {
             mScissorInfos.Last().endDepth = mDrawingDepth;
-            PlatformDisableScissorTest();
+            if (!mHeadless)
+                PlatformDisableScissorTest();
         }
 
         mStackScissors.Add(ScissorStackEntry(RectI(), RectI(), true));
 
-        PlatformBindRenderTarget(renderTarget);
+        if (!mHeadless)
+            PlatformBindRenderTarget(renderTarget);
+
         SetupViewMatrix(renderTarget->GetSize());
 
         mCurrentRenderTarget = renderTarget;
@@ -503,8 +723,12 @@ namespace o2
         if (!mCurrentRenderTarget)
             return;
 
+        BreakDrawCapture();
         DrawPrimitives();
-        PlatformBindRenderTarget(nullptr);
+
+        if (!mHeadless)
+            PlatformBindRenderTarget(nullptr);
+
         SetupViewMatrix(mResolution);
 
         mCurrentRenderTarget = TextureRef();
@@ -516,8 +740,11 @@ namespace o2
         {
             auto clipRect = mStackScissors.Last().summaryScissorRect;
 
-            PlatformEnableScissorTest();
-            PlatformSetScissorRect(clipRect);
+            if (!mHeadless)
+            {
+                PlatformEnableScissorTest();
+                PlatformSetScissorRect(clipRect);
+            }
 
             mClippingEverything = clipRect == RectI();
         }
@@ -1151,6 +1378,11 @@ namespace o2
         return mMaxTextureSize;
     }
 
+    bool Render::IsHeadless() const
+    {
+        return mHeadless;
+    }
+
     float Render::GetDrawingDepth()
     {
         mDrawingDepth += 1.0f;
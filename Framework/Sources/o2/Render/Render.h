@@ -20,6 +20,7 @@
 #endif
 
 #include "o2/Render/Camera.h"
+#include "o2/Render/DrawBatchCache.h"
 #include "o2/Render/TextureRef.h"
 #include "o2/Utils/Math/Vertex.h"
 #include "o2/Utils/Singleton.h"
@@ -34,6 +35,7 @@ namespace o2
 
     class CursorAreaEventListenersLayer;
     class Font;
+    class IRectDrawable;
     class Mesh;
     class Sprite;
 
@@ -270,6 +272,30 @@ namespace o2
                         VertexIndex* indexes, UInt elementsCount, const TextureRef& texture,
                         BlendMode blendMode);
 
+        // Begins capturing of drawing buffers, scissor and stencil changes into cache. Everything is still drawn as usual
+        void BeginDrawCapture(const Ref<DrawBatchCache>& cache);
+
+        // Ends capturing. Returns false when capture was broken: buffers were drawn out of tracked drawing, render
+        // target or camera were changed, or scissors and stencil states are not balanced
+        bool EndDrawCapture();
+
+        // Returns true when drawing buffers are capturing now
+        bool IsDrawCapturing() const;
+
+        // Marks current draw capture as broken, called when drawing can't be replayed from cache
+        void BreakDrawCapture();
+
+        // Begins drawing which changes are tracked by drawable drawing version. Drawable is added into current draw
+        // capture dependencies. Buffers drawn out of tracked drawing break capture, their changes can't be detected
+        void BeginTrackedDrawing(const Ref<IRectDrawable>& drawable);
+
+        // Ends tracked drawing
+        void EndTrackedDrawing();
+
+        // Draws commands from cache: batches and scissor and stencil changes. Increases drawing depth same as
+        // captured drawing. When capturing, cache is added into current capture with its dependencies
+        void DrawCachedBatches(DrawBatchCache& cache);
+
         // Platform specific upload vertex and index buffers
         void PlatformUploadBuffers(Vertex* vertices, UInt verticesCount,
                                    VertexIndex* indexes, UInt indexesCount);
@@ -300,6 +326,9 @@ namespace o2
         // Returns maximum texture size
         Vec2I GetMaxTextureSize() const;
 
+        // Returns is render working without graphics API. Textures aren't uploaded, nothing is drawn
+        bool IsHeadless() const;
+
         // Returns last draw depth of mesh
         float GetDrawingDepth();
 
@@ -346,6 +375,14 @@ namespace o2
 
         float mDrawingDepth = 0.0f; // Current drawing depth, increments after each drawing drawables
 
+        Ref<DrawBatchCache> mDrawCapture;                         // Cache capturing drawing buffers now. Null when not capturing
+        bool                mDrawCaptureBroken = false;           // True when capture was broken and can't be replayed
+        float               mDrawCaptureBeginDepth = 0.0f;        // Drawing depth at capture beginning
+        int                 mDrawCaptureScissorsCount = 0;        // Count of scissors enabled during capture and not disabled yet
+        bool                mDrawCaptureStencilDrawing = false;   // Stencil drawing state at capture beginning
+        bool                mDrawCaptureStencilTest = false;      // Stencil test state at capture beginning
+        int                 mTrackedDrawingCounter = 0;           // Tracked drawing depth. Buffers are tracked when above zero
+
         FT_Library mFreeTypeLib; // FreeType library, for rendering fonts
 
         Vector<Sprite*>         mSprites; // All sprites
@@ -359,6 +396,8 @@ namespace o2
 
         bool mReady = false; // True, if render is ready to draw
 
+        bool mHeadless = false; // True, if render is working without graphics API in headless application
+
     protected:
         // Don't copy
         Render(const Render& other) = delete;
@@ -408,6 +447,14 @@ namespace o2
         // Send buffers to draw
         void DrawPrimitives();
 
+        // Puts buffer into vertex and index buffers, draws previous primitives when drawing settings are changed
+        void SubmitBuffer(PrimitiveType primitiveType, Vertex* vertices, UInt verticesCount,
+                          VertexIndex* indexes, UInt elementsCount, const TextureRef& texture,
+                          BlendMode blendMode);
+
+        // Adds render state command into current draw capture
+        void AddDrawCaptureCommand(DrawBatchCache::CommandType type, const RectI& scissorRect = RectI());
+
         // Platform specific draw primitives (draw call)
         void PlatformDrawPrimitives();
 
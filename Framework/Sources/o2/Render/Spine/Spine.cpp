@@ -3,8 +3,8 @@
 
 #include "o2/Application/Input.h"
 #include "o2/Render/Render.h"
+#include "o2/Utils/System/Time/Time.h"
 
-#include "spine/SkeletonRenderer.h"
 #include "spine/Animation.h"
 
 namespace o2
@@ -51,6 +51,7 @@ namespace o2
         // Setup pose
         mAnimationState->apply(*mSkeleton);
         mSkeleton->updateWorldTransform(spine::Physics::Physics_None);
+        mDrawBuffersReady = false;
 
         // Get animation names
         mAnimationNames.Clear();
@@ -72,58 +73,34 @@ namespace o2
             delete mAnimationState;
             mAnimationState = nullptr;
         }
+
+        mDrawBatches.Clear();
+        mDrawBuffersReady = false;
+        mNotAppliedDT = 0.0f;
+        mLastDrawFrame = -1;
     }
 
     void Spine::Draw()
     {
-        static spine::SkeletonRenderer skeletonRenderer;
-        static Map<spine::BlendMode, BlendMode> blendModes = {
-            { spine::BlendMode_Normal, BlendMode::Normal },
-            { spine::BlendMode_Additive, BlendMode::Add },
-            { spine::BlendMode_Multiply, BlendMode::Normal },
-            { spine::BlendMode_Screen, BlendMode::Normal }
-        };
-
-        spine::RenderCommand* command = skeletonRenderer.render(*mSkeleton);
-        while (command) 
-        {
-            Vertex vertex;
-
-            float* positions = command->positions;
-            float* uvs = command->uvs;
-            uint32_t* colors = command->colors;
-            uint16_t* indices = command->indices;
-            Texture* texture = (Texture*)command->texture;
-
-            mVertices.Clear();
-            mIndices.Clear();
+        if (!mSkeleton)
+            return;
 
-            for (int i = 0; i < command->numVertices; ++i)
-            {
-                int ii = i*2;
-                Vec2F position(positions[ii], positions[ii + 1]);
-                position = transform * position;
-
-                vertex.x = position.x;
-                vertex.y = position.y;
-                vertex.tu = uvs[ii];
-                vertex.tv = 1.0f - uvs[ii + 1];
-                vertex.color = colors[i];
-                mVertices.Add(vertex);
-            }
+        if (!mDrawBuffersReady || !(mDrawBuffersTransform == transform))
+            UpdateDrawBuffers();
 
-            for (int i = 0, n = command->numIndices; i < n; ++i)
-                mIndices.Add(indices[i]);
+        UpdateScreenVisibility();
 
-            BlendMode blendMode = blendModes[command->blendMode];
-            TextureRef textureRef = TextureRef((Texture*)command->texture);
+        bool drawWire = o2Input.IsKeyDown(VK_F3);
+        for (auto& batch : mDrawBatches)
+        {
+            Vertex* vertices = mVertices.Data() + batch.verticesStart;
+            VertexIndex* indices = mIndices.Data() + batch.indicesStart;
 
-            o2Render.DrawBuffer(PrimitiveType::Polygon, mVertices.Data(), command->numVertices, mIndices.Data(), command->numIndices/3, textureRef, blendMode);
+            o2Render.DrawBuffer(PrimitiveType::Polygon, vertices, batch.verticesCount, indices, batch.indicesCount/3,
+                                TextureRef(batch.texture), batch.blendMode);
 
-            if (o2Input.IsKeyDown(VK_F3))
-                o2Render.DrawMeshBufferWire(mVertices.Data(), command->numVertices, mIndices.Data(), command->numIndices/3, Color4::Red());
-                
-            command = command->next;
+            if (drawWire)
+                o2Render.DrawMeshBufferWire(vertices, batch.verticesCount, indices, batch.indicesCount/3, Color4::Red());
         }
 
         OnDrawn();
@@ -134,11 +111,165 @@ namespace o2
         if (!mSkeleton || !mAnimationState)
             return;
 
+        // Animation state time is advanced anyway, so animation continues from right time when LOD is raised
         mAnimationState->update(dt);
+
+        // Skipped time is limited, so skeleton physics doesn't jump after long frozen period
+        mNotAppliedDT = Math::Min(mNotAppliedDT + dt, Math::Max(lod.maxAppliedDT, dt));
+
+        UpdateLOD updateLOD = GetUpdateLOD();
+        if (updateLOD == UpdateLOD::Frozen)
+            return;
+
+        if (updateLOD == UpdateLOD::Reduced && mNotAppliedDT*lod.reducedUpdateRate < 1.0f &&
+            mNotAppliedDT < lod.maxAppliedDT)
+        {
+            return;
+        }
+
         mAnimationState->apply(*mSkeleton);
 
-        mSkeleton->update(dt);
+        mSkeleton->update(mNotAppliedDT);
         mSkeleton->updateWorldTransform(spine::Physics::Physics_Update);
+
+        mNotAppliedDT = 0.0f;
+        mDrawBuffersReady = false;
+    }
+
+    Spine::UpdateLOD Spine::GetUpdateLOD() const
+    {
+        // Not drawn yet spine is updated fully, so it's not shown in setup pose
+        if (!lod.enabled || mLastDrawFrame < 0)
+            return UpdateLOD::Full;
+
+        bool isVisible = mIsOnScreen && mLastDrawFrame >= o2Time.GetCurrentFrame() - 1;
+        if (!isVisible)
+            return lod.freezeOffscreen ? UpdateLOD::Frozen : UpdateLOD::Reduced;
+
+        if (mScreenSize < lod.smallScreenSize)
+            return UpdateLOD::Reduced;
+
+        return UpdateLOD::Full;
+    }
+
+    void Spine::UpdateScreenVisibility()
+    {
+        mLastDrawFrame = o2Time.GetCurrentFrame();
+
+        RectF viewRect = o2Render.GetCamera().GetAxisAlignedRect();
+        float boundsSize = Math::Max(mDrawBuffersBounds.Width(), mDrawBuffersBounds.Height());
+
+        if (viewRect.Width() > 0.0f)
+        {
+            mIsOnScreen = viewRect.IsIntersects(mDrawBuffersBounds);
+            mScreenSize = boundsSize*(float)o2Render.GetCurrentResolution().x/viewRect.Width();
+        }
+        else
+        {
+            mIsOnScreen = true;
+            mScreenSize = boundsSize;
+        }
+    }
+
+    void Spine::UpdateDrawBuffers()
+    {
+        // Indexed by spine::BlendMode
+        static const BlendMode blendModes[] = { BlendMode::Normal, BlendMode::Add, BlendMode::Normal, BlendMode::Normal };
+
+        // Merged batch must fit render buffers on all platforms
+        const int maxBatchVerticesCount = USHRT_MAX;
+        const int maxBatchIndicesCount = USHRT_MAX;
+
+        mDrawBatches.Clear();
+        mDrawBuffersTransform = transform;
+        mDrawBuffersReady = true;
+
+        if (!mSkeleton)
+            return;
+
+        spine::RenderCommand* commands = mSkeletonRenderer.render(*mSkeleton);
+
+        int verticesCount = 0, indicesCount = 0;
+        for (auto command = commands; command; command = command->next)
+        {
+            verticesCount += command->numVertices;
+            indicesCount += command->numIndices;
+        }
+
+        if (mVertices.Count() < verticesCount)
+            mVertices.Resize(verticesCount);
+
+        if (mIndices.Count() < indicesCount)
+            mIndices.Resize(indicesCount);
+
+        const Vec2F xv = transform.xv, yv = transform.yv, origin = transform.origin;
+
+        Vertex* vertices = mVertices.Data();
+        VertexIndex* indices = mIndices.Data();
+        int verticesOffset = 0, indicesOffset = 0;
+
+        Vec2F boundsMin(FLT_MAX, FLT_MAX), boundsMax(-FLT_MAX, -FLT_MAX);
+
+        for (auto command = commands; command; command = command->next)
+        {
+            Texture* texture = (Texture*)command->texture;
+            BlendMode blendMode = blendModes[command->blendMode];
+
+            DrawBatch* batch = mDrawBatches.IsEmpty() ? nullptr : &mDrawBatches.Last();
+            if (!batch || batch->texture != texture || batch->blendMode != blendMode ||
+                batch->verticesCount + command->numVertices > maxBatchVerticesCount ||
+                batch->indicesCount + command->numIndices > maxBatchIndicesCount)
+            {
+                DrawBatch newBatch;
+                newBatch.texture = texture;
+                newBatch.blendMode = blendMode;
+                newBatch.verticesStart = verticesOffset;
+                newBatch.indicesStart = indicesOffset;
+
+                mDrawBatches.Add(newBatch);
+                batch = &mDrawBatches.Last();
+            }
+
+            const float* positions = command->positions;
+            const float* uvs = command->uvs;
+            const uint32_t* colors = command->colors;
+
+            Vertex* vertex = vertices + verticesOffset;
+            for (int i = 0, n = command->numVertices; i < n; i++, vertex++)
+            {
+                float x = positions[i*2], y = positions[i*2 + 1];
+
+                vertex->x = xv.x*x + yv.x*y + origin.x;
+                vertex->y = xv.y*x + yv.y*y + origin.y;
+                vertex->z = 0.0f;
+
+                boundsMin.x = Math::Min(boundsMin.x, vertex->x);
+                boundsMin.y = Math::Min(boundsMin.y, vertex->y);
+                boundsMax.x = Math::Max(boundsMax.x, vertex->x);
+                boundsMax.y = Math::Max(boundsMax.y, vertex->y);
+                vertex->tu = uvs[i*2];
+                vertex->tv = 1.0f - uvs[i*2 + 1];
+                vertex->color = colors[i];
+            }
+
+            // Command indices are local, offsetting them by command position in batch
+            const uint16_t* commandIndices = command->indices;
+            VertexIndex baseVertex = (VertexIndex)batch->verticesCount;
+            VertexIndex* index = indices + indicesOffset;
+            for (int i = 0, n = command->numIndices; i < n; i++)
+                index[i] = baseVertex + commandIndices[i];
+
+            batch->verticesCount += command->numVertices;
+            batch->indicesCount += command->numIndices;
+
+            verticesOffset += command->numVertices;
+            indicesOffset += command->numIndices;
+        }
+
+        if (verticesOffset > 0)
+            mDrawBuffersBounds = RectF(boundsMin.x, boundsMax.y, boundsMax.x, boundsMin.y);
+        else
+            mDrawBuffersBounds = RectF(origin.x, origin.y, origin.x, origin.y);
     }
 
     const Vector<String>& Spine::GetAnimationNames() const
@@ -227,5 +358,13 @@ namespace o2
 }
 // --- META ---
 
+ENUM_META(o2::Spine::UpdateLOD)
+{
+    ENUM_ENTRY(Frozen);
+    ENUM_ENTRY(Full);
+    ENUM_ENTRY(Reduced);
+}
+END_ENUM_META;
+
 DECLARE_CLASS(o2::Spine::Track, o2__Spine__Track);
 // --- END META ---
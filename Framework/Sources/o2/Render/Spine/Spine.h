@@ -10,10 +10,13 @@
 #include "o2/Utils/Types/CommonTypes.h"
 
 #include "spine/Skeleton.h"
+#include "spine/SkeletonRenderer.h"
 #include "spine/AnimationState.h"
 
 namespace o2
 {
+    class Texture;
+
     // --------------------------------
     // EsotericSoftware Spine animation
     // --------------------------------
@@ -68,9 +71,44 @@ namespace o2
             void OnLoopChanged() override;
         };
 
+    protected:
+        // -------------------------------------------------------------------------------------------
+        // Draw batch. Consecutive render commands with same texture and blend mode, drawn by one call
+        // -------------------------------------------------------------------------------------------
+        struct DrawBatch
+        {
+            Texture*  texture = nullptr;             // Batch texture
+            BlendMode blendMode = BlendMode::Normal; // Batch blend mode
+
+            int verticesStart = 0; // First vertex index in vertices buffer
+            int verticesCount = 0; // Count of vertices
+            int indicesStart = 0;  // First index in indices buffer
+            int indicesCount = 0;  // Count of indices
+        };
+
+    public:
+        // -------------------------------------------------------------------------------------------
+        // Animation update level of detail. Selected by visibility and on-screen size at last drawing
+        // -------------------------------------------------------------------------------------------
+        enum class UpdateLOD { Full, Reduced, Frozen };
+
+        // --------------------------------
+        // Animation level of detail policy
+        // --------------------------------
+        struct LODSettings
+        {
+            bool  enabled = true;            // Is LOD enabled, otherwise spine is always updated fully
+            float smallScreenSize = 64.0f;   // On-screen size in pixels, smaller spine is updated with reduced rate
+            float reducedUpdateRate = 15.0f; // Pose updates per second with reduced LOD
+            bool  freezeOffscreen = true;    // Freezes pose when spine isn't drawn or is off-screen, otherwise reduces rate
+            float maxAppliedDT = 0.25f;      // Maximum delta time applied to pose and physics at once, rest is dropped
+        };
+
     public:
         Basis transform; // Root transform                                       
 
+        LODSettings lod; // Animation level of detail policy
+
     public:
         // Constructor
         explicit Spine(RefCounter* refCounter);
@@ -93,12 +131,20 @@ namespace o2
         // Unload spine skeleton
         void Unload();
 
-        // Drawing SkinnableMesh
+        // Drawing SkinnableMesh. Builds draw buffers if they weren't built for current pose and transform
         void Draw() override;
 
-        // Updates spine animation
+        // Updates spine animation. Animation state time is always advanced, but pose is applied and world transforms
+        // are updated according to LOD: each update when full, with reduced rate or not at all when frozen
         void Update(float dt);
 
+        // Returns update LOD, selected by last drawing
+        UpdateLOD GetUpdateLOD() const;
+
+        // Builds vertices, indices and draw batches from current skeleton pose and transform. Uses own skeleton
+        // renderer and buffers, so different spines can be built in parallel. Doesn't call render
+        void UpdateDrawBuffers();
+
         // Returns spine animation names
         const Vector<String>& GetAnimationNames() const;
 
@@ -115,14 +161,38 @@ namespace o2
 
         Vector<String> mAnimationNames; // Animation names
 
-        Vector<Vertex>      mVertices; // Vertices buffer
-        Vector<VertexIndex> mIndices;  // Indices buffer
+        spine::SkeletonRenderer mSkeletonRenderer; // Skeleton renderer of this spine, builds render commands
+
+        Vector<Vertex>      mVertices; // Vertices buffer of all render commands. Sized by maximum, isn't shrunk
+        Vector<VertexIndex> mIndices;  // Indices buffer of all render commands. Sized by maximum, isn't shrunk
+
+        Vector<DrawBatch> mDrawBatches; // Draw batches of merged render commands
+
+        Basis mDrawBuffersTransform;     // Transform used in draw buffers
+        RectF mDrawBuffersBounds;        // World bounds of vertices in draw buffers
+        bool  mDrawBuffersReady = false; // Are draw buffers built for current pose
+
+        float mNotAppliedDT = 0.0f; // Delta time of animation state, not applied to pose yet because of LOD
+
+        int   mLastDrawFrame = -1; // Frame of last drawing, -1 if wasn't drawn
+        bool  mIsOnScreen = true;  // Was spine on screen at last drawing
+        float mScreenSize = 0.0f;  // On-screen size in pixels at last drawing
+
+        float mScheduledUpdateDT = 0.0f;  // Delta time of scheduled update in spine manager
+        bool  mIsUpdateScheduled = false; // Is update scheduled in spine manager
+
+    protected:
+        // Checks visibility and on-screen size of draw buffers bounds with current render camera
+        void UpdateScreenVisibility();
 
         friend class Render;
+        friend class SpineManager;
     };
 }
 // --- META ---
 
+PRE_ENUM_META(o2::Spine::UpdateLOD);
+
 CLASS_BASES_META(o2::Spine::Track)
 {
     BASE_CLASS(o2::IAnimation);
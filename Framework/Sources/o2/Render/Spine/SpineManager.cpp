@@ -1,6 +1,8 @@
 #include "o2/stdafx.h"
 #include "SpineManager.h"
 
+#include "o2/Render/Spine/Spine.h"
+
 #include <spine/Extension.h>
 
 namespace o2
@@ -11,6 +13,147 @@ namespace o2
         Singleton(refCounter)
     {}
 
+    SpineManager::~SpineManager()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mWorkMutex);
+            mStopWorkers = true;
+        }
+
+        mWorkRequestedCondition.notify_all();
+
+        for (auto& worker : mWorkers)
+            worker.join();
+    }
+
+    void SpineManager::BeginBatch()
+    {
+        mBatchDepth++;
+    }
+
+    void SpineManager::EndBatch()
+    {
+        Assert(mBatchDepth > 0, "Spines batch ended without beginning");
+
+        mBatchDepth--;
+        if (mBatchDepth == 0)
+            UpdateScheduledSpines();
+    }
+
+    bool SpineManager::IsBatchActive() const
+    {
+        return mBatchDepth > 0;
+    }
+
+    void SpineManager::ScheduleUpdate(const Ref<Spine>& spine, float dt)
+    {
+        // Nobody will flush scheduled spines, e.g. actor is updated by editor outside of scene update
+        if (!IsBatchActive())
+        {
+            spine->Update(dt);
+            return;
+        }
+
+        if (spine->mIsUpdateScheduled)
+        {
+            spine->mScheduledUpdateDT += dt;
+            return;
+        }
+
+        spine->mIsUpdateScheduled = true;
+        spine->mScheduledUpdateDT = dt;
+        mScheduledSpines.Add(spine);
+    }
+
+    void SpineManager::UpdateScheduledSpines()
+    {
+        PROFILE_SAMPLE_FUNC();
+
+        if (mScheduledSpines.IsEmpty())
+            return;
+
+        mNextSpineIndex = 0;
+
+        if (threadedUpdate && mScheduledSpines.Count() >= minThreadedSpinesCount)
+        {
+            if (mWorkers.empty())
+            {
+                // Main thread processes spines too
+                int workersCount = Math::Clamp((int)std::thread::hardware_concurrency() - 1, 1, 8);
+                for (int i = 0; i < workersCount; i++)
+                    mWorkers.emplace_back(&SpineManager::WorkerLoop, this);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mWorkMutex);
+                mActiveWorkersCount = (int)mWorkers.size();
+                mWorkGeneration++;
+            }
+
+            mWorkRequestedCondition.notify_all();
+
+            ProcessScheduledSpines();
+
+            std::unique_lock<std::mutex> lock(mWorkMutex);
+            mWorkFinishedCondition.wait(lock, [&]() { return mActiveWorkersCount == 0; });
+        }
+        else
+            ProcessScheduledSpines();
+
+        mScheduledSpines.Clear();
+    }
+
+    void SpineManager::WorkerLoop()
+    {
+        int processedGeneration = 0;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mWorkMutex);
+                mWorkRequestedCondition.wait(lock, [&]() { return mStopWorkers || mWorkGeneration != processedGeneration; });
+
+                if (mStopWorkers)
+                    return;
+
+                processedGeneration = mWorkGeneration;
+            }
+
+            ProcessScheduledSpines();
+
+            {
+                std::lock_guard<std::mutex> lock(mWorkMutex);
+                mActiveWorkersCount--;
+            }
+
+            mWorkFinishedCondition.notify_one();
+        }
+    }
+
+    void SpineManager::ProcessScheduledSpines()
+    {
+        int count = mScheduledSpines.Count();
+        while (true)
+        {
+            int idx = mNextSpineIndex.fetch_add(1);
+            if (idx >= count)
+                break;
+
+            UpdateScheduledSpine(mScheduledSpines[idx].Get());
+        }
+    }
+
+    void SpineManager::UpdateScheduledSpine(Spine* spine)
+    {
+        spine->Update(spine->mScheduledUpdateDT);
+
+        spine->mScheduledUpdateDT = 0.0f;
+        spine->mIsUpdateScheduled = false;
+
+        if (spine->GetUpdateLOD() != Spine::UpdateLOD::Frozen && !spine->mDrawBuffersReady)
+            spine->UpdateDrawBuffers();
+    }
+
     void SpineTextureLoader::load(spine::AtlasPage& page, const spine::String& path)
     {
         TextureRef texture(String(path.buffer()));
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "o2/Utils/Singleton.h"
 #include "o2/Render/TextureRef.h"
 
@@ -8,6 +13,8 @@
 
 namespace o2
 {
+    FORWARD_CLASS_REF(Spine);
+
     // ---------------------
     // Spine textures loader
     // ---------------------
@@ -24,16 +31,62 @@ namespace o2
         Map<void*, TextureRef> mUsedTextures; // List of used textures
     };
 
-    // ------------------------------------------------------------------------------
-    // Spine manager. Initializes spine subsystems and contains spine textures loader
-    // ------------------------------------------------------------------------------
+    // ------------------------------------------------------------------------------------------------------------
+    // Spine manager. Initializes spine subsystems and contains spine textures loader. Updates scheduled spines in
+    // batch on worker threads: each skeleton is independent, so spines are distributed between threads
+    // ------------------------------------------------------------------------------------------------------------
     class SpineManager : public Singleton<SpineManager>
     {
     public:
         SpineTextureLoader textureLoader; // Spine textures loader
 
+        bool threadedUpdate = true;       // Are scheduled spines updated on worker threads
+        int  minThreadedSpinesCount = 16; // Minimal count of scheduled spines to update them on worker threads
+
     public:
         // Constructor. Initializes spine subsystems
         SpineManager(RefCounter* refCounter);
+
+        // Destructor. Stops worker threads
+        ~SpineManager();
+
+        // Begins batch: spines updates are scheduled until batch ends. Batches can be nested
+        void BeginBatch();
+
+        // Ends batch. Updates scheduled spines when outer batch ends
+        void EndBatch();
+
+        // Returns is batch active
+        bool IsBatchActive() const;
+
+        // Schedules spine update when batch is active, delta time is accumulated if spine is already scheduled.
+        // Without active batch spine is updated immediately
+        void ScheduleUpdate(const Ref<Spine>& spine, float dt);
+
+        // Updates scheduled spines and builds draw buffers of visible ones. Returns when all spines are updated
+        void UpdateScheduledSpines();
+
+    protected:
+        Vector<Ref<Spine>> mScheduledSpines; // Spines scheduled to update
+        int                mBatchDepth = 0;  // Count of begun and not ended batches
+
+        std::vector<std::thread> mWorkers;                // Worker threads, started on first threaded update
+        std::mutex               mWorkMutex;              // Guards work requests and finishes
+        std::condition_variable  mWorkRequestedCondition; // Wakes worker threads
+        std::condition_variable  mWorkFinishedCondition;  // Notifies of workers finished
+        int                      mWorkGeneration = 0;     // Index of work request, guarded by work mutex
+        int                      mActiveWorkersCount = 0; // Count of workers processing request, guarded by work mutex
+        bool                     mStopWorkers = false;    // Are worker threads stopping, guarded by work mutex
+        std::atomic<int>         mNextSpineIndex = 0;     // Index of next scheduled spine to process
+
+    protected:
+        // Worker thread loop. Waits requests and processes scheduled spines
+        void WorkerLoop();
+
+        // Takes scheduled spines one by one and updates them, until all are taken
+        void ProcessScheduledSpines();
+
+        // Updates spine with scheduled delta time and builds draw buffers if it will be drawn
+        static void UpdateScheduledSpine(Spine* spine);
     };
 }
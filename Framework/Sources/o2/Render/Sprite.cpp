@@ -95,7 +95,9 @@ namespace o2
     Sprite::Sprite(const Sprite& other):
         mImageAsset(other.mImageAsset), mTextureSrcRect(other.mTextureSrcRect), IRectDrawable(other), 
         mMesh(other.mMesh), mMode(other.mMode), mFill(other.mFill), mSlices(other.mSlices),
-        mMeshBuildFunc(other.mMeshBuildFunc), mTileScale(other.mTileScale),
+        mMeshBuildFunc(other.mMeshBuildFunc), mTileScale(other.mTileScale), mLocalVertices(other.mLocalVertices),
+        mLocalVerticesSize(other.mLocalVerticesSize), mLocalVerticesScale(other.mLocalVerticesScale),
+        mLocalVerticesValid(other.mLocalVerticesValid), mVisibleTiles(other.mVisibleTiles),
         texture(this), textureSrcRect(this), image(this), imageName(this), leftTopColor(this), rightTopColor(this),
         leftBottomColor(this), rightBottomColor(this), mode(this), fill(this), tileScale(this), sliceBorder(this)
     {
@@ -120,6 +122,13 @@ namespace o2
         mSlices         = other.mSlices;
         mTileScale      = other.mTileScale;
         mMeshBuildFunc  = other.mMeshBuildFunc;
+
+        mLocalVertices      = other.mLocalVertices;
+        mLocalVerticesSize  = other.mLocalVerticesSize;
+        mLocalVerticesScale = other.mLocalVerticesScale;
+        mLocalVerticesValid = other.mLocalVerticesValid;
+        mVisibleTiles       = other.mVisibleTiles;
+
         IRectDrawable::operator=(other);
 
         return *this;
@@ -135,6 +144,9 @@ namespace o2
         if (IsRenderDrawCallsDebugEnabled())
             o2Render.mLog->Out("- Draw sprite: " + mImageAsset->GetPath());
 
+        if (mMode == SpriteMode::Tiled)
+            UpdateVisibleTiles();
+
         mMesh.Draw();
         OnDrawn();
 
@@ -146,6 +158,7 @@ namespace o2
 
     void Sprite::SetTexture(const TextureRef& texture)
     {
+        mDrawingVersion++;
         mMesh.SetTexture(texture);
         mImageAsset = AssetRef<ImageAsset>();
     }
@@ -173,6 +186,7 @@ namespace o2
     void Sprite::SetCornerColor(Corner corner, const Color4& color)
     {
         mCornersColors[(int)corner] = color;
+        UpdateMeshColors();
     }
 
     Color4 Sprite::GetCornerColor(Corner corner) const
@@ -183,6 +197,7 @@ namespace o2
     void Sprite::SetLeftTopColor(const Color4& color)
     {
         mCornersColors[(int)Corner::LeftTop] = color;
+        UpdateMeshColors();
     }
 
     Color4 Sprite::GetLeftTopCorner() const
@@ -193,6 +208,7 @@ namespace o2
     void Sprite::SetRightTopColor(const Color4& color)
     {
         mCornersColors[(int)Corner::RightTop] = color;
+        UpdateMeshColors();
     }
 
     Color4 Sprite::GetRightTopCorner() const
@@ -203,6 +219,7 @@ namespace o2
     void Sprite::SetRightBottomColor(const Color4& color)
     {
         mCornersColors[(int)Corner::RightBottom] = color;
+        UpdateMeshColors();
     }
 
     Color4 Sprite::GetRightBottomCorner() const
@@ -213,6 +230,7 @@ namespace o2
     void Sprite::SetLeftBottomColor(const Color4& color)
     {
         mCornersColors[(int)Corner::LeftBottom] = color;
+        UpdateMeshColors();
     }
 
     Color4 Sprite::GetLeftBottomCorner() const
@@ -421,12 +439,18 @@ namespace o2
 
     void Sprite::BasisChanged()
     {
-        UpdateMesh();
+        mDrawingVersion++;
+
+        // Local geometry depends only on size, moving, rotating and shearing just transforms it
+        if (mLocalVerticesValid && mLocalVerticesSize == mSize && mLocalVerticesScale == mScale)
+            TransformLocalVertices();
+        else
+            UpdateMesh();
     }
 
     void Sprite::ColorChanged()
     {
-        UpdateMesh();
+        UpdateMeshColors();
     }
 
     void Sprite::BlendModeChanged()
@@ -436,7 +460,126 @@ namespace o2
 
     void Sprite::UpdateMesh()
     {
+        mDrawingVersion++;
+
+        Vec2F sz = mSize*mScale;
+        if (Math::Equals(sz.x, 0.0f) || Math::Equals(sz.y, 0.0f))
+        {
+            mLocalVerticesValid = false;
+            (this->*mMeshBuildFunc)();
+            return;
+        }
+
+        // Building mesh in local space, where sprite rectangle is (0, 0) - (1, 1). Mesh building functions use only
+        // transforms vectors, so local positions are linearly transformed into same world positions
+        Basis transform = mTransform;
+        Basis nonSizedTransform = mNonSizedTransform;
+
+        mTransform = Basis(Vec2F(), Vec2F(1.0f, 0.0f), Vec2F(0.0f, 1.0f));
+        mNonSizedTransform = Basis(Vec2F(), Vec2F(1.0f/mSize.x, 0.0f), Vec2F(0.0f, 1.0f/mSize.y));
+
         (this->*mMeshBuildFunc)();
+
+        mTransform = transform;
+        mNonSizedTransform = nonSizedTransform;
+
+        mLocalVertices.Resize((int)mMesh.vertexCount);
+        for (UInt i = 0; i < mMesh.vertexCount; i++)
+            mLocalVertices[i].Set(mMesh.vertices[i].x, mMesh.vertices[i].y);
+
+        mLocalVerticesSize = mSize;
+        mLocalVerticesScale = mScale;
+        mLocalVerticesValid = true;
+
+        TransformLocalVertices();
+    }
+
+    void Sprite::TransformLocalVertices()
+    {
+        Vec2F o = mTransform.origin;
+        Vec2F xv = mTransform.xv;
+        Vec2F yv = mTransform.yv;
+
+        for (UInt i = 0; i < mMesh.vertexCount; i++)
+        {
+            const Vec2F& p = mLocalVertices[i];
+            mMesh.vertices[i].x = o.x + xv.x*p.x + yv.x*p.y;
+            mMesh.vertices[i].y = o.y + xv.y*p.x + yv.y*p.y;
+        }
+    }
+
+    void Sprite::UpdateMeshColors()
+    {
+        mDrawingVersion++;
+
+        // With equal corners colors all modes fill vertices with same color, otherwise colors depend on mode geometry
+        bool equalCornersColors = mCornersColors[0] == mCornersColors[1] && mCornersColors[0] == mCornersColors[2] &&
+            mCornersColors[0] == mCornersColors[3];
+
+        if (!equalCornersColors)
+        {
+            UpdateMesh();
+            return;
+        }
+
+        ULong color = (mColor*mCornersColors[0]).ABGR();
+        for (UInt i = 0; i < mMesh.vertexCount; i++)
+            mMesh.vertices[i].color = color;
+    }
+
+    void Sprite::UpdateVisibleTiles()
+    {
+        RectI visibleTiles = CalculateVisibleTiles();
+        if (visibleTiles == mVisibleTiles)
+            return;
+
+        mVisibleTiles = visibleTiles;
+        UpdateMesh();
+    }
+
+    RectI Sprite::CalculateVisibleTiles() const
+    {
+        RectI allTiles(0, 0, INT_MAX, INT_MAX);
+
+        // Captured drawing is replayed later with other view, all tiles are required
+        if (o2Render.IsDrawCapturing())
+            return allTiles;
+
+        Vec2F sz = mSize*mScale;
+        Vec2F tileSize = (Vec2F)(mTextureSrcRect.Size())*mTileScale;
+        Basis cameraBasis = o2Render.GetCamera().GetBasis();
+
+        float transformDet = mTransform.xv.x*mTransform.yv.y - mTransform.yv.x*mTransform.xv.y;
+        float cameraDet = cameraBasis.xv.x*cameraBasis.yv.y - cameraBasis.yv.x*cameraBasis.xv.y;
+        if (tileSize.x <= 0.0f || tileSize.y <= 0.0f || Math::Equals(transformDet, 0.0f) || Math::Equals(cameraDet, 0.0f))
+            return allTiles;
+
+        Vec2I tilesCount(Math::CeilToInt(sz.x/tileSize.x), Math::CeilToInt(sz.y/tileSize.y));
+        if (tilesCount.x <= 0 || tilesCount.y <= 0)
+            return allTiles;
+
+        // Visible area is camera area clipped by summary scissor rect. Both are in camera space, same as sprite
+        // vertices, so they are transformed into sprite local space. Render target on top of scissors stack has no
+        // clipping, only camera area is used
+        Basis worldToLocal = mTransform.Inverted();
+        RectF localRect = (cameraBasis*worldToLocal).AABB();
+
+        auto& scissorsStack = o2Render.GetScissorsStack();
+        if (!scissorsStack.IsEmpty() && !scissorsStack.Last().renderTarget)
+        {
+            RectI scissorRect = scissorsStack.Last().summaryScissorRect;
+            Basis scissorBasis((Vec2F)scissorRect.LeftBottom(), Vec2F((float)scissorRect.Width(), 0.0f),
+                               Vec2F(0.0f, (float)scissorRect.Height()));
+
+            localRect = localRect.GetIntersection((scissorBasis*worldToLocal).AABB());
+        }
+
+        float left = Math::Clamp(Math::Min(localRect.left*sz.x, localRect.right*sz.x)/tileSize.x, 0.0f, (float)tilesCount.x);
+        float right = Math::Clamp(Math::Max(localRect.left*sz.x, localRect.right*sz.x)/tileSize.x, 0.0f, (float)tilesCount.x);
+        float bottom = Math::Clamp(Math::Min(localRect.bottom*sz.y, localRect.top*sz.y)/tileSize.y, 0.0f, (float)tilesCount.y);
+        float top = Math::Clamp(Math::Max(localRect.bottom*sz.y, localRect.top*sz.y)/tileSize.y, 0.0f, (float)tilesCount.y);
+
+        return RectI(Math::FloorToInt(left), Math::CeilToInt(top), Math::CeilToInt(right), Math::FloorToInt(bottom));
     }
 
     void Sprite::BuildDefaultMesh()
@@ -587,7 +730,13 @@ namespace o2
 
         Vec2I tilesCount(Math::CeilToInt(sz.x/tileSize.x), Math::CeilToInt(sz.y/tileSize.y));
 
-        UInt requiredPolygons = tilesCount.x*tilesCount.y*2;
+        // Building only visible tiles range
+        Vec2I tilesBegin(Math::Max(mVisibleTiles.left, 0), Math::Max(mVisibleTiles.bottom, 0));
+        Vec2I tilesEnd(Math::Min(mVisibleTiles.right, tilesCount.x), Math::Min(mVisibleTiles.top, tilesCount.y));
+
+        Vec2I visibleTilesCount(Math::Max(tilesEnd.x - tilesBegin.x, 0), Math::Max(tilesEnd.y - tilesBegin.y, 0));
+
+        UInt requiredPolygons = visibleTilesCount.x*visibleTilesCount.y*2;
         UInt requiredVecticiesCount = requiredPolygons*2;
 
         if (mMesh.GetMaxVertexCount() < requiredVecticiesCount || mMesh.GetMaxPolyCount() < requiredPolygons)
@@ -600,8 +749,8 @@ namespace o2
 
         int vi = 0, pi = 0;
 
-        float px0 = 0;
-        for (int x = 0; x < tilesCount.x; x++)
+        float px0 = (float)tilesBegin.x*tileSize.x;
+        for (int x = tilesBegin.x; x < tilesEnd.x; x++)
         {
             float px = (float)(x + 1)*tileSize.x;
             float u = uvRight;
@@ -612,8 +761,8 @@ namespace o2
                 px = sz.x;
             }
 
-            float py0 = 0;
-            for (int y = 0; y < tilesCount.y; y++)
+            float py0 = (float)tilesBegin.y*tileSize.y;
+            for (int y = tilesBegin.y; y < tilesEnd.y; y++)
             {
                 float py = (float)(y + 1)*tileSize.y;
                 float v = uvUp;
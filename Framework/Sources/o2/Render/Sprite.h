@@ -201,6 +201,12 @@ namespace o2
         float         mTileScale = 1.0f;           // Scale of tiles in tiled mode. 1.0f is default and equals to default image size @SERIALIZABLE
         Mesh          mMesh;                       // Drawing mesh
 
+        Vector<Vec2F> mLocalVertices;                   // Mesh vertices positions in sprite local space, (0, 0) is left bottom and (1, 1) is right top corner
+        Vec2F         mLocalVerticesSize;               // Size of sprite, for which local vertices were built
+        Vec2F         mLocalVerticesScale;              // Scale of sprite, for which local vertices were built
+        bool          mLocalVerticesValid = false;      // Are local vertices actual. Transform only changes reuse them instead of building mesh
+        RectI         mVisibleTiles = RectI(0, 0, INT_MAX, INT_MAX); // Range of tiles indices built in tiled mode. Tiles outside scissor and camera are not built
+
         void(Sprite::*mMeshBuildFunc)(); // Mesh building function pointer (by mode)
 
     protected:
@@ -216,9 +222,21 @@ namespace o2
         // Initialized texture by image: uses atlas part or texture
         void InitializeTexture();
 
-        // Updates mesh geometry
+        // Updates mesh geometry. Builds mesh in local space and transforms it into world
         void UpdateMesh();
 
+        // Transforms local vertices by current basis into mesh vertices
+        void TransformLocalVertices();
+
+        // Updates mesh vertices colors. Patches colors only when corners colors are equal, otherwise rebuilds mesh
+        void UpdateMeshColors();
+
+        // Updates range of visible tiles in tiled mode by current scissor and camera, rebuilds mesh when range changed
+        void UpdateVisibleTiles();
+
+        // Returns range of tiles indices visible inside current scissor rectangle and camera
+        RectI CalculateVisibleTiles() const;
+
         // Builds mesh for default mode
         void BuildDefaultMesh();
 
@@ -284,6 +302,11 @@ CLASS_FIELDS_META(o2::Sprite)
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(1.0f).NAME(mFill);
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(1.0f).NAME(mTileScale);
     FIELD().PROTECTED().NAME(mMesh);
+    FIELD().PROTECTED().NAME(mLocalVertices);
+    FIELD().PROTECTED().NAME(mLocalVerticesSize);
+    FIELD().PROTECTED().NAME(mLocalVerticesScale);
+    FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mLocalVerticesValid);
+    FIELD().PROTECTED().DEFAULT_VALUE(RectI(0, 0, INT_MAX, INT_MAX)).NAME(mVisibleTiles);
 }
 END_META;
 CLASS_METHODS_META(o2::Sprite)
@@ -342,6 +365,10 @@ CLASS_METHODS_META(o2::Sprite)
     FUNCTION().PROTECTED().SIGNATURE(void, BlendModeChanged);
     FUNCTION().PROTECTED().SIGNATURE(void, InitializeTexture);
     FUNCTION().PROTECTED().SIGNATURE(void, UpdateMesh);
+    FUNCTION().PROTECTED().SIGNATURE(void, TransformLocalVertices);
+    FUNCTION().PROTECTED().SIGNATURE(void, UpdateMeshColors);
+    FUNCTION().PROTECTED().SIGNATURE(void, UpdateVisibleTiles);
+    FUNCTION().PROTECTED().SIGNATURE(RectI, CalculateVisibleTiles);
     FUNCTION().PROTECTED().SIGNATURE(void, BuildDefaultMesh);
     FUNCTION().PROTECTED().SIGNATURE(void, BuildSlicedMesh);
     FUNCTION().PROTECTED().SIGNATURE(void, BuildTiledMesh);
@@ -281,6 +281,8 @@ namespace o2
         if (mUpdatingMesh)
             return;
 
+        mDrawingVersion++;
+
         mUpdatingMesh = true;
 
         if (!mFont)
@@ -449,6 +451,8 @@ namespace o2
         if (bas == Basis::Identity())
             return;
 
+        mDrawingVersion++;
+
         for (auto& mesh : mMeshes)
         {
             for (unsigned int i = 0; i < mesh->vertexCount; i++)
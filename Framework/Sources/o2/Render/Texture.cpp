@@ -57,7 +57,8 @@ namespace o2
 
     Texture::~Texture()
     {
-        if (!mReady)
+        // Texture can outlive render, then graphics API is already deinitialized
+        if (!mReady || !Render::IsSingletonInitialzed() || o2Render.IsHeadless())
             return;
 
         PlatformDestroy();
@@ -68,7 +69,9 @@ namespace o2
     {
         if (mReady)
         {
-            PlatformDestroy();
+            if (!o2Render.IsHeadless())
+                PlatformDestroy();
+
             mReady = false;
         }
 
@@ -76,12 +79,13 @@ namespace o2
         mUsage = usage;
         mSize = size;
 
-        mReady = PlatformCreate();
+        // In headless mode texture only keeps its parameters, there is no graphics API
+        mReady = o2Render.IsHeadless() || PlatformCreate();
     }
 
     void Texture::Create(const Vec2I& size, Byte* data, TextureFormat format /*= TextureFormat::R8G8B8A8*/)
     {
-        if (mReady)
+        if (mReady && !o2Render.IsHeadless())
         {
             if (mUsage == Usage::RenderTarget)
                 glDeleteFramebuffersEXT(1, &mFrameBuffer);
@@ -92,6 +96,13 @@ namespace o2
         mFormat = format;
         mUsage = Usage::Default;
         mSize = size;
+
+        if (o2Render.IsHeadless())
+        {
+            mReady = true;
+            return;
+        }
+
         mReady = PlatformCreate();
 
         if (mReady)
@@ -112,25 +123,32 @@ namespace o2
             return;
         }
 
-        PlatformUploadData(mSize, (Byte*)bitmap.GetData(), TextureFormat::R8G8B8A8);
+        if (!o2Render.IsHeadless())
+            PlatformUploadData(mSize, (Byte*)bitmap.GetData(), TextureFormat::R8G8B8A8);
     }
 
     void Texture::SetSubData(const Vec2I& offset, const Bitmap& bitmap)
     {
-        PlatformUploadRegionData(offset, bitmap.GetSize(), (Byte*)bitmap.GetData(), TextureFormat::R8G8B8A8);
+        if (!o2Render.IsHeadless())
+            PlatformUploadRegionData(offset, bitmap.GetSize(), (Byte*)bitmap.GetData(), TextureFormat::R8G8B8A8);
     }
 
     Ref<Bitmap> Texture::GetData()
     {
         auto bitmap = mmake<Bitmap>(PixelFormat::R8G8B8A8, mSize);
-        PlatformGetData((Byte*)bitmap->GetData());
+
+        if (!o2Render.IsHeadless())
+            PlatformGetData((Byte*)bitmap->GetData());
+
         return bitmap;
     }
 
     void Texture::SetFilter(Filter filter)
     {
         mFilter = filter;
-        PlatformSetFilter();
+
+        if (!o2Render.IsHeadless())
+            PlatformSetFilter();
     }
 
     Texture::Filter Texture::GetFilter() const
@@ -393,6 +393,9 @@ namespace o2
     {
         PROFILE_SAMPLE_FUNC();
 
+        if (mHeadless)
+            return;
+
         glClearColor(color.RF(), color.GF(), color.BF(), color.AF());
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
@@ -440,6 +443,9 @@ namespace o2
 
     void Render::ClearStencil()
     {
+        if (mHeadless)
+            return;
+
         glClearStencil(0);
         glClear(GL_STENCIL_BUFFER_BIT);
 
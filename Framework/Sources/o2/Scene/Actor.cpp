@@ -16,7 +16,7 @@ namespace o2
 
     Actor::Actor(RefCounter* refCounter, ActorTransform* transform, bool onScene /*= true*/, const String& name /*= "unnamed"*/, 
                  bool enabled /*= true*/, SceneUID id /*= Math::Random()*/, UID assetId /*= UID(0)*/) :
-        SceneEditableObject(refCounter), transform(transform), mName(name), mEnabled(enabled),
+        SceneEditableObject(refCounter), transform(transform), mName(name), mNameId(name), mEnabled(enabled),
         mResEnabled(enabled), mResEnabledInHierarchy(false), mId(id), mAssetId(assetId), mState(State::Initializing),
         mIsOnScene(onScene)
     {
@@ -44,7 +44,10 @@ namespace o2
 
         if (other.mIsAsset)
         {
-            other.mCopyVisitor = mmake<InstantiatePrototypeCloneVisitor>();
+            if (!other.mInstantiationTemplate)
+                other.mInstantiationTemplate = mmake<ActorInstantiationTemplate>();
+
+            other.mCopyVisitor = mmake<InstantiatePrototypeCloneVisitor>(other.mInstantiationTemplate);
             SetPrototype(AssetRef<ActorAsset>(other.GetAssetID()));
         }
 
@@ -143,6 +146,7 @@ namespace o2
         ISceneDrawable::operator=(other);
 
         mName = other.mName;
+        mNameId = other.mNameId;
         mEnabled = other.mEnabled;
         mResEnabled = mEnabled;
         mResEnabledInHierarchy = mEnabled;
@@ -314,6 +318,7 @@ namespace o2
     void Actor::SetName(const String& name)
     {
         mName = name;
+        mNameId = NameId(name);
 
 #if IS_EDITOR
         OnNameChanged();
@@ -325,6 +330,11 @@ namespace o2
         return mName;
     }
 
+    const NameId& Actor::GetNameId() const
+    {
+        return mNameId;
+    }
+
     SceneUID Actor::GetID() const
     {
         return mId;
@@ -582,9 +592,13 @@ namespace o2
             return nullptr;
         }
 
+        NameId pathPartId = NameId::Find(pathPart);
+        if (pathPartId.IsEmpty() && !pathPart.IsEmpty())
+            return nullptr;
+
         for (auto& child : mChildren)
         {
-            if (child->mName == pathPart)
+            if (child->mNameId == pathPartId)
             {
                 if (delPos == -1)
                     return child;
@@ -597,10 +611,19 @@ namespace o2
     }
 
     Ref<Actor> Actor::FindChild(const String& name) const
+    {
+        NameId nameId = NameId::Find(name);
+        if (nameId.IsEmpty() && !name.IsEmpty())
+            return nullptr;
+
+        return FindChild(nameId);
+    }
+
+    Ref<Actor> Actor::FindChild(const NameId& name) const
     {
         for (auto& child : mChildren)
         {
-            if (child->mName == name)
+            if (child->mNameId == name)
                 return child;
 
             if (auto res = child->FindChild(name))
@@ -992,6 +1015,8 @@ namespace o2
         else
             DeserializeRaw(node);
 
+        mNameId = NameId(mName);
+
         OnDeserialized(node);
     }
 
@@ -1338,6 +1363,11 @@ namespace o2
         return mPrototypeLink.Lock();
     }
 
+    void Actor::InvalidateInstantiationTemplate() const
+    {
+        mInstantiationTemplate = nullptr;
+    }
+
     void Actor::SetLayer(const Ref<SceneLayer>& layer)
     {
         mSceneLayer = layer;
@@ -1431,17 +1461,41 @@ namespace o2
         ActorRefResolver::RemapReferences(sourceToTargetActors, sourceToTargetComponents);
     }
 
+    Actor::InstantiatePrototypeCloneVisitor::InstantiatePrototypeCloneVisitor():
+        InstantiatePrototypeCloneVisitor(mmake<ActorInstantiationTemplate>())
+    {}
+
+    Actor::InstantiatePrototypeCloneVisitor::InstantiatePrototypeCloneVisitor(const Ref<ActorInstantiationTemplate>& instantiationTemplate):
+        instantiationTemplate(instantiationTemplate)
+    {
+        sourceActors.Reserve(instantiationTemplate->actors.Count());
+        targetActors.Reserve(instantiationTemplate->actors.Count());
+        sourceComponents.Reserve(instantiationTemplate->components.Count());
+        targetComponents.Reserve(instantiationTemplate->components.Count());
+    }
+
     void Actor::InstantiatePrototypeCloneVisitor::OnCopyActor(const Actor* source, Actor* target)
     {
-        SourceToTargetMapCloneVisitor::OnCopyActor(source, target);
+        sourceActors.Add(source);
+        targetActors.Add(target);
         target->mPrototypeLink = Ref(const_cast<Actor*>(source));
     }
 
     void Actor::InstantiatePrototypeCloneVisitor::OnCopyComponent(const Component* source, Component* target)
     {
-        SourceToTargetMapCloneVisitor::OnCopyComponent(source, target);
+        sourceComponents.Add(source);
+        targetComponents.Add(target);
         target->mPrototypeLink = Ref(const_cast<Component*>(source));
     }
+
+    void Actor::InstantiatePrototypeCloneVisitor::Finalize()
+    {
+        // Prototype hierarchy was changed since template compilation, or it is first instantiation
+        if (!instantiationTemplate->IsMatching(sourceActors, sourceComponents))
+            instantiationTemplate->Compile(sourceActors, sourceComponents);
+
+        ActorRefResolver::RemapReferences(*instantiationTemplate, targetActors, targetComponents);
+    }
 }
 // --- META ---
 
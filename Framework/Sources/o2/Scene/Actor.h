@@ -1,6 +1,7 @@
 #pragma once
 
 #include "o2/Assets/Types/ActorAsset.h"
+#include "o2/Scene/ActorInstantiationTemplate.h"
 #include "o2/Scene/ActorLinkRef.h"
 #include "o2/Scene/ActorTransform.h"
 #include "o2/Scene/Component.h"
@@ -8,6 +9,7 @@
 #include "o2/Scene/ISceneDrawable.h"
 #include "o2/Scene/Tags.h"
 #include "o2/Utils/Editor/SceneEditableObject.h"
+#include "o2/Utils/Types/NameId.h"
 
 #if IS_SCRIPTING_SUPPORTED
 #include "o2/Scripts/ScriptValue.h"
@@ -121,6 +123,9 @@ namespace o2
         // Returns name @SCRIPTABLE
         const String& GetName() const OPTIONAL_OVERRIDE;
 
+        // Returns interned name, compared by pointer
+        const NameId& GetNameId() const;
+
         // Returns actor's unique id
         SceneUID GetID() const OPTIONAL_OVERRIDE;
 
@@ -148,6 +153,9 @@ namespace o2
         // Returns prototype link pointer
         Ref<Actor> GetPrototypeLink() const;
 
+        // Resets compiled instantiation template. Must be called when asset actor hierarchy is changed
+        void InvalidateInstantiationTemplate() const;
+
         // Sets scene layer
         void SetLayer(const Ref<SceneLayer>& layer);
 
@@ -208,6 +216,9 @@ namespace o2
         // Returns child actor by name @SCRIPTABLE
         Ref<Actor> FindChild(const String& name) const;
 
+        // Returns child actor by interned name
+        Ref<Actor> FindChild(const NameId& name) const;
+
         // Returns child actor by predicate
         Ref<Actor> FindChild(const Function<bool(const Ref<Actor>& child)>& pred) const;
 
@@ -329,17 +340,30 @@ namespace o2
             void Finalize() override;
         };
 
-        struct InstantiatePrototypeCloneVisitor: public SourceToTargetMapCloneVisitor
+        struct InstantiatePrototypeCloneVisitor: public ICopyVisitor
         {
+            Ref<ActorInstantiationTemplate> instantiationTemplate; // Compiled template of instantiating prototype
+
+            Vector<const Actor*>     sourceActors;     // Copied prototype actors in copying order
+            Vector<Actor*>           targetActors;     // Created actors in copying order
+            Vector<const Component*> sourceComponents; // Copied prototype components in copying order
+            Vector<Component*>       targetComponents; // Created components in copying order
+
+        public:
+            InstantiatePrototypeCloneVisitor();
+            InstantiatePrototypeCloneVisitor(const Ref<ActorInstantiationTemplate>& instantiationTemplate);
+
             void OnCopyActor(const Actor* source, Actor* target) override;
             void OnCopyComponent(const Component* source, Component* target) override;
+            void Finalize() override;
         };
 
     protected:
         static ActorCreateMode mDefaultCreationMode;   // Default mode creation
 
-        SceneUID mId;   // Unique actor id
-        String   mName; // Name of actor @SERIALIZABLE
+        SceneUID mId;     // Unique actor id
+        String   mName;   // Name of actor @SERIALIZABLE
+        NameId   mNameId; // Interned name of actor, updated together with mName. Used for searching by name
 
         Ref<SceneLayer> mSceneLayer; // Scene layer @SERIALIZABLE @EDITOR_IGNORE
 
@@ -366,6 +390,8 @@ namespace o2
 
         mutable Ref<ICopyVisitor> mCopyVisitor; // Copy visitor. Called when copying actor and calls on actor or component copying
 
+        mutable Ref<ActorInstantiationTemplate> mInstantiationTemplate; // Compiled instantiation template. Used when actor is asset
+
     protected:
         // Base actor constructor with transform
         Actor(RefCounter* refCounter, ActorTransform* transform, bool onScene = true, const String& name = "unnamed", bool enabled = true,
@@ -795,6 +821,7 @@ CLASS_FIELDS_META(o2::Actor)
     FIELD().PUBLIC().ANIMATABLE_ATTRIBUTE().EDITOR_IGNORE_ATTRIBUTE().NAME(transform);
     FIELD().PROTECTED().NAME(mId);
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mName);
+    FIELD().PROTECTED().NAME(mNameId);
     FIELD().PROTECTED().EDITOR_IGNORE_ATTRIBUTE().SERIALIZABLE_ATTRIBUTE().NAME(mSceneLayer);
     FIELD().PROTECTED().NAME(mPrototype);
     FIELD().PROTECTED().NAME(mPrototypeLink);
@@ -809,6 +836,7 @@ CLASS_FIELDS_META(o2::Actor)
     FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mIsAsset);
     FIELD().PROTECTED().NAME(mAssetId);
     FIELD().PROTECTED().NAME(mCopyVisitor);
+    FIELD().PROTECTED().NAME(mInstantiationTemplate);
 #if  IS_EDITOR
     FIELD().PUBLIC().EDITOR_IGNORE_ATTRIBUTE().NAME(locked);
     FIELD().PUBLIC().NAME(lockedInHierarchy);
@@ -849,6 +877,7 @@ CLASS_METHODS_META(o2::Actor)
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, UpdateChildrenTransforms);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, SetName, const String&);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(const String&, GetName);
+    FUNCTION().PUBLIC().SIGNATURE(const NameId&, GetNameId);
     FUNCTION().PUBLIC().SIGNATURE(SceneUID, GetID);
     FUNCTION().PUBLIC().SIGNATURE(void, SetID, SceneUID);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, GenerateNewID, bool);
@@ -858,6 +887,7 @@ CLASS_METHODS_META(o2::Actor)
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(AssetRef<ActorAsset>, GetPrototype);
     FUNCTION().PUBLIC().SIGNATURE(AssetRef<ActorAsset>, GetPrototypeDirectly);
     FUNCTION().PUBLIC().SIGNATURE(Ref<Actor>, GetPrototypeLink);
+    FUNCTION().PUBLIC().SIGNATURE(void, InvalidateInstantiationTemplate);
     FUNCTION().PUBLIC().SIGNATURE(void, SetLayer, const Ref<SceneLayer>&);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, SetLayer, const String&);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(const Ref<SceneLayer>&, GetLayer);
@@ -878,6 +908,7 @@ CLASS_METHODS_META(o2::Actor)
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(Ref<Actor>, AddChild, const Ref<Actor>&, int);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(Ref<Actor>, GetChild, const String&);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(Ref<Actor>, FindChild, const String&);
+    FUNCTION().PUBLIC().SIGNATURE(Ref<Actor>, FindChild, const NameId&);
     FUNCTION().PUBLIC().SIGNATURE(Ref<Actor>, FindChild, const Function<bool(const Ref<Actor>& child)>&);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(const Vector<Ref<Actor>>&, GetChildren);
     FUNCTION().PUBLIC().SIGNATURE(void, GetAllChildrenActors, Vector<Ref<Actor>>&);
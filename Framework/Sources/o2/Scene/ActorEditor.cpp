@@ -134,6 +134,9 @@ namespace o2
         diffs.removedComponents.ForEach([&](auto d) { d->Apply(thisApplyInfo, prototypeApplyInfo, linkedActorsApplyInfos); });
         diffs.removedChildren.ForEach([&](auto d) { d->Apply(thisApplyInfo, prototypeApplyInfo, linkedActorsApplyInfos); });
 
+        // Prototype hierarchy could be changed, its instantiation template must be recompiled
+        mPrototype->GetActor()->InvalidateInstantiationTemplate();
+
         // Invoke changed callback for actors and save assets
         for (auto& info : linkedActorsApplyInfos)
         {
@@ -419,6 +422,7 @@ namespace o2
                                  Vector<ISerializable*>& serializableObjects)
     {
         dest->mName = source->mName;
+        dest->mNameId = source->mNameId;
         dest->mEnabled = source->mEnabled;
         *dest->transform = *source->transform;
         dest->mAssetId = source->mAssetId;
@@ -591,7 +595,10 @@ namespace o2
         }
 
         if (source->mName != changed->mName && dest->mName == source->mName)
+        {
             dest->mName = changed->mName;
+            dest->mNameId = changed->mNameId;
+        }
 
         if (source->mEnabled != changed->mEnabled && dest->mEnabled == source->mEnabled)
             dest->mEnabled = changed->mEnabled;
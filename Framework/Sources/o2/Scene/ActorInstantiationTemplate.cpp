@@ -0,0 +1,43 @@
+#include "o2/stdafx.h"
+#include "ActorInstantiationTemplate.h"
+
+namespace o2
+{
+    bool ActorInstantiationTemplate::IsMatching(const Vector<const Actor*>& copiedActors,
+                                                const Vector<const Component*>& copiedComponents) const
+    {
+        return actors == copiedActors && components == copiedComponents;
+    }
+
+    void ActorInstantiationTemplate::Compile(const Vector<const Actor*>& copiedActors,
+                                             const Vector<const Component*>& copiedComponents)
+    {
+        actors = copiedActors;
+        components = copiedComponents;
+
+        actorsIndices.clear();
+        actorsIndices.reserve(actors.Count());
+        for (int i = 0; i < actors.Count(); i++)
+            actorsIndices.emplace(actors[i], i);
+
+        componentsIndices.clear();
+        componentsIndices.reserve(components.Count());
+        for (int i = 0; i < components.Count(); i++)
+            componentsIndices.emplace(components[i], i);
+
+        actorsRefsRemapIndices.Clear();
+        componentsRefsRemapIndices.Clear();
+    }
+
+    int ActorInstantiationTemplate::GetActorIndex(const Actor* actor) const
+    {
+        auto fnd = actorsIndices.find(actor);
+        return fnd != actorsIndices.end() ? fnd->second : -1;
+    }
+
+    int ActorInstantiationTemplate::GetComponentIndex(const Component* component) const
+    {
+        auto fnd = componentsIndices.find(component);
+        return fnd != componentsIndices.end() ? fnd->second : -1;
+    }
+}
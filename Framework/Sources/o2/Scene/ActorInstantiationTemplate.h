@@ -0,0 +1,42 @@
+#pragma once
+
+#include <unordered_map>
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/Ref.h"
+
+namespace o2
+{
+    class Actor;
+    class Component;
+
+    // -------------------------------------------------------------------------------------------------------------
+    // Compiled instantiation template of prototype. Contains flat lists of prototype actors and components in copying
+    // order, their indices and pre-resolved indices of references remapping targets. Created actors and components are
+    // collected in same order, so remapping references is done by index instead of searching copied objects maps.
+    // Compiled by first instantiation and recompiled when prototype copying order changes
+    // -------------------------------------------------------------------------------------------------------------
+    struct ActorInstantiationTemplate: public RefCounterable
+    {
+        Vector<const Actor*>     actors;     // Prototype actors in copying order
+        Vector<const Component*> components; // Prototype components in copying order
+
+        std::unordered_map<const Actor*, int>     actorsIndices;     // Index of prototype actor in actors
+        std::unordered_map<const Component*, int> componentsIndices; // Index of prototype component in components
+
+        Vector<int> actorsRefsRemapIndices;     // Indices of actors in remapping order of actor references, -1 for external
+        Vector<int> componentsRefsRemapIndices; // Indices of components in remapping order of component references, -1 for external
+
+    public:
+        // Returns true when prototype actors and components are copied in same order as compiled
+        bool IsMatching(const Vector<const Actor*>& copiedActors, const Vector<const Component*>& copiedComponents) const;
+
+        // Compiles template from prototype actors and components in copying order. Resets remapping indices
+        void Compile(const Vector<const Actor*>& copiedActors, const Vector<const Component*>& copiedComponents);
+
+        // Returns index of prototype actor. Returns -1 if actor isn't from prototype
+        int GetActorIndex(const Actor* actor) const;
+
+        // Returns index of prototype component. Returns -1 if component isn't from prototype
+        int GetComponentIndex(const Component* component) const;
+    };
+}
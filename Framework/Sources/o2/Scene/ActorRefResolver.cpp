@@ -2,6 +2,7 @@
 #include "ActorRefResolver.h"
 
 #include "o2/Scene/Actor.h"
+#include "o2/Scene/ActorInstantiationTemplate.h"
 #include "o2/Scene/ActorLinkRef.h"
 #include "o2/Scene/Scene.h"
 
@@ -103,6 +104,45 @@ namespace o2
         mInstance->mRemapComponents.Clear();
     }
 
+    void ActorRefResolver::RemapReferences(ActorInstantiationTemplate& instantiationTemplate, const Vector<Actor*>& actors,
+                                           const Vector<Component*>& components)
+    {
+        if (!mInstance)
+            return;
+
+        // Learned index is used when it points to same prototype object, otherwise index is searched and stored
+        auto remap = [](auto& refs, auto& remapIndices, auto& sources, auto& targets, auto getIndex)
+        {
+            while (remapIndices.Count() < refs.Count())
+                remapIndices.Add(-1);
+
+            for (int i = 0; i < refs.Count(); i++)
+            {
+                auto ref = refs[i];
+                auto source = ref->Get();
+
+                int idx = remapIndices[i];
+                if (idx < 0 || idx >= sources.Count() || sources[idx] != source)
+                {
+                    idx = getIndex(source);
+                    remapIndices[i] = idx;
+                }
+
+                if (idx >= 0 && idx < targets.Count())
+                    ref->Set(targets[idx]);
+            }
+        };
+
+        remap(mInstance->mRemapActors, instantiationTemplate.actorsRefsRemapIndices, instantiationTemplate.actors, actors,
+              [&](const Actor* actor) { return instantiationTemplate.GetActorIndex(actor); });
+
+        remap(mInstance->mRemapComponents, instantiationTemplate.componentsRefsRemapIndices, instantiationTemplate.components,
+              components, [&](const Component* component) { return instantiationTemplate.GetComponentIndex(component); });
+
+        mInstance->mRemapActors.Clear();
+        mInstance->mRemapComponents.Clear();
+    }
+
     void ActorRefResolver::RequireRemap(BaseActorLinkRef& ref)
     {
         if (!mInstance)
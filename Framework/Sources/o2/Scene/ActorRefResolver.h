@@ -7,6 +7,8 @@
 
 namespace o2
 {
+    struct ActorInstantiationTemplate;
+
     // -------------------------
     // Actor data node converter
     // -------------------------
@@ -52,6 +54,11 @@ namespace o2
         // Remaps required refs 
         static void RemapReferences(const Map<const Actor*, Actor*>& actors, const Map<const Component*, Component*>& components);
 
+        // Remaps required refs by compiled instantiation template. Actors and components are created copies in template
+        // order. Remapping indices are learned by template and checked for each reference
+        static void RemapReferences(ActorInstantiationTemplate& instantiationTemplate, const Vector<Actor*>& actors,
+                                    const Vector<Component*>& components);
+
         // Called when new actor was created
         static void ActorCreated(Actor* actor);
 
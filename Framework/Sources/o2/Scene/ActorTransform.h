@@ -475,6 +475,7 @@ namespace o2
         Vec2F GetParentPosition() const;
 
         friend class Actor;
+        friend class PhysicsWorld;
         friend class WidgetLayout;
     };
 
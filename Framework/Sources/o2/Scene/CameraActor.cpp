@@ -4,6 +4,7 @@
 #include "o2/Scene/Scene.h"
 #include "o2/Scene/ISceneDrawable.h"
 #include "o2/Render/Render.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 #include "Component.h"
 
 namespace o2
@@ -58,51 +59,64 @@ namespace o2
 
             for (auto& layer : drawLayers.GetLayers())
             {
-                o2Debug.Log("== Layer " + layer->GetName() + " ==");
-
-                Function<void(const Ref<ISceneDrawable>&, int)> printDrawable = [&printDrawable](const Ref<ISceneDrawable>& drawable, int depth)
+                struct helper
                 {
-                    String str;
-                    for (int i = 0; i < depth; i++)
-                        str += "  ";
-
-                    str += "(" + drawable->GetType().GetName() + ") ";
-                    auto actor = DynamicCast<Actor>(drawable);
-                    if (!actor)
+                    static void PrintDrawable(FrameString& dump, const Ref<ISceneDrawable>& drawable, int depth)
                     {
-                        if (auto component = DynamicCast<Component>(drawable))
-                            actor = component->GetActor();
-                    }
+                        for (int i = 0; i < depth; i++)
+                            dump += "  ";
 
-                    while (actor)
-                    {
-                        str += actor->GetName();
-                        if (actor->GetParent())
-                            str += " #" + (String)(actor->GetParent().Lock()->GetChildren().IndexOf(actor)) + "/";
+                        dump += "(";
+                        dump += drawable->GetType().GetName().Data();
+                        dump += ") ";
 
-                        actor = actor->GetParent().Lock();
-                    }
+                        auto actor = DynamicCast<Actor>(drawable);
+                        if (!actor)
+                        {
+                            if (auto component = DynamicCast<Component>(drawable))
+                                actor = component->GetActor();
+                        }
+
+                        while (actor)
+                        {
+                            dump += actor->GetName().Data();
+                            if (actor->GetParent())
+                            {
+                                char idxBuffer[16];
+                                snprintf(idxBuffer, sizeof(idxBuffer), " #%i/", actor->GetParent().Lock()->GetChildren().IndexOf(actor));
+                                dump += idxBuffer;
+                            }
+
+                            actor = actor->GetParent().Lock();
+                        }
 
-                    o2Debug.Log(str);
+                        dump += "\n";
 
-                    for (auto& inherited : drawable->GetChildrenInheritedDepth())
-                        printDrawable(inherited, depth + 1);
+                        for (auto& inherited : drawable->GetChildrenInheritedDepth())
+                            PrintDrawable(dump, inherited, depth + 1);
+                    }
                 };
 
-                for (auto& drawable : layer->mDrawables)
-                {                    
-                    printDrawable(drawable, 1);
+                // Whole layer dump is built in frame memory and converted into log string once
+                FrameString dump;
+                dump += "== Layer ";
+                dump += layer->GetName().Data();
+                dump += " ==\n";
+
+                for (auto& drawable : layer->GetDrawables())
+                {
+                    helper::PrintDrawable(dump, drawable, 1);
 
                     if (auto root = DynamicCast<SceneLayerRootDrawablesContainer>(drawable))
                     {
-                        o2Debug.Log("  ROOT:");
+                        dump += "  ROOT:\n";
 
                         for (auto& child : root->GetChildrenInheritedDepth())
-                        {
-                            printDrawable(child, 2);
-                        }
+                            helper::PrintDrawable(dump, child, 2);
                     }
                 }
+
+                o2Debug.LogStr(dump.c_str());
             }
         }
 
@@ -111,8 +125,12 @@ namespace o2
 
             for (auto& layer : drawLayers.GetLayers())
             {
-                for (auto& comp : layer->mDrawables)
-                    comp->Draw();
+                // Drawables can be unregistered while drawing, their slots are nulled until next frame
+                for (auto& comp : layer->GetDrawables())
+                {
+                    if (comp)
+                        comp->Draw();
+                }
             }
         }
 
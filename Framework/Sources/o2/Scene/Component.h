@@ -112,6 +112,8 @@ namespace o2 {
         bool mEnabled = true;             // Is component enabled @SERIALIZABLE @EDITOR_IGNORE
         bool mEnabledInHierarchy = false; // Is component enabled in hierarchy
 
+        int mSceneRegistryIndex = -1; // Index in scene components registry list of its type. -1 when not registered
+
     protected:
         // Beginning serialization callback
         void OnSerialize(DataValue& node) const override;
@@ -252,6 +254,7 @@ CLASS_FIELDS_META(o2::Component)
     FIELD().PROTECTED().NAME(mPrototypeLink);
     FIELD().PROTECTED().EDITOR_IGNORE_ATTRIBUTE().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(mEnabled);
     FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mEnabledInHierarchy);
+    FIELD().PROTECTED().DEFAULT_VALUE(-1).NAME(mSceneRegistryIndex);
 }
 END_META;
 CLASS_METHODS_META(o2::Component)
@@ -250,9 +250,11 @@ namespace o2
 
     void AnimationComponent::UnregTrack(const Ref<IAnimationTrack::IPlayer>& player, const String& path)
     {
+        NameId pathId = NameId::Find(path);
+
         for (auto& val : mValues)
         {
-            if (val->path == path)
+            if (val->path == pathId)
             {
                 val->RemoveTrack(player.Get());
 
@@ -304,7 +306,7 @@ namespace o2
         AnimationState* firstValueState = tracks[0].first;
         AnimationTrack<int>::Player* firstValue = tracks[0].second;
 
-        float weightsSum = firstValueState->mWeight*firstValueState->mask.GetNodeWeight(path);
+        float weightsSum = firstValueState->mWeight*firstValueState->mask.GetNodeWeight(path.GetString());
         float valueSum = (float)firstValue->GetValue();
 
         for (int i = 1; i < tracks.Count(); i++)
@@ -312,7 +314,7 @@ namespace o2
             AnimationState* valueState = tracks[i].first;
             AnimationTrack<int>::Player* value = tracks[i].second;
 
-            weightsSum += valueState->mWeight*valueState->mask.GetNodeWeight(path);
+            weightsSum += valueState->mWeight*valueState->mask.GetNodeWeight(path.GetString());
             valueSum += (float)value->GetValue();
         }
 
@@ -326,7 +328,7 @@ namespace o2
         AnimationState* firstValueState = tracks[0].first;
         AnimationTrack<bool>::Player* firstValue = tracks[0].second;
 
-        float weightsSum = firstValueState->mWeight*firstValueState->mask.GetNodeWeight(path);
+        float weightsSum = firstValueState->mWeight*firstValueState->mask.GetNodeWeight(path.GetString());
         float valueSum = firstValue->GetValue() ? 1.0f : 0.0f;
 
         for (int i = 1; i < tracks.Count(); i++)
@@ -334,7 +336,7 @@ namespace o2
             AnimationState* valueState = tracks[i].first;
             AnimationTrack<bool>::Player* value = tracks[i].second;
 
-            weightsSum += valueState->mWeight*valueState->mask.GetNodeWeight(path);
+            weightsSum += valueState->mWeight*valueState->mask.GetNodeWeight(path.GetString());
             valueSum += value->GetValue() ? 1.0f : 0.0f;
         }
 
@@ -9,6 +9,7 @@
 #include "o2/Utils/Editor/Attributes/DefaultTypeAttribute.h"
 #include "o2/Utils/Editor/Attributes/DontDeleteAttribute.h"
 #include "o2/Utils/Editor/Attributes/InvokeOnChangeAttribute.h"
+#include "o2/Utils/Types/NameId.h"
 
 namespace o2
 {
@@ -119,8 +120,8 @@ namespace o2
         // -------------------------------
         struct ITrackMixer: public RefCounterable
         {
-            // Value path
-            String path;
+            // Interned value path, mixers are searched by path when tracks are registering
+            NameId path;
 
         public:
             virtual ~ITrackMixer() {}
@@ -256,9 +257,11 @@ namespace o2
     template<typename _valueType, typename _trackType, typename _mixerType>
     void AnimationComponent::RegTrack(const Ref<typename _trackType::Player>& player, const String& path, const Ref<AnimationState>& state)
     {
+        NameId pathId(path);
+
         for (auto& val : mValues)
         {
-            if (val->path == path)
+            if (val->path == pathId)
             {
                 auto agent = DynamicCast<_mixerType>(val);
 
@@ -275,7 +278,7 @@ namespace o2
 
         auto newAgent = mmake<_mixerType>();
         mValues.Add(newAgent);
-        newAgent->path = path;
+        newAgent->path = pathId;
         newAgent->tracks.Add({ state.Get(), player.Get() });
 
         const FieldInfo* fieldInfo = nullptr;
@@ -326,7 +329,7 @@ namespace o2
         auto firstValueState = tracks[0].first;
         auto firstValue = tracks[0].second;
 
-        float weightsSum = firstValueState->mWeight*firstValueState->mask.GetNodeWeight(path);
+        float weightsSum = firstValueState->mWeight*firstValueState->mask.GetNodeWeight(path.GetString());
         _type valueSum = firstValue->GetValue();
 
         for (int i = 1; i < tracks.Count(); i++)
@@ -334,7 +337,7 @@ namespace o2
             auto valueState = tracks[i].first;
             auto value = tracks[i].second;
 
-            weightsSum += valueState->mWeight*valueState->mask.GetNodeWeight(path);
+            weightsSum += valueState->mWeight*valueState->mask.GetNodeWeight(path.GetString());
             valueSum += value->GetValue();
         }
 
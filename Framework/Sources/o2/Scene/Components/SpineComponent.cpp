@@ -1,6 +1,8 @@
 #include "o2/stdafx.h"
 #include "SpineComponent.h"
 
+#include "o2/Render/Spine/SpineManager.h"
+
 namespace o2
 {
     SpineComponent::SpineComponent()
@@ -85,8 +87,9 @@ namespace o2
     {
         AnimationComponent::OnUpdate(dt);
 
+        // Spine is updated in batch with other spines while scene updates actors, otherwise immediately
         if (mSpineRenderer)
-            mSpineRenderer->Update(dt);
+            SpineManager::Instance().ScheduleUpdate(mSpineRenderer, dt);
     }
 
     void SpineComponent::OnDraw()
@@ -68,6 +68,10 @@ namespace o2
         WeakRef<ISceneDrawable> mParentRegistry; // Parent registry drawable if inherited depth is used
         WeakRef<SceneLayer>     mLayerRegistry;  // Layer registry if inherited depth isn't used
 
+        int    mLayerDrawableIdx = -1; // Index in layer sorted drawables, -1 when isn't there
+        int    mLayerPendingIdx = -1;  // Index in layer pending drawables, -1 when isn't there
+        UInt64 mLayerDrawOrder = 0;    // Registration order in layer. Orders drawables with same depth
+
     protected:
         float mDrawingDepth = 0.0f;                  // Drawing depth. Objects with higher depth will be drawn later @SERIALIZABLE
         bool  mInheritDrawingDepthFromParent = true; // If parent depth is used @SERIALIZABLE
@@ -164,6 +168,9 @@ CLASS_FIELDS_META(o2::ISceneDrawable)
     FIELD().PRIVATE().DEFAULT_VALUE(false).NAME(mIsOnScene);
     FIELD().PRIVATE().NAME(mParentRegistry);
     FIELD().PRIVATE().NAME(mLayerRegistry);
+    FIELD().PRIVATE().DEFAULT_VALUE(-1).NAME(mLayerDrawableIdx);
+    FIELD().PRIVATE().DEFAULT_VALUE(-1).NAME(mLayerPendingIdx);
+    FIELD().PRIVATE().DEFAULT_VALUE(0).NAME(mLayerDrawOrder);
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(0.0f).NAME(mDrawingDepth);
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(true).NAME(mInheritDrawingDepthFromParent);
     FIELD().PROTECTED().NAME(mChildrenInheritedDepth);
@@ -41,6 +41,8 @@ namespace o2
     {
         mFriction = value;
 
+        RigidBody::WaitPhysicsStep();
+
         if (mFixture)
             mFixture->SetFriction(mFriction);
     }
@@ -54,6 +56,8 @@ namespace o2
     {
         mDensity = value;
 
+        RigidBody::WaitPhysicsStep();
+
         if (mFixture)
             mFixture->SetDensity(mDensity);
     }
@@ -67,6 +71,8 @@ namespace o2
     {
         mRestitution = value;
 
+        RigidBody::WaitPhysicsStep();
+
         if (mFixture)
             mFixture->SetRestitution(mRestitution);
     }
@@ -90,6 +96,8 @@ namespace o2
     {
         mIsSensor = value;
 
+        RigidBody::WaitPhysicsStep();
+
         if (mFixture)
             mFixture->SetSensor(mIsSensor);
     }
@@ -131,6 +139,7 @@ namespace o2
             return;
         }
 
+        RigidBody::WaitPhysicsStep();
         mFixture = body->mBody->CreateFixture(&fixture);
         mRigidBodyComp = body;
     }
@@ -138,6 +147,7 @@ namespace o2
     void ICollider::RemoveFromRigidBody()
     {
         if (mRigidBodyComp && mRigidBodyComp->mBody) {
+            RigidBody::WaitPhysicsStep();
             mRigidBodyComp->mBody->DestroyFixture(mFixture);
         }
 
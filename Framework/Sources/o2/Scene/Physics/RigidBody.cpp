@@ -47,6 +47,8 @@ namespace o2
     {
         mBodyType = type;
 
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetType(GetBodyType(type));
     }
@@ -67,6 +69,8 @@ namespace o2
         mMassData.mass = mMass;
         mMassData.I = mInertia;
 
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetMassData(&mMassData);
     }
@@ -82,6 +86,8 @@ namespace o2
         mMassData.mass = mMass;
         mMassData.I = mInertia;
 
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetMassData(&mMassData);
     }
@@ -93,12 +99,16 @@ namespace o2
 
     void RigidBody::SetLinearVelocity(const Vec2F& velocity)
     {
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetLinearVelocity(velocity);
     }
 
     Vec2F RigidBody::GetLinearVelocity() const
     {
+        WaitPhysicsStep();
+
         if (mBody)
             return mBody->GetLinearVelocity();
 
@@ -107,12 +117,16 @@ namespace o2
 
     void RigidBody::SetAngularVelocity(float velocity)
     {
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetAngularVelocity(velocity);
     }
 
     float RigidBody::GetAngularVelocity() const
     {
+        WaitPhysicsStep();
+
         if (mBody)
             return mBody->GetAngularVelocity();
 
@@ -123,6 +137,8 @@ namespace o2
     {
         mLinearDamping = damping;
 
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetLinearDamping(damping);
     }
@@ -136,6 +152,8 @@ namespace o2
     {
         mAngularDamping = damping;
 
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetAngularDamping(damping);
     }
@@ -149,6 +167,8 @@ namespace o2
     {
         mGravityScale = scale;
 
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetGravityScale(scale);
     }
@@ -162,6 +182,8 @@ namespace o2
     {
         mIsBullet = isBullet;
 
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetBullet(isBullet);
     }
@@ -173,12 +195,16 @@ namespace o2
 
     void RigidBody::SetIsSleeping(bool isSleeping)
     {
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetAwake(!isSleeping);
     }
 
     bool RigidBody::IsSleeping() const
     {
+        WaitPhysicsStep();
+
         if (mBody)
             return !mBody->IsAwake();
 
@@ -189,6 +215,8 @@ namespace o2
     {
         mIsFixedRotation = isFixedRotation;
 
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetFixedRotation(isFixedRotation);
     }
@@ -202,6 +230,8 @@ namespace o2
     {
         Actor::OnEnabled();
 
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetActive(true);
     }
@@ -210,6 +240,8 @@ namespace o2
     {
         Actor::OnDisabled();
 
+        WaitPhysicsStep();
+
         if (mBody)
             mBody->SetActive(false);
     }
@@ -236,6 +268,8 @@ namespace o2
         mMassData.mass = mMass;
         mMassData.I = mInertia;
 
+        WaitPhysicsStep();
+
         mBody = PhysicsWorld::Instance().mWorld.CreateBody(&def);
         mBody->SetMassData(&mMassData);
         mBody->SetType(mBodyType == Type::Dynamic ? b2_dynamicBody : (mBodyType == Type::Kinematic ? b2_kinematicBody : b2_staticBody));
@@ -244,10 +278,15 @@ namespace o2
         mBody->SetGravityScale(mGravityScale);
         mBody->SetBullet(mIsBullet);
         mBody->SetFixedRotation(mIsFixedRotation);
+
+        mIsSynced = false;
+        mWasAwake = true;
     }
 
     void RigidBody::RemoveBody()
     {
+        WaitPhysicsStep();
+
         if (mBody)
         {
             PhysicsWorld::Instance().mWorld.DestroyBody(mBody);
@@ -255,6 +294,12 @@ namespace o2
         }
     }
 
+    void RigidBody::WaitPhysicsStep()
+    {
+        if (PhysicsWorld::IsSingletonInitialzed())
+            o2Physics.WaitThreadedStep();
+    }
+
     void RigidBody::AddCollider(ICollider* collider)
     {
         if (mColliders.Contains(Ref(collider)))
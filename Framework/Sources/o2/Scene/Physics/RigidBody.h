@@ -127,6 +127,19 @@ namespace o2
 
         Vector<WeakRef<ICollider>> mColliders; // Attached colliders list
 
+        Vec2F mSyncedPosition;        // Actor's local position at last synchronization with body
+        float mSyncedAngle = 0.0f;    // Actor's local angle at last synchronization with body
+        Basis mSyncedParentTransform; // Actor's parent world transform at last synchronization with body
+        bool  mIsSynced = false;      // Is body synchronized with actor at least once
+        bool  mWasAwake = false;      // Was body awake at previous physics step
+        int   mIslandMarkStep = 0;    // Index of marking, when body was marked while counting awake islands
+
+        Vec2F mPrevStepPosition;      // Body's world position before last threaded step
+        float mPrevStepAngle = 0.0f;  // Body's world angle before last threaded step
+        Vec2F mStepPosition;          // Body's world position after last threaded step
+        float mStepAngle = 0.0f;      // Body's world angle after last threaded step
+        int   mStepStatesIndex = 0;   // Index of threaded step, when body states were captured
+
     protected:
         // Called when enabled, turns on rigid body
         void OnEnabled() override;
@@ -146,6 +159,9 @@ namespace o2
         // Removes body
         void RemoveBody();
 
+        // Waits physics world threaded step, so body can be accessed from main thread
+        static void WaitPhysicsStep();
+
         // Adds collider to body
         void AddCollider(ICollider* collider);
 
@@ -192,6 +208,17 @@ CLASS_FIELDS_META(o2::RigidBody)
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(mIsBullet);
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(mIsFixedRotation);
     FIELD().PROTECTED().NAME(mColliders);
+    FIELD().PROTECTED().NAME(mSyncedPosition);
+    FIELD().PROTECTED().DEFAULT_VALUE(0.0f).NAME(mSyncedAngle);
+    FIELD().PROTECTED().NAME(mSyncedParentTransform);
+    FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mIsSynced);
+    FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mWasAwake);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mIslandMarkStep);
+    FIELD().PROTECTED().NAME(mPrevStepPosition);
+    FIELD().PROTECTED().DEFAULT_VALUE(0.0f).NAME(mPrevStepAngle);
+    FIELD().PROTECTED().NAME(mStepPosition);
+    FIELD().PROTECTED().DEFAULT_VALUE(0.0f).NAME(mStepAngle);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mStepStatesIndex);
 }
 END_META;
 CLASS_METHODS_META(o2::RigidBody)
@@ -227,6 +254,7 @@ CLASS_METHODS_META(o2::RigidBody)
     FUNCTION().PROTECTED().SIGNATURE(void, OnRemoveFromScene);
     FUNCTION().PROTECTED().SIGNATURE(void, CreateBody);
     FUNCTION().PROTECTED().SIGNATURE(void, RemoveBody);
+    FUNCTION().PROTECTED().SIGNATURE_STATIC(void, WaitPhysicsStep);
     FUNCTION().PROTECTED().SIGNATURE(void, AddCollider, ICollider*);
     FUNCTION().PROTECTED().SIGNATURE(void, RemoveCollider, ICollider*);
     FUNCTION().PROTECTED().SIGNATURE_STATIC(b2BodyType, GetBodyType, Type);
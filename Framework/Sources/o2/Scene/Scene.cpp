@@ -6,6 +6,7 @@
 #include "o2/Assets/Types/ActorAsset.h"
 #include "o2/Physics/PhysicsWorld.h"
 #include "o2/Render/Render.h"
+#include "o2/Render/Spine/SpineManager.h"
 #include "o2/Render/Text.h"
 #include "o2/Render/VectorFontEffects.h"
 #include "o2/Scene/Actor.h"
@@ -19,6 +20,7 @@
 #include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Memory/Allocators/FrameAllocator.h"
 
 namespace o2
 {
@@ -56,8 +58,17 @@ namespace o2
         UpdateAddedEntities();
         UpdateStartingEntities();
         UpdateDestroyingEntities();
+
+        // Spines are scheduled by components while updating actors and updated together in batch
+        bool batchSpines = SpineManager::IsSingletonInitialzed();
+        if (batchSpines)
+            SpineManager::Instance().BeginBatch();
+
         UpdateActors(dt);
 
+        if (batchSpines)
+            SpineManager::Instance().EndBatch();
+
         mIsUpdatingScene = false;
     }
 
@@ -72,38 +83,37 @@ namespace o2
 
     void Scene::UpdateAddedEntities()
     {
-        struct helper
+        auto recursiveCall = [](const Ref<Actor>& actor, const auto& func, const auto& recursiveCall) -> void
         {
-            static void RecursiveCall(const Ref<Actor>& actor, const Function<void(const Ref<Actor>&)>& func)
+            if (actor->mState == Actor::State::Initializing)
             {
-                if (actor->mState == Actor::State::Initializing)
-                {
-                    func(actor);
+                func(actor);
 
-                    for (auto& child : actor->GetChildren())
-                        RecursiveCall(child, func);
-                }
+                for (auto& child : actor->GetChildren())
+                    recursiveCall(child, func, recursiveCall);
             }
         };
 
-        auto addedActors = mAddedActors;
+        if (mAddedActors.IsEmpty() && mStartActors.IsEmpty())
+            return;
+
+        FrameVector<Ref<Actor>> addedActors(mAddedActors.begin(), mAddedActors.end());
         mAddedActors.Clear();
 
-        auto startedActorsCache = mStartActors;
-        mStartActors = addedActors;
-        startedActorsCache.Clear();
+        mStartActors.Clear();
+        mStartActors.insert(mStartActors.end(), addedActors.begin(), addedActors.end());
 
         for (auto& actor : addedActors)
         {
             if (actor->IsOnScene())
-                helper::RecursiveCall(actor, [&](const Ref<Actor>& actor) { AddActorToScene(actor); });
+                recursiveCall(actor, [&](const Ref<Actor>& actor) { AddActorToScene(actor); }, recursiveCall);
         }
 
         for (auto& actor : addedActors)
-            helper::RecursiveCall(actor, [&](const Ref<Actor>& actor) { actor->UpdateResEnabledInHierarchy(); });
+            recursiveCall(actor, [&](const Ref<Actor>& actor) { actor->UpdateResEnabledInHierarchy(); }, recursiveCall);
 
         for (auto& actor : addedActors)
-            helper::RecursiveCall(actor, [&](const Ref<Actor>& actor) { actor->OnInitialized(); });
+            recursiveCall(actor, [&](const Ref<Actor>& actor) { actor->OnInitialized(); }, recursiveCall);
     }
 
     void Scene::UpdateTransforms()
@@ -117,13 +127,19 @@ namespace o2
 
     void Scene::UpdateStartingEntities()
     {
-        auto startActors = mStartActors;
-        mStartActors.Clear();
+        if (!mStartActors.IsEmpty())
+        {
+            FrameVector<Ref<Actor>> startActors(mStartActors.begin(), mStartActors.end());
+            mStartActors.Clear();
+
+            for (auto& actor : startActors)
+                actor->OnStart();
+        }
 
-        for (auto& actor : startActors)
-            actor->OnStart();
+        if (mStartComponents.IsEmpty())
+            return;
 
-        auto startComponents = mStartComponents;
+        FrameVector<Ref<Component>> startComponents(mStartComponents.begin(), mStartComponents.end());
         mStartComponents.Clear();
 
         for (auto& comp : startComponents)
@@ -132,8 +148,11 @@ namespace o2
 
     void Scene::UpdateDestroyingEntities()
     {
-        auto destroyActors = mDestroyActors;
-        auto destroyComponents = mDestroyComponents;
+        if (mDestroyActors.IsEmpty() && mDestroyComponents.IsEmpty())
+            return;
+
+        FrameVector<Ref<Actor>> destroyActors(mDestroyActors.begin(), mDestroyActors.end());
+        FrameVector<Ref<Component>> destroyComponents(mDestroyComponents.begin(), mDestroyComponents.end());
 
         mDestroyActors.Clear();
         mDestroyComponents.Clear();
@@ -390,17 +409,92 @@ namespace o2
     void Scene::OnComponentAdded(Component* component)
     {
         mStartComponents.Add(Ref(component));
+        RegisterComponent(component);
     }
 
     void Scene::OnComponentRemoved(Component* component)
     {
         mStartComponents.RemoveFirst([&](auto& x) { return x == component; });
+        UnregisterComponent(component);
+    }
+
+    void Scene::RegisterComponent(Component* component)
+    {
+        if (component->mSceneRegistryIndex >= 0)
+            return;
+
+        const Type* type = &component->GetType();
+
+        int listIdx = -1;
+        if (!mComponentsTypesListsIndices.TryGetValue(type, listIdx))
+        {
+            listIdx = mComponentsTypesLists.Count();
+            mComponentsTypesLists.Add(ComponentsTypeList());
+            mComponentsTypesLists.Last().type = type;
+            mComponentsTypesListsIndices[type] = listIdx;
+
+            // Adding new list into cached queries, it is cheaper than clearing cache and gathering lists again
+            for (auto& [queryType, listsIndices] : mComponentsQueriesCache)
+            {
+                if (type->IsBasedOn(*queryType))
+                    listsIndices.Add(listIdx);
+            }
+        }
+
+        auto& components = mComponentsTypesLists[listIdx].components;
+        component->mSceneRegistryIndex = components.Count();
+        components.Add(component);
+    }
+
+    void Scene::UnregisterComponent(Component* component)
+    {
+        if (component->mSceneRegistryIndex < 0)
+            return;
+
+        int listIdx = -1;
+        if (mComponentsTypesListsIndices.TryGetValue(&component->GetType(), listIdx))
+        {
+            // Moving last component in place of removing
+            auto& components = mComponentsTypesLists[listIdx].components;
+            Component* last = components.Last();
+            components[component->mSceneRegistryIndex] = last;
+            last->mSceneRegistryIndex = component->mSceneRegistryIndex;
+            components.PopBack();
+        }
+
+        component->mSceneRegistryIndex = -1;
+    }
+
+    const Vector<int>& Scene::GetComponentsTypesListsIndices(const Type& type)
+    {
+        auto fnd = mComponentsQueriesCache.find(&type);
+        if (fnd != mComponentsQueriesCache.end())
+            return fnd->second;
+
+        auto& listsIndices = mComponentsQueriesCache[&type];
+        for (int i = 0; i < mComponentsTypesLists.Count(); i++)
+        {
+            if (mComponentsTypesLists[i].type->IsBasedOn(type))
+                listsIndices.Add(i);
+        }
+
+        return listsIndices;
+    }
+
+    void Scene::RegisterTag(const Ref<Tag>& tag)
+    {
+        if (!mFreeTagsIndices.IsEmpty())
+            tag->mIndex = mFreeTagsIndices.PopBack();
+        else
+            tag->mIndex = mTags.Count();
+
+        mTags.Add(tag);
     }
 
     void Scene::OnLayerRenamed(SceneLayer* layer, const String& oldName)
     {
-        mLayersMap.Remove(oldName);
-        mLayersMap[layer->GetName()] = Ref(layer);
+        mLayersMap.Remove(NameId::Find(oldName));
+        mLayersMap[NameId(layer->GetName())] = Ref(layer);
 
 #if IS_EDITOR
         onLayersListChanged();
@@ -419,16 +513,25 @@ namespace o2
 
     bool Scene::HasLayer(const String& name) const
     {
-        return mLayersMap.ContainsKey(name);
+        NameId nameId = NameId::Find(name);
+        if (nameId.IsEmpty() && !name.IsEmpty())
+            return false;
+
+        return mLayersMap.ContainsKey(nameId);
     }
 
     Ref<SceneLayer> Scene::GetLayer(const String& name)
+    {
+        return GetLayer(NameId(name));
+    }
+
+    Ref<SceneLayer> Scene::GetLayer(const NameId& name)
     {
         WeakRef<SceneLayer> layer;
         if (mLayersMap.TryGetValue(name, layer))
             return layer.Lock();
 
-        return AddLayer(name);
+        return AddLayer(name.GetString());
     }
 
     const Ref<SceneLayer>& Scene::GetDefaultLayer() const
@@ -438,14 +541,16 @@ namespace o2
 
     Ref<SceneLayer> Scene::AddLayer(const String& name)
     {
+        NameId nameId(name);
+
         WeakRef<SceneLayer> layer;
-        if (mLayersMap.TryGetValue(name, layer))
+        if (mLayersMap.TryGetValue(nameId, layer))
             return layer.Lock();
 
         auto newLayer = mmake<SceneLayer>();
         newLayer->mName = name;
         mLayers.Add(newLayer);
-        mLayersMap[name] = newLayer;
+        mLayersMap[nameId] = newLayer;
 
 #if IS_EDITOR
         onLayersListChanged();
@@ -460,7 +565,7 @@ namespace o2
             return;
 
         mLayers.Remove(layer);
-        mLayersMap.Remove(layer->mName);
+        mLayersMap.Remove(NameId::Find(layer->mName));
 
 #if IS_EDITOR
         onLayersListChanged();
@@ -480,7 +585,16 @@ namespace o2
 
     Ref<Tag> Scene::GetTag(const String& name) const
     {
-        return mTags.FindOrDefault([&](auto x) { return x->GetName() == name; });
+        NameId nameId = NameId::Find(name);
+        if (nameId.IsEmpty() && !name.IsEmpty())
+            return nullptr;
+
+        return GetTag(nameId);
+    }
+
+    Ref<Tag> Scene::GetTag(const NameId& name) const
+    {
+        return mTags.FindOrDefault([&](auto& x) { return x->GetNameId() == name; });
     }
 
     Ref<Tag> Scene::AddTag(const String& name)
@@ -493,13 +607,22 @@ namespace o2
 
         auto newTag = mmake<Tag>();
         newTag->SetName(name);
-        mTags.Add(newTag);
+        RegisterTag(newTag);
 
         return newTag;
     }
 
     void Scene::RemoveTag(const Ref<Tag>& tag)
     {
+        if (!tag || !mTags.Contains(tag))
+            return;
+
+        // Index will be reused, so tag bits must be cleared from actors
+        tag->Clear();
+
+        mFreeTagsIndices.Add(tag->mIndex);
+        tag->mIndex = -1;
+
         mTags.Remove(tag);
     }
 
@@ -518,7 +641,7 @@ namespace o2
         return mLayers.Convert<String>([](auto& x) { return x->GetName(); });
     }
 
-    const Map<String, WeakRef<SceneLayer>>& Scene::GetLayersMap() const
+    const Map<NameId, WeakRef<SceneLayer>>& Scene::GetLayersMap() const
     {
         return mLayersMap;
     }
@@ -528,6 +651,62 @@ namespace o2
         return mTags;
     }
 
+    Vector<Ref<Actor>> Scene::FindActorsWithTags(const Vector<Ref<Tag>>& withTags, 
+                                                 const Vector<Ref<Tag>>& withoutTags /*= Vector<Ref<Tag>>()*/) const
+    {
+        Vector<Ref<Actor>> res;
+
+        TagsMask withMask(withTags);
+        TagsMask withoutMask(withoutTags);
+
+        // Tags, which aren't added into scene, have no bits in masks. They are checked separately
+        Vector<Ref<Tag>> notIndexedWithTags = withTags.FindAll([](auto& x) { return x && x->GetIndex() < 0; });
+        Vector<Ref<Tag>> notIndexedWithoutTags = withoutTags.FindAll([](auto& x) { return x && x->GetIndex() < 0; });
+
+        auto checkActor = [&](const Ref<Actor>& actor)
+        {
+            if (!actor || !actor->IsOnScene())
+                return;
+
+            if (!actor->tags.IsHaveTags(withMask) || actor->tags.IsHaveAnyTag(withoutMask))
+                return;
+
+            for (auto& tag : notIndexedWithTags)
+            {
+                if (!actor->tags.IsHaveTag(tag))
+                    return;
+            }
+
+            for (auto& tag : notIndexedWithoutTags)
+            {
+                if (actor->tags.IsHaveTag(tag))
+                    return;
+            }
+
+            res.Add(actor);
+        };
+
+        Ref<Tag> rarestTag;
+        for (auto& tag : withTags)
+        {
+            if (tag && (!rarestTag || tag->mActors.Count() < rarestTag->mActors.Count()))
+                rarestTag = tag;
+        }
+
+        if (rarestTag)
+        {
+            for (auto& actor : rarestTag->mActors)
+                checkActor(actor.Lock());
+        }
+        else
+        {
+            for (auto& actor : mAllActors)
+                checkActor(actor.Lock());
+        }
+
+        return res;
+    }
+
     const Vector<Ref<Actor>>& Scene::GetRootActors() const
     {
         return mRootActors;
@@ -571,9 +750,13 @@ namespace o2
         int delPos = path.Find("/");
         String pathPart = path.SubStr(0, delPos);
 
+        NameId pathPartId = NameId::Find(pathPart);
+        if (pathPartId.IsEmpty() && !pathPart.IsEmpty())
+            return nullptr;
+
         for (auto& actor : mRootActors)
         {
-            if (actor->mName == pathPart)
+            if (actor->mNameId == pathPartId)
             {
                 if (delPos == -1)
                     return actor;
@@ -599,7 +782,14 @@ namespace o2
         if (keepDefaultLayer)
             mDefaultLayer = AddLayer("Default");
 
+        for (auto& tag : mTags)
+        {
+            tag->Clear();
+            tag->mIndex = -1;
+        }
+
         mTags.Clear();
+        mFreeTagsIndices.Clear();
     }
 
     void Scene::ClearCache()
@@ -631,13 +821,13 @@ namespace o2
                 auto layer = mmake<SceneLayer>();
                 layer->Deserialize(layerNode);
                 mLayers.Add(layer);
-                mLayersMap[layer->mName] = layer;
+                mLayersMap[NameId(layer->mName)] = layer;
             }
         }
 
         auto& defaultLayerNode = doc.GetMember("DefaultLayer");
         if (!defaultLayerNode.IsEmpty())
-            mDefaultLayer = GetLayer(defaultLayerNode);
+            mDefaultLayer = GetLayer((String)defaultLayerNode);
         else
             mDefaultLayer = AddLayer("Default");
 
@@ -652,7 +842,7 @@ namespace o2
             {
                 auto tag = mmake<Tag>();
                 tag->Deserialize(tagNode);
-                mTags.Add(tag);
+                RegisterTag(tag);
             }
         }
 
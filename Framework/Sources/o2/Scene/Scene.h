@@ -6,6 +6,7 @@
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Singleton.h"
 #include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/NameId.h"
 #include "o2/Utils/Types/Ref.h"
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Types/UID.h"
@@ -47,6 +48,9 @@ namespace o2
         // Returns layer by name
         Ref<SceneLayer> GetLayer(const String& name);
 
+        // Returns layer by interned name
+        Ref<SceneLayer> GetLayer(const NameId& name);
+
         // Returns default layer
         const Ref<SceneLayer>& GetDefaultLayer() const;
 
@@ -69,11 +73,14 @@ namespace o2
         Vector<String> GetLayersNames() const;
 
         // Returns layers map by name
-        const Map<String, WeakRef<SceneLayer>>& GetLayersMap() const;
+        const Map<NameId, WeakRef<SceneLayer>>& GetLayersMap() const;
 
         // Returns tag with name
         Ref<Tag> GetTag(const String& name) const;
 
+        // Returns tag with interned name
+        Ref<Tag> GetTag(const NameId& name) const;
+
         // Adds tag with name
         Ref<Tag> AddTag(const String& name);
 
@@ -86,6 +93,12 @@ namespace o2
         // Returns tags array
         const Vector<Ref<Tag>>& GetTags() const;
 
+        // Returns actors on scene, which have all tags from withTags and have no tags from withoutTags. Candidates are
+        // taken from actors of the rarest required tag and checked by tags masks, whole scene is walked only when
+        // there are no required tags
+        Vector<Ref<Actor>> FindActorsWithTags(const Vector<Ref<Tag>>& withTags, 
+                                              const Vector<Ref<Tag>>& withoutTags = Vector<Ref<Tag>>()) const;
+
         // Returns root actors
         const Vector<Ref<Actor>>& GetRootActors() const;
 
@@ -122,6 +135,21 @@ namespace o2
         template<typename _type>
         Vector<Ref<_type>> FindAllActorsComponents();
 
+        // Invokes function for each component of type or derived from it on scene. When enabledOnly is true, only
+        // components enabled in hierarchy are passed. Doesn't allocate memory. Components lists are iterated from end,
+        // so current component can be removed in function
+        template<typename _type, typename _func>
+        void ForEachComponent(const _func& func, bool enabledOnly = true);
+
+        // Invokes function for each actor on scene, which has components of all types. Function receives pointers to
+        // components of each type. Components of first type are iterated, others are searched in their actors
+        template<typename _type, typename ... _other_types, typename _func>
+        void ForEachComponents(const _func& func, bool enabledOnly = true);
+
+        // Returns count of components of type or derived from it on scene
+        template<typename _type>
+        int GetComponentsCount(bool enabledOnly = true);
+
         // Removes all actors
         void Clear(bool keepDefaultLayer = true);
 
@@ -172,6 +200,20 @@ namespace o2
 
         IOBJECT(Scene);
 
+    protected:
+        // ----------------------------------------------------------------------------------------------------------
+        // Registered on scene components with same type. Each component knows its index in list, so adding and
+        // removing is done without searching
+        // ----------------------------------------------------------------------------------------------------------
+        struct ComponentsTypeList
+        {
+            const Type*        type = nullptr; // Type of components
+            Vector<Component*> components;     // Registered components
+
+        public:
+            bool operator==(const ComponentsTypeList& other) const { return type == other.type && components == other.components; }
+        };
+
     protected:
         Ref<LogStream> mLog; // Scene log
 
@@ -190,12 +232,17 @@ namespace o2
         Vector<Ref<Actor>>     mDestroyActors;     // List of destroying on current frame actors
         Vector<Ref<Component>> mDestroyComponents; // List of destroying on current frame components
 
-        Map<String, WeakRef<SceneLayer>> mLayersMap; // Layers by names map
+        Vector<ComponentsTypeList>    mComponentsTypesLists;        // Registered components lists by their exact types
+        Map<const Type*, int>         mComponentsTypesListsIndices; // Index of components list by exact type
+        Map<const Type*, Vector<int>> mComponentsQueriesCache;      // Indices of lists, which types are based on queried type
+
+        Map<NameId, WeakRef<SceneLayer>> mLayersMap; // Layers by names map
         Vector<Ref<SceneLayer>>          mLayers;    // Scene layers
 
         Ref<SceneLayer> mDefaultLayer; // Default scene layer
 
-        Vector<Ref<Tag>> mTags; // Scene tags
+        Vector<Ref<Tag>> mTags;             // Scene tags
+        Vector<int>      mFreeTagsIndices; // Indices of removed tags, reused by new tags
 
         Vector<AssetRef<ActorAsset>> mAssetsCache; // Cached actors assets
 
@@ -245,6 +292,18 @@ namespace o2
         // Called when component removed, register for calling OnRemovFromScene
         void OnComponentRemoved(Component* component);
 
+        // Adds component into list of its type in components registry
+        void RegisterComponent(Component* component);
+
+        // Removes component from list of its type in components registry
+        void UnregisterComponent(Component* component);
+
+        // Returns indices of components lists, which types are based on type. Cached for each queried type
+        const Vector<int>& GetComponentsTypesListsIndices(const Type& type);
+
+        // Assigns free index to tag and adds it into tags list
+        void RegisterTag(const Ref<Tag>& tag);
+
         // Called when scene layer renamed, updates layers map
         void OnLayerRenamed(SceneLayer* layer, const String& oldName);
 
@@ -373,12 +432,78 @@ namespace o2
     Vector<Ref<_type>> Scene::FindAllActorsComponents()
     {
         Vector<Ref<_type>> res;
-//         for (auto& actor : mRootActors)
-//             res.Add(actor->GetComponentInChildren<_type>());
+        res.Reserve(GetComponentsCount<_type>(false));
+        ForEachComponent<_type>([&](_type* component) { res.Add(Ref(component)); }, false);
 
         return res;
     }
 
+    template<typename _type, typename _func>
+    void Scene::ForEachComponent(const _func& func, bool enabledOnly /*= true*/)
+    {
+        // Lists and cached indices can be changed by function, so they are accessed by indices
+        const Vector<int>& listsIndices = GetComponentsTypesListsIndices(TypeOf(_type));
+        for (int i = 0; i < listsIndices.Count(); i++)
+        {
+            int listIdx = listsIndices[i];
+            for (int j = mComponentsTypesLists[listIdx].components.Count() - 1; j >= 0; j--)
+            {
+                auto& components = mComponentsTypesLists[listIdx].components;
+                if (j >= components.Count())
+                    continue;
+
+                auto component = static_cast<_type*>(components[j]);
+                if (enabledOnly && !component->IsEnabledInHierarchy())
+                    continue;
+
+                func(component);
+            }
+        }
+    }
+
+    template<typename _type, typename ... _other_types, typename _func>
+    void Scene::ForEachComponents(const _func& func, bool enabledOnly /*= true*/)
+    {
+        ForEachComponent<_type>([&](_type* component)
+        {
+            auto actor = component->GetActor();
+            if (!actor)
+                return;
+
+            auto others = std::make_tuple(actor->template GetComponent<_other_types>().Get()...);
+
+            bool allFound = std::apply([&](auto* ... other)
+            {
+                return ((other && (!enabledOnly || other->IsEnabledInHierarchy())) && ...);
+            }, others);
+
+            if (allFound)
+                std::apply([&](auto* ... other) { func(component, other...); }, others);
+        }, enabledOnly);
+    }
+
+    template<typename _type>
+    int Scene::GetComponentsCount(bool enabledOnly /*= true*/)
+    {
+        int count = 0;
+        for (int listIdx : GetComponentsTypesListsIndices(TypeOf(_type)))
+        {
+            if (!enabledOnly)
+            {
+                count += mComponentsTypesLists[listIdx].components.Count();
+                continue;
+            }
+
+            for (auto component : mComponentsTypesLists[listIdx].components)
+            {
+                if (static_cast<_type*>(component)->IsEnabledInHierarchy())
+                    count++;
+            }
+        }
+
+        return count;
+    }
+
     template<typename _type>
     Ref<_type> Scene::FindActorByType()
     {
@@ -397,12 +522,12 @@ namespace o2
     template<typename _type>
     Ref<_type> Scene::FindActorComponent()
     {
-//         for (auto& actor : mRootActors)
-//         {
-//             _type* res = actor->GetComponentInChildren<_type>();
-//             if (res)
-//                 return res;
-//         }
+        for (int listIdx : GetComponentsTypesListsIndices(TypeOf(_type)))
+        {
+            auto& components = mComponentsTypesLists[listIdx].components;
+            if (!components.IsEmpty())
+                return Ref(static_cast<_type*>(components[0]));
+        }
 
         return nullptr;
     }
@@ -427,10 +552,14 @@ CLASS_FIELDS_META(o2::Scene)
     FIELD().PROTECTED().NAME(mStartComponents);
     FIELD().PROTECTED().NAME(mDestroyActors);
     FIELD().PROTECTED().NAME(mDestroyComponents);
+    FIELD().PROTECTED().NAME(mComponentsTypesLists);
+    FIELD().PROTECTED().NAME(mComponentsTypesListsIndices);
+    FIELD().PROTECTED().NAME(mComponentsQueriesCache);
     FIELD().PROTECTED().NAME(mLayersMap);
     FIELD().PROTECTED().NAME(mLayers);
     FIELD().PROTECTED().NAME(mDefaultLayer);
     FIELD().PROTECTED().NAME(mTags);
+    FIELD().PROTECTED().NAME(mFreeTagsIndices);
     FIELD().PROTECTED().NAME(mAssetsCache);
     FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mIsUpdatingScene);
 #if  IS_EDITOR          
@@ -455,13 +584,14 @@ END_META;
 CLASS_METHODS_META(o2::Scene)
 {
 
-    typedef const Map<String, WeakRef<SceneLayer>>& _tmp1;
+    typedef const Map<NameId, WeakRef<SceneLayer>>& _tmp1;
     typedef Map<AssetRef<ActorAsset>, Vector<WeakRef<Actor>>>& _tmp2;
 
     FUNCTION().PUBLIC().CONSTRUCTOR(RefCounter*);
     FUNCTION().PUBLIC().SIGNATURE(const LogStream&, GetLogStream);
     FUNCTION().PUBLIC().SIGNATURE(bool, HasLayer, const String&);
     FUNCTION().PUBLIC().SIGNATURE(Ref<SceneLayer>, GetLayer, const String&);
+    FUNCTION().PUBLIC().SIGNATURE(Ref<SceneLayer>, GetLayer, const NameId&);
     FUNCTION().PUBLIC().SIGNATURE(const Ref<SceneLayer>&, GetDefaultLayer);
     FUNCTION().PUBLIC().SIGNATURE(Ref<SceneLayer>, AddLayer, const String&);
     FUNCTION().PUBLIC().SIGNATURE(void, RemoveLayer, const Ref<SceneLayer>&);
@@ -471,10 +601,12 @@ CLASS_METHODS_META(o2::Scene)
     FUNCTION().PUBLIC().SIGNATURE(Vector<String>, GetLayersNames);
     FUNCTION().PUBLIC().SIGNATURE(_tmp1, GetLayersMap);
     FUNCTION().PUBLIC().SIGNATURE(Ref<Tag>, GetTag, const String&);
+    FUNCTION().PUBLIC().SIGNATURE(Ref<Tag>, GetTag, const NameId&);
     FUNCTION().PUBLIC().SIGNATURE(Ref<Tag>, AddTag, const String&);
     FUNCTION().PUBLIC().SIGNATURE(void, RemoveTag, const Ref<Tag>&);
     FUNCTION().PUBLIC().SIGNATURE(void, RemoveTag, const String&);
     FUNCTION().PUBLIC().SIGNATURE(const Vector<Ref<Tag>>&, GetTags);
+    FUNCTION().PUBLIC().SIGNATURE(Vector<Ref<Actor>>, FindActorsWithTags, const Vector<Ref<Tag>>&, const Vector<Ref<Tag>>&);
     FUNCTION().PUBLIC().SIGNATURE(const Vector<Ref<Actor>>&, GetRootActors);
     FUNCTION().PUBLIC().SIGNATURE(Vector<Ref<Actor>>&, GetRootActors);
     FUNCTION().PUBLIC().SIGNATURE(const Vector<WeakRef<Actor>>&, GetAllActors);
@@ -513,6 +645,10 @@ CLASS_METHODS_META(o2::Scene)
     FUNCTION().PROTECTED().SIGNATURE(void, RemoveActorFromScene, const Ref<Actor>&, bool);
     FUNCTION().PROTECTED().SIGNATURE(void, OnComponentAdded, Component*);
     FUNCTION().PROTECTED().SIGNATURE(void, OnComponentRemoved, Component*);
+    FUNCTION().PROTECTED().SIGNATURE(void, RegisterComponent, Component*);
+    FUNCTION().PROTECTED().SIGNATURE(void, UnregisterComponent, Component*);
+    FUNCTION().PROTECTED().SIGNATURE(const Vector<int>&, GetComponentsTypesListsIndices, const Type&);
+    FUNCTION().PROTECTED().SIGNATURE(void, RegisterTag, const Ref<Tag>&);
     FUNCTION().PROTECTED().SIGNATURE(void, OnLayerRenamed, SceneLayer*, const String&);
     FUNCTION().PROTECTED().SIGNATURE(void, OnCameraAddedOnScene, CameraActor*);
     FUNCTION().PROTECTED().SIGNATURE(void, OnCameraRemovedScene, CameraActor*);
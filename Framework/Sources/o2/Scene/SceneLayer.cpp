@@ -28,69 +28,96 @@ namespace o2
 
     const Vector<Ref<ISceneDrawable>>& SceneLayer::GetDrawables() const
     {
+        UpdateDrawablesOrder();
         return mDrawables;
     }
 
-    const Ref<SceneLayerRootDrawablesContainer>& SceneLayer::GetRootDrawables()
+    void SceneLayer::UpdateDrawablesOrder() const
     {
-        return mRootDrawables;
-    }
+        if (mPendingDrawables.IsEmpty() && mRemovedDrawablesCount == 0)
+            return;
 
-    void SceneLayer::RegisterDrawable(ISceneDrawable* drawable)
-    {
-        const int binSearchRangeSizeStop = 5;
-        int rangeMin = 0, rangeMax = mDrawables.Count();
-        float targetDepth = drawable->mDrawingDepth;
-        int position = 0;
-        bool skipLinearSearch = false;
-
-        while (rangeMax - rangeMin > binSearchRangeSizeStop)
+        auto isDrawnBefore = [](const Ref<ISceneDrawable>& a, const Ref<ISceneDrawable>& b)
         {
-            int center = (rangeMin + rangeMax) >> 1;
+            if (a->mDrawingDepth != b->mDrawingDepth)
+                return a->mDrawingDepth < b->mDrawingDepth;
+
+            return a->mLayerDrawOrder < b->mLayerDrawOrder;
+        };
 
-            float centerValue = mDrawables[center]->mDrawingDepth;
+        // Only changed drawables are sorted, then merged with already sorted list in linear time
+        std::sort(mPendingDrawables.begin(), mPendingDrawables.end(), isDrawnBefore);
 
-            if (targetDepth < centerValue)
-                rangeMax = center;
-            else if (targetDepth > centerValue)
-                rangeMin = center;
-            else
+        mMergeBuffer.Clear();
+        mMergeBuffer.Reserve(mDrawables.Count() - mRemovedDrawablesCount + mPendingDrawables.Count());
+
+        int sortedIdx = 0, pendingIdx = 0;
+        int sortedCount = mDrawables.Count(), pendingCount = mPendingDrawables.Count();
+        while (sortedIdx < sortedCount || pendingIdx < pendingCount)
+        {
+            if (sortedIdx < sortedCount && !mDrawables[sortedIdx])
             {
-                position = center;
-                skipLinearSearch = true;
-                break;
+                sortedIdx++;
+                continue;
             }
-        }
 
-        if (!skipLinearSearch)
-        {
-            for (position = rangeMin; position < rangeMax; position++)
-                if (mDrawables[position]->mDrawingDepth > targetDepth)
-                    break;
+            bool takePending = sortedIdx == sortedCount ||
+                (pendingIdx < pendingCount && isDrawnBefore(mPendingDrawables[pendingIdx], mDrawables[sortedIdx]));
+
+            auto& drawable = takePending ? mPendingDrawables[pendingIdx++] : mDrawables[sortedIdx++];
+            drawable->mLayerDrawableIdx = mMergeBuffer.Count();
+            drawable->mLayerPendingIdx = -1;
+            mMergeBuffer.Add(std::move(drawable));
         }
 
-        mDrawables.Insert(Ref(drawable), position);
+        mDrawables.swap(mMergeBuffer);
+
+        mMergeBuffer.Clear();
+        mPendingDrawables.Clear();
+        mRemovedDrawablesCount = 0;
     }
 
-    void SceneLayer::UnregisterDrawable(ISceneDrawable* drawable)
+    const Ref<SceneLayerRootDrawablesContainer>& SceneLayer::GetRootDrawables()
     {
-        mDrawables.Remove(Ref(drawable));
+        return mRootDrawables;
     }
 
-    void SceneLayer::SetLastByDepth(const Ref<ISceneDrawable>& drawable)
+    void SceneLayer::RegisterDrawable(ISceneDrawable* drawable)
     {
-        mDrawables.Remove(drawable);
+        drawable->mLayerDrawOrder = ++mLastDrawOrder;
+        drawable->mLayerDrawableIdx = -1;
+        drawable->mLayerPendingIdx = mPendingDrawables.Count();
+        mPendingDrawables.Add(Ref(drawable));
+    }
 
-        for (int position = 0; position < mDrawables.Count(); position++)
+    void SceneLayer::UnregisterDrawable(ISceneDrawable* drawable)
+    {
+        if (drawable->mLayerDrawableIdx >= 0)
         {
-            if (mDrawables[position]->mDrawingDepth > drawable->mDrawingDepth)
+            mDrawables[drawable->mLayerDrawableIdx] = nullptr;
+            mRemovedDrawablesCount++;
+        }
+        else if (drawable->mLayerPendingIdx >= 0)
+        {
+            // Pending drawables aren't ordered, so removing by swapping with last
+            int idx = drawable->mLayerPendingIdx;
+            if (idx != mPendingDrawables.Count() - 1)
             {
-                mDrawables.Insert(drawable, position);
-                return;
+                mPendingDrawables[idx] = std::move(mPendingDrawables.Last());
+                mPendingDrawables[idx]->mLayerPendingIdx = idx;
             }
+
+            mPendingDrawables.PopBack();
         }
 
-        mDrawables.Add(drawable);
+        drawable->mLayerDrawableIdx = -1;
+        drawable->mLayerPendingIdx = -1;
+    }
+
+    void SceneLayer::SetLastByDepth(const Ref<ISceneDrawable>& drawable)
+    {
+        UnregisterDrawable(drawable.Get());
+        RegisterDrawable(drawable.Get());
     }
 }
 // --- META ---
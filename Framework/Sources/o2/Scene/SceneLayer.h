@@ -31,9 +31,13 @@ namespace o2
         // Returns layer name
         const String& GetName() const;
 
-        // Returns all drawable objects of actors in layer
+        // Returns all drawable objects of actors in layer, sorted by depth. Applies pending drawables order changes.
+        // Drawables unregistered after that are left as null slots until next call
         const Vector<Ref<ISceneDrawable>>& GetDrawables() const;
 
+        // Merges pending registered drawables into sorted drawables list and removes unregistered slots
+        void UpdateDrawablesOrder() const;
+
         // Returns root drawable objects of actors in layer
         const Ref<SceneLayerRootDrawablesContainer>& GetRootDrawables();
 
@@ -43,15 +47,20 @@ namespace o2
     protected:
         String mName; // Name of layer @SERIALIZABLE
 
-        Vector<Ref<ISceneDrawable>> mDrawables; // Drawable objects in layer
+        mutable Vector<Ref<ISceneDrawable>> mDrawables;        // Drawable objects in layer, sorted by depth and registration order
+        mutable Vector<Ref<ISceneDrawable>> mPendingDrawables; // Registered drawables, not merged into sorted list yet. Not ordered
+        mutable Vector<Ref<ISceneDrawable>> mMergeBuffer;      // Buffer for merging drawables, swapped with mDrawables
+
+        mutable int mRemovedDrawablesCount = 0; // Count of null slots in mDrawables left by unregistered drawables
+        UInt64      mLastDrawOrder = 0;         // Last given registration order of drawable
 
         Ref<SceneLayerRootDrawablesContainer> mRootDrawables; // Root drawables with inherited depth. Draws at 0 priority
 
     protected:
-        // Registers drawable object
+        // Registers drawable object. Drawable is added to pending list and merged into sorted list on next drawables request
         void RegisterDrawable(ISceneDrawable* drawable);
 
-        // Unregisters drawable object
+        // Unregisters drawable object. Leaves null slot in sorted list
         void UnregisterDrawable(ISceneDrawable* drawable);
 
         // Sets drawable order as last of all objects with same depth
@@ -81,6 +90,10 @@ CLASS_FIELDS_META(o2::SceneLayer)
 #endif
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mName);
     FIELD().PROTECTED().NAME(mDrawables);
+    FIELD().PROTECTED().NAME(mPendingDrawables);
+    FIELD().PROTECTED().NAME(mMergeBuffer);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mRemovedDrawablesCount);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mLastDrawOrder);
     FIELD().PROTECTED().NAME(mRootDrawables);
 }
 END_META;
@@ -91,6 +104,7 @@ CLASS_METHODS_META(o2::SceneLayer)
     FUNCTION().PUBLIC().SIGNATURE(void, SetName, const String&);
     FUNCTION().PUBLIC().SIGNATURE(const String&, GetName);
     FUNCTION().PUBLIC().SIGNATURE(const Vector<Ref<ISceneDrawable>>&, GetDrawables);
+    FUNCTION().PUBLIC().SIGNATURE(void, UpdateDrawablesOrder);
     FUNCTION().PUBLIC().SIGNATURE(const Ref<SceneLayerRootDrawablesContainer>&, GetRootDrawables);
     FUNCTION().PROTECTED().SIGNATURE(void, RegisterDrawable, ISceneDrawable*);
     FUNCTION().PROTECTED().SIGNATURE(void, UnregisterDrawable, ISceneDrawable*);
@@ -7,12 +7,106 @@
 
 namespace o2
 {
+    TagsMask::TagsMask()
+    {}
+
+    TagsMask::TagsMask(const Vector<Ref<Tag>>& tags)
+    {
+        for (auto& tag : tags)
+        {
+            if (tag)
+                Set(tag->GetIndex(), true);
+        }
+    }
+
+    bool TagsMask::operator==(const TagsMask& other) const
+    {
+        int count = Math::Max(mBits.Count(), other.mBits.Count());
+        for (int i = 0; i < count; i++)
+        {
+            UInt64 bits = i < mBits.Count() ? mBits[i] : 0;
+            UInt64 otherBits = i < other.mBits.Count() ? other.mBits[i] : 0;
+
+            if (bits != otherBits)
+                return false;
+        }
+
+        return true;
+    }
+
+    void TagsMask::Set(int index, bool value)
+    {
+        if (index < 0)
+            return;
+
+        int word = index >> 6;
+        UInt64 bit = 1ull << (index & 63);
+
+        if (value)
+        {
+            while (mBits.Count() <= word)
+                mBits.Add(0);
+
+            mBits[word] |= bit;
+        }
+        else if (word < mBits.Count())
+            mBits[word] &= ~bit;
+    }
+
+    bool TagsMask::Get(int index) const
+    {
+        if (index < 0)
+            return false;
+
+        int word = index >> 6;
+        return word < mBits.Count() && (mBits[word] & (1ull << (index & 63))) != 0;
+    }
+
+    bool TagsMask::IsEmpty() const
+    {
+        for (auto bits : mBits)
+        {
+            if (bits != 0)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool TagsMask::Contains(const TagsMask& other) const
+    {
+        for (int i = 0; i < other.mBits.Count(); i++)
+        {
+            UInt64 bits = i < mBits.Count() ? mBits[i] : 0;
+            if ((bits & other.mBits[i]) != other.mBits[i])
+                return false;
+        }
+
+        return true;
+    }
+
+    bool TagsMask::Intersects(const TagsMask& other) const
+    {
+        int count = Math::Min(mBits.Count(), other.mBits.Count());
+        for (int i = 0; i < count; i++)
+        {
+            if ((mBits[i] & other.mBits[i]) != 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    void TagsMask::Clear()
+    {
+        mBits.Clear();
+    }
 
     Tag::Tag()
     {}
 
     Tag::Tag(const String& name):
-        mName(name)
+        mName(name), mNameId(name)
     {}
 
     Tag::~Tag()
@@ -25,6 +119,21 @@ namespace o2
         return mName;
     }
 
+    const NameId& Tag::GetNameId() const
+    {
+        return mNameId;
+    }
+
+    int Tag::GetIndex() const
+    {
+        return mIndex;
+    }
+
+    const Vector<WeakRef<Actor>>& Tag::GetActors() const
+    {
+        return mActors;
+    }
+
     void Tag::SetName(const String& name)
     {
         if (o2Scene.GetTag(name))
@@ -34,15 +143,17 @@ namespace o2
         }
 
         mName = name;
+        mNameId = NameId(name);
     }
 
     void Tag::AddActor(const Ref<Actor>& actor)
     {
-        if (mActors.Contains(actor))
+        if (actor->tags.IsHaveTag(Ref(this)))
             return;
 
         mActors.Add(actor);
         actor->tags.mTags.Add(Ref(this));
+        actor->tags.mTagsMask.Set(mIndex, true);
     }
 
     void Tag::RemoveActor(const Ref<Actor>& actor)
@@ -52,16 +163,28 @@ namespace o2
 
         mActors.Remove(actor);
         actor->tags.mTags.Remove(Ref(this));
+        actor->tags.mTagsMask.Set(mIndex, false);
     }
 
     void Tag::Clear()
     {
         for (auto& actor : mActors)
-            actor.Lock()->tags.mTags.Remove(Ref(this));
+        {
+            if (auto actorRef = actor.Lock())
+            {
+                actorRef->tags.mTags.Remove(Ref(this));
+                actorRef->tags.mTagsMask.Set(mIndex, false);
+            }
+        }
 
         mActors.Clear();
     }
 
+    void Tag::OnDeserialized(const DataValue& node)
+    {
+        mNameId = NameId(mName);
+    }
+
     Tag& Tag::operator-=(const Ref<Actor>& actor)
     {
         RemoveActor(actor);
@@ -78,7 +201,7 @@ namespace o2
     {}
 
     TagGroup::TagGroup(const TagGroup& other):
-        mTags(other.mTags)
+        mTags(other.mTags), mTagsMask(other.mTagsMask)
     {}
 
     TagGroup::~TagGroup()
@@ -89,6 +212,7 @@ namespace o2
         Clear();
 
         mTags = other.mTags;
+        mTagsMask = other.mTagsMask;
 
         for (auto& tag : mTags)
             onTagAdded(tag.Lock());
@@ -123,10 +247,11 @@ namespace o2
 
     void TagGroup::AddTag(const Ref<Tag>& tag)
     {
-        if (!tag || mTags.Contains(tag))
+        if (!tag || IsHaveTag(tag))
             return;
 
         mTags.Add(tag);
+        mTagsMask.Set(tag->GetIndex(), true);
         onTagAdded(tag);
     }
 
@@ -145,10 +270,11 @@ namespace o2
 
     void TagGroup::RemoveTag(const Ref<Tag>& tag)
     {
-        if (!tag || !mTags.Contains(tag))
+        if (!tag || !IsHaveTag(tag))
             return;
 
         mTags.Remove(tag);
+        mTagsMask.Set(tag->GetIndex(), false);
         onTagRemoved(tag);
     }
 
@@ -158,18 +284,46 @@ namespace o2
             onTagRemoved(tag.Lock());
 
         mTags.Clear();
+        mTagsMask.Clear();
     }
 
     bool TagGroup::IsHaveTag(const String& name) const
     {
-        return mTags.Contains([&](auto x) { return x.Lock()->GetName() == name; });
+        NameId nameId = NameId::Find(name);
+        if (nameId.IsEmpty() && !name.IsEmpty())
+            return false;
+
+        return IsHaveTag(nameId);
+    }
+
+    bool TagGroup::IsHaveTag(const NameId& name) const
+    {
+        return mTags.Contains([&](auto& x) { return x.Lock()->GetNameId() == name; });
     }
 
     bool TagGroup::IsHaveTag(const Ref<Tag>& tag) const
     {
+        if (tag && tag->GetIndex() >= 0)
+            return mTagsMask.Get(tag->GetIndex());
+
         return mTags.Contains(tag);
     }
 
+    bool TagGroup::IsHaveTags(const TagsMask& tags) const
+    {
+        return mTagsMask.Contains(tags);
+    }
+
+    bool TagGroup::IsHaveAnyTag(const TagsMask& tags) const
+    {
+        return mTagsMask.Intersects(tags);
+    }
+
+    const TagsMask& TagGroup::GetTagsMask() const
+    {
+        return mTagsMask;
+    }
+
     const Vector<WeakRef<Tag>>& TagGroup::GetTags() const
     {
         return mTags;
@@ -180,6 +334,16 @@ namespace o2
         return mTags.Convert<String>([](auto x) { return x.Lock()->GetName(); });
     }
 
+    void TagGroup::OnDeserialized(const DataValue& node)
+    {
+        mTagsMask.Clear();
+        for (auto& tag : mTags)
+        {
+            if (auto tagRef = tag.Lock())
+                mTagsMask.Set(tagRef->GetIndex(), true);
+        }
+    }
+
     TagGroup& TagGroup::operator-=(const Ref<Tag>& tag)
     {
         RemoveTag(tag);
@@ -2,12 +2,51 @@
 
 #include "o2/Utils/Serialization/Serializable.h"
 #include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/NameId.h"
 #include "o2/Utils/Types/Ref.h"
 #include "o2/Utils/Types/String.h"
 
 namespace o2
 {
     class Actor;
+    class Tag;
+
+    // ------------------------------------------------------------------------------------------------------
+    // Bitset of tags by their indices in scene. Tags without index (not added into scene) aren't represented
+    // ------------------------------------------------------------------------------------------------------
+    class TagsMask
+    {
+    public:
+        // Default constructor, empty mask
+        TagsMask();
+
+        // Constructor from tags array
+        TagsMask(const Vector<Ref<Tag>>& tags);
+
+        // Check equals operator
+        bool operator==(const TagsMask& other) const;
+
+        // Sets bit of tag index
+        void Set(int index, bool value);
+
+        // Returns is bit of tag index set
+        bool Get(int index) const;
+
+        // Returns is no bits set
+        bool IsEmpty() const;
+
+        // Returns is all bits of other mask set in this
+        bool Contains(const TagsMask& other) const;
+
+        // Returns is any bit of other mask set in this
+        bool Intersects(const TagsMask& other) const;
+
+        // Resets all bits
+        void Clear();
+
+    private:
+        Vector<UInt64> mBits; // Bits words, tag index bit is (index % 64) in word (index / 64)
+    };
 
     // ---------
     // Scene tag
@@ -27,6 +66,15 @@ namespace o2
         // Returns tag name
         const String& GetName() const;
 
+        // Returns interned tag name
+        const NameId& GetNameId() const;
+
+        // Returns index of tag in scene tags masks. Returns -1 if tag isn't added into scene
+        int GetIndex() const;
+
+        // Returns actors with this tag
+        const Vector<WeakRef<Actor>>& GetActors() const;
+
         // Sets tag name
         void SetName(const String& name);
 
@@ -48,11 +96,19 @@ namespace o2
         SERIALIZABLE(Tag);
 
     protected:
-        String mName; // Tag name @SERIALIZABLE
+        String mName;   // Tag name @SERIALIZABLE
+        NameId mNameId; // Interned tag name, updated together with mName
 
-        Vector<WeakRef<Actor>> mActors; // Actors in layer
+        int mIndex = -1; // Index of tag in scene tags masks, assigned by scene. -1 when tag isn't added into scene
+
+        Vector<WeakRef<Actor>> mActors; // Actors with tag
+
+    protected:
+        // Called when object was deserialized, interns name
+        void OnDeserialized(const DataValue& node) override;
 
         friend class Actor;
+        friend class Scene;
     };
 
     // ----------
@@ -101,9 +157,21 @@ namespace o2
         // Returns is have tag with name
         bool IsHaveTag(const String& name) const;
 
-        // Returns is have tag
+        // Returns is have tag with interned name
+        bool IsHaveTag(const NameId& name) const;
+
+        // Returns is have tag. Checks tags mask bit when tag is added into scene
         bool IsHaveTag(const Ref<Tag>& tag) const;
 
+        // Returns is have all tags from mask
+        bool IsHaveTags(const TagsMask& tags) const;
+
+        // Returns is have any tag from mask
+        bool IsHaveAnyTag(const TagsMask& tags) const;
+
+        // Returns mask of tags
+        const TagsMask& GetTagsMask() const;
+
         // Returns tags array
         const Vector<WeakRef<Tag>>& GetTags() const;
 
@@ -127,6 +195,12 @@ namespace o2
     private:
         Vector<WeakRef<Tag>> mTags; // @SERIALIZABLE
 
+        TagsMask mTagsMask; // Mask of tags by their scene indices
+
+    private:
+        // Called when object was deserialized, rebuilds tags mask
+        void OnDeserialized(const DataValue& node) override;
+
         friend class Tag;
     };
 
@@ -157,6 +231,8 @@ END_META;
 CLASS_FIELDS_META(o2::Tag)
 {
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mName);
+    FIELD().PROTECTED().NAME(mNameId);
+    FIELD().PROTECTED().DEFAULT_VALUE(-1).NAME(mIndex);
     FIELD().PROTECTED().NAME(mActors);
 }
 END_META;
@@ -166,10 +242,14 @@ CLASS_METHODS_META(o2::Tag)
     FUNCTION().PUBLIC().CONSTRUCTOR();
     FUNCTION().PUBLIC().CONSTRUCTOR(const String&);
     FUNCTION().PUBLIC().SIGNATURE(const String&, GetName);
+    FUNCTION().PUBLIC().SIGNATURE(const NameId&, GetNameId);
+    FUNCTION().PUBLIC().SIGNATURE(int, GetIndex);
+    FUNCTION().PUBLIC().SIGNATURE(const Vector<WeakRef<Actor>>&, GetActors);
     FUNCTION().PUBLIC().SIGNATURE(void, SetName, const String&);
     FUNCTION().PUBLIC().SIGNATURE(void, AddActor, const Ref<Actor>&);
     FUNCTION().PUBLIC().SIGNATURE(void, RemoveActor, const Ref<Actor>&);
     FUNCTION().PUBLIC().SIGNATURE(void, Clear);
+    FUNCTION().PROTECTED().SIGNATURE(void, OnDeserialized, const DataValue&);
 }
 END_META;
 
@@ -183,6 +263,7 @@ CLASS_FIELDS_META(o2::TagGroup)
     FIELD().PUBLIC().NAME(onTagAdded);
     FIELD().PUBLIC().NAME(onTagRemoved);
     FIELD().PRIVATE().SERIALIZABLE_ATTRIBUTE().NAME(mTags);
+    FIELD().PRIVATE().NAME(mTagsMask);
 }
 END_META;
 CLASS_METHODS_META(o2::TagGroup)
@@ -196,9 +277,14 @@ CLASS_METHODS_META(o2::TagGroup)
     FUNCTION().PUBLIC().SIGNATURE(void, RemoveTag, const Ref<Tag>&);
     FUNCTION().PUBLIC().SIGNATURE(void, Clear);
     FUNCTION().PUBLIC().SIGNATURE(bool, IsHaveTag, const String&);
+    FUNCTION().PUBLIC().SIGNATURE(bool, IsHaveTag, const NameId&);
     FUNCTION().PUBLIC().SIGNATURE(bool, IsHaveTag, const Ref<Tag>&);
+    FUNCTION().PUBLIC().SIGNATURE(bool, IsHaveTags, const TagsMask&);
+    FUNCTION().PUBLIC().SIGNATURE(bool, IsHaveAnyTag, const TagsMask&);
+    FUNCTION().PUBLIC().SIGNATURE(const TagsMask&, GetTagsMask);
     FUNCTION().PUBLIC().SIGNATURE(const Vector<WeakRef<Tag>>&, GetTags);
     FUNCTION().PUBLIC().SIGNATURE(Vector<String>, GetTagsNames);
+    FUNCTION().PRIVATE().SIGNATURE(void, OnDeserialized, const DataValue&);
 }
 END_META;
 // --- END META ---
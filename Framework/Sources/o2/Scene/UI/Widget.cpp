@@ -2,6 +2,7 @@
 #include "Widget.h"
 
 #include "o2/Application/Input.h"
+#include "o2/Events/EventSystem.h"
 #include "o2/Render/Render.h"
 #include "o2/Scene/Component.h"
 #include "o2/Scene/Scene.h"
@@ -49,8 +50,8 @@ namespace o2
 
     Widget::Widget(RefCounter* refCounter, const Widget& other) :
         Actor(refCounter, mnew WidgetLayout(*other.layout), other), layout(dynamic_cast<WidgetLayout*>(transform)),
-        mTransparency(other.mTransparency), transparency(this), resTransparency(this),
-        childrenWidgets(this), layers(this), states(this), childWidget(this), layer(this), state(this)
+        mTransparency(other.mTransparency), mStaticBatching(other.mStaticBatching), transparency(this),
+        staticBatching(this), resTransparency(this), childrenWidgets(this), layers(this), states(this), childWidget(this), layer(this), state(this)
     {
 #if IS_EDITOR
         InitEditables();
@@ -164,6 +165,7 @@ namespace o2
         layout->CopyFrom(*other.layout);
         mTransparency = other.mTransparency;
         mIsFocusable = other.mIsFocusable;
+        SetStaticBatching(other.mStaticBatching);
 
         auto thisRef = Ref(this);
 
@@ -227,7 +229,12 @@ namespace o2
                 for (auto& state : mStates)
                 {
                     if (state)
+                    {
+                        if (state->GetAnimationPlayer()->IsPlaying())
+                            InvalidateStaticBatch();
+
                         state->Update(dt);
+                    }
                 }
             }
 
@@ -305,6 +312,14 @@ namespace o2
             return;
         }
 
+        if (DrawStaticBatch())
+        {
+            DrawDebugFrame();
+            return;
+        }
+
+        bool captureStaticBatch = BeginStaticBatchCapture();
+
         DrawLayers();
 
         OnDrawn();
@@ -313,9 +328,52 @@ namespace o2
         DrawInternalChildren();
         DrawTopLayers();
 
+        if (captureStaticBatch)
+            EndStaticBatchCapture();
+
         DrawDebugFrame();
 	}
 
+    bool Widget::DrawStaticBatch()
+    {
+        if (!mStaticBatching || !mStaticBatchValid)
+            return false;
+
+        if (!mStaticBatch->IsActual())
+        {
+            mStaticBatchValid = false;
+            return false;
+        }
+
+        o2Render.DrawCachedBatches(*mStaticBatch);
+        EventSystem::RedrawCursorAreaListeners(mStaticBatchListeners);
+
+        return true;
+    }
+
+    bool Widget::BeginStaticBatchCapture()
+    {
+        if (!mStaticBatching || o2Render.IsDrawCapturing())
+            return false;
+
+        if (!mStaticBatch)
+            mStaticBatch = mmake<DrawBatchCache>();
+
+        o2Render.BeginDrawCapture(mStaticBatch);
+        mStaticBatchListenersBegin = EventSystem::GetDrawnCursorAreaListenersCount();
+
+        return true;
+    }
+
+    void Widget::EndStaticBatchCapture()
+    {
+        mStaticBatchValid = o2Render.EndDrawCapture();
+
+        mStaticBatchListeners.Clear();
+        if (mStaticBatchValid)
+            EventSystem::GetDrawnCursorAreaListeners(mStaticBatchListenersBegin, mStaticBatchListeners);
+    }
+
 	void Widget::DrawLayers()
 	{
 		for (auto& layer : mDrawingLayers)
@@ -914,11 +972,48 @@ namespace o2
         mIsFocusable = selectable;
     }
 
+    void Widget::SetStaticBatching(bool enabled)
+    {
+        mStaticBatching = enabled;
+        mStaticBatchValid = false;
+
+        if (!mStaticBatching)
+        {
+            mStaticBatch = nullptr;
+            mStaticBatchListeners.Clear();
+        }
+    }
+
+    bool Widget::IsStaticBatching() const
+    {
+        return mStaticBatching;
+    }
+
+    bool Widget::IsStaticBatchActual() const
+    {
+        return mStaticBatching && mStaticBatchValid && mStaticBatch->IsActual();
+    }
+
+    void Widget::InvalidateStaticBatch()
+    {
+        for (Widget* widget = this; widget; widget = widget->mParentWidget.Lock().Get())
+            widget->mStaticBatchValid = false;
+    }
+
     bool Widget::IsUnderPoint(const Vec2F& point)
     {
         return mDrawingScissorRect.IsInside(point) && layout->IsPointInside(point);
     }
 
+    RectF Widget::GetUnderPointBounds() const
+    {
+        Basis worldBasis = layout->GetWorldBasis();
+        Vec2F size = layout->GetScale()*layout->GetSize();
+        Basis pointInsideBasis(worldBasis.origin, worldBasis.xv.Normalized()*size.x, worldBasis.yv.Normalized()*size.y);
+
+        return pointInsideBasis.AABB().GetIntersection(mDrawingScissorRect);
+    }
+
     void Widget::SetIndexInSiblings(int index)
     {
         Actor::SetIndexInSiblings(index);
@@ -963,8 +1058,12 @@ namespace o2
 
     void Widget::CheckClipping(const RectF& clipArea)
     {
+        bool wasClipped = mIsClipped;
         mIsClipped = !mBoundsWithChilds.IsIntersects(clipArea);
 
+        if (wasClipped != mIsClipped)
+            InvalidateStaticBatch();
+
         for (auto& child : mChildWidgets)
             child->CheckClipping(clipArea);
     }
@@ -984,6 +1083,8 @@ namespace o2
 
         for (auto& child : mInternalWidgets)
             child->UpdateTransparency();
+
+        InvalidateStaticBatch();
     }
 
     void Widget::UpdateVisibility(bool updateLayout /*= true*/)
@@ -1010,6 +1111,7 @@ namespace o2
             layer->UpdateLayout();
 
         UpdateBounds();
+        InvalidateStaticBatch();
     }
 
     void Widget::UpdateBounds()
@@ -1041,6 +1143,8 @@ namespace o2
     {
         const float topLayersDepth = 1000.0f;
 
+        InvalidateStaticBatch();
+
         mDrawingLayers.Clear();
         mTopDrawingLayers.Clear();
 
@@ -1186,11 +1290,13 @@ namespace o2
     void Widget::OnChildrenChanged()
     {
         SortInheritedDrawables();
+        InvalidateStaticBatch();
     }
 
     void Widget::OnChildAdded(const Ref<Actor>& child)
     {
         layout->SetDirty(false);
+        InvalidateStaticBatch();
 
         Ref<Widget> widget = DynamicCast<Widget>(child);
         if (widget)
@@ -1209,6 +1315,7 @@ namespace o2
     void Widget::OnChildRemoved(const Ref<Actor>& child)
     {
         layout->SetDirty();
+        InvalidateStaticBatch();
 
         auto widget = DynamicCast<Widget>(child);
         if (widget)
@@ -1340,6 +1447,8 @@ namespace o2
 
         for (auto& child : mInternalWidgets)
             child->UpdateResEnabledInHierarchy(withChildren);
+
+        InvalidateStaticBatch();
     }
 
     void Widget::SetInternalParent(const Ref<Widget>& parent, bool worldPositionStays /*= false*/)
@@ -1429,9 +1538,13 @@ namespace o2
 
     void Widget::MoveAndCheckClipping(const Vec2F& delta, const RectF& clipArea)
     {
+        bool wasClipped = mIsClipped;
         mBoundsWithChilds += delta;
         mIsClipped = !mBoundsWithChilds.IsIntersects(clipArea);
 
+        if (wasClipped != mIsClipped)
+            InvalidateStaticBatch();
+
         if (!mIsClipped)
             UpdateSelfTransform();
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "o2/Assets/Types/AnimationAsset.h"
+#include "o2/Events/CursorAreaEventsListener.h"
+#include "o2/Render/DrawBatchCache.h"
 #include "o2/Scene/Actor.h"
 #include "o2/Scene/ISceneDrawable.h"
 #include "o2/Scene/SceneLayer.h"
@@ -31,6 +33,7 @@ namespace o2
         PROPERTY(bool, enabledForcibly, SetEnabledForcible, IsEnabled); // Enable property, works forcibly @EDITOR_IGNORE @ANIMATABLE 
 
         PROPERTY(float, transparency, SetTransparency, GetTransparency); // Transparency property 
+        PROPERTY(bool, staticBatching, SetStaticBatching, IsStaticBatching); // Static batching property
         GETTER(float, resTransparency, GetResTransparency);              // Result transparency getter, depends on parent transparency @EDITOR_IGNORE @ANIMATABLE
 
         GETTER(Vector<Ref<Widget>>, childrenWidgets, GetChildrenNonConst); // Widget children getter
@@ -222,9 +225,26 @@ namespace o2
         // Sets widget can be focused @SCRIPTABLE
         void SetFocusable(bool focusable);
 
+        // Sets static batching. When enabled, widget and its children are captured once and drawn from cache without
+        // traversing children until layout, transparency, state, children or layers drawables are changed. When
+        // something in subtree is drawn not by layers, capture falls back to usual drawing @SCRIPTABLE
+        void SetStaticBatching(bool enabled);
+
+        // Returns is static batching enabled @SCRIPTABLE
+        bool IsStaticBatching() const;
+
+        // Returns is static batch captured and actual, so widget is drawn from cache @SCRIPTABLE
+        bool IsStaticBatchActual() const;
+
+        // Resets static batch cache of this widget and its parents @SCRIPTABLE
+        void InvalidateStaticBatch();
+
         // Returns true if point is under drawable @SCRIPTABLE
         bool IsUnderPoint(const Vec2F& point) override;
 
+        // Returns rectangle outside of which widget's area can't be under point
+        RectF GetUnderPointBounds() const;
+
         // Sets parent,  doesn't adds to parent's children but adds to internal children @SCRIPTABLE
         void SetInternalParent(const Ref<Widget>& parent, bool worldPositionStays = false);
 
@@ -285,6 +305,13 @@ namespace o2
 
         bool mIsClipped = false; // Is widget fully clipped by some scissors
 
+        bool                mStaticBatching = false;   // Is widget and its children drawing from cached batch @SERIALIZABLE
+        bool                mStaticBatchValid = false; // Is static batch cache actual
+        Ref<DrawBatchCache> mStaticBatch;              // Cached batch of widget and children drawing buffers
+
+        Vector<WeakRef<CursorAreaEventsListener>> mStaticBatchListeners;          // Cursor listeners drawn in static batch, they are registered again when batch is replayed
+        int                                       mStaticBatchListenersBegin = 0; // Index of first drawn cursor listener at static batch capture beginning
+
         RectF mBounds;           // Widget bounds by drawing layers
         RectF mBoundsWithChilds; // Widget with childs bounds
 
@@ -340,6 +367,16 @@ namespace o2
         // Called when actor excluding from scene, removes this from layer drawables
         void OnRemoveFromScene() override;
 
+        // Draws widget from static batch cache when it's actual. Returns true when widget was drawn from cache
+        bool DrawStaticBatch();
+
+        // Begins capturing drawing into static batch cache when static batching is enabled and there is no other
+        // capture. Returns true when capturing began
+        bool BeginStaticBatchCapture();
+
+        // Ends capturing drawing into static batch cache
+        void EndStaticBatchCapture();
+
 		// Draws widget's layers (below children)
         virtual void DrawLayers();
 
@@ -748,6 +785,7 @@ CLASS_FIELDS_META(o2::Widget)
 {
     FIELD().PUBLIC().ANIMATABLE_ATTRIBUTE().EDITOR_IGNORE_ATTRIBUTE().NAME(enabledForcibly);
     FIELD().PUBLIC().NAME(transparency);
+    FIELD().PUBLIC().NAME(staticBatching);
     FIELD().PUBLIC().ANIMATABLE_ATTRIBUTE().EDITOR_IGNORE_ATTRIBUTE().NAME(resTransparency);
     FIELD().PUBLIC().NAME(childrenWidgets);
     FIELD().PUBLIC().NAME(layers);
@@ -775,6 +813,11 @@ CLASS_FIELDS_META(o2::Widget)
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(mIsFocusable);
     FIELD().PROTECTED().DEFAULT_TYPE_ATTRIBUTE(o2::WidgetState).DONT_DELETE_ATTRIBUTE().NAME(mVisibleState);
     FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mIsClipped);
+    FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().DEFAULT_VALUE(false).NAME(mStaticBatching);
+    FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mStaticBatchValid);
+    FIELD().PROTECTED().NAME(mStaticBatch);
+    FIELD().PROTECTED().NAME(mStaticBatchListeners);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mStaticBatchListenersBegin);
     FIELD().PROTECTED().NAME(mBounds);
     FIELD().PROTECTED().NAME(mBoundsWithChilds);
 #if  IS_EDITOR
@@ -842,7 +885,12 @@ CLASS_METHODS_META(o2::Widget)
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(bool, IsFocused);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(bool, IsFocusable);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, SetFocusable, bool);
+    FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, SetStaticBatching, bool);
+    FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(bool, IsStaticBatching);
+    FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(bool, IsStaticBatchActual);
+    FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, InvalidateStaticBatch);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(bool, IsUnderPoint, const Vec2F&);
+    FUNCTION().PUBLIC().SIGNATURE(RectF, GetUnderPointBounds);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, SetInternalParent, const Ref<Widget>&, bool);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, AddInternalWidget, const Ref<Widget>&, bool);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(void, RemoveInternalWidget, const Ref<Widget>&);
@@ -867,6 +915,9 @@ CLASS_METHODS_META(o2::Widget)
     FUNCTION().PROTECTED().SIGNATURE(void, OnChildRemoved, const Ref<Actor>&);
     FUNCTION().PROTECTED().SIGNATURE(void, OnAddToScene);
     FUNCTION().PROTECTED().SIGNATURE(void, OnRemoveFromScene);
+    FUNCTION().PROTECTED().SIGNATURE(bool, DrawStaticBatch);
+    FUNCTION().PROTECTED().SIGNATURE(bool, BeginStaticBatchCapture);
+    FUNCTION().PROTECTED().SIGNATURE(void, EndStaticBatchCapture);
     FUNCTION().PROTECTED().SIGNATURE(void, DrawLayers);
     FUNCTION().PROTECTED().SIGNATURE(void, DrawTopLayers);
     FUNCTION().PROTECTED().SIGNATURE(void, DrawInternalChildren);
@@ -108,7 +108,11 @@ namespace o2
     void WidgetLayer::Draw()
     {
         if (mEnabled && mResTransparency > FLT_EPSILON)
+        {
+            o2Render.BeginTrackedDrawing(mDrawable);
             mDrawable->Draw();
+            o2Render.EndTrackedDrawing();
+        }
     }
 
     bool WidgetLayer::IsEnabled() const
@@ -125,6 +129,9 @@ namespace o2
     void WidgetLayer::SetEnabled(bool enabled)
     {
         mEnabled = enabled;
+
+        if (auto ownerWidget = mOwnerWidget.Lock())
+            ownerWidget->InvalidateStaticBatch();
     }
 
     Ref<WidgetLayer> WidgetLayer::AddChild(const Ref<WidgetLayer>& layer)
@@ -522,6 +529,9 @@ namespace o2
 
         for (auto& child : mChildren)
             child->UpdateResTransparency();
+
+        if (auto ownerWidget = mOwnerWidget.Lock())
+            ownerWidget->InvalidateStaticBatch();
     }
 
     void WidgetLayer::OnAddToScene()
@@ -731,6 +731,11 @@ namespace o2
         return mDrawingScissorRect.IsInside(point) && mAbsoluteViewArea.IsInside(point);
     }
 
+    RectF EditBox::GetCursorAreaBounds() const
+    {
+        return mAbsoluteViewArea.GetIntersection(mDrawingScissorRect);
+    }
+
     bool EditBox::IsInputTransparent() const
     {
         return false;
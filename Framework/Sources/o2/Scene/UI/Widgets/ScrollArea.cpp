@@ -128,6 +128,14 @@ namespace o2
             return;
         }
 
+        if (DrawStaticBatch())
+        {
+            DrawDebugFrame();
+            return;
+        }
+
+        bool captureStaticBatch = BeginStaticBatchCapture();
+
         for (auto& layer : mDrawingLayers)
             layer->Draw();
 
@@ -148,6 +156,9 @@ namespace o2
         for (auto& layer : mTopDrawingLayers)
             layer->Draw();
 
+        if (captureStaticBatch)
+            EndStaticBatchCapture();
+
         DrawDebugFrame();
     }
 
@@ -493,6 +504,11 @@ namespace o2
         return Widget::IsUnderPoint(point);
     }
 
+    RectF ScrollArea::GetCursorAreaBounds() const
+    {
+        return GetUnderPointBounds();
+    }
+
     bool ScrollArea::IsScrollable() const
     {
         return true;
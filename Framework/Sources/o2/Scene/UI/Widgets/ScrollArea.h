@@ -111,6 +111,9 @@ namespace o2
         // Returns true if point is in this object
         bool IsUnderPoint(const Vec2F& point) override;
 
+        // Returns widget bounds
+        RectF GetCursorAreaBounds() const override;
+
         // Returns is listener scrollable
         bool IsScrollable() const override;
 
@@ -289,6 +292,7 @@ CLASS_METHODS_META(o2::ScrollArea)
     FUNCTION().PUBLIC().SIGNATURE(Layout, GetViewLayout);
     FUNCTION().PUBLIC().SIGNATURE(void, UpdateChildrenTransforms);
     FUNCTION().PUBLIC().SIGNATURE(bool, IsUnderPoint, const Vec2F&);
+    FUNCTION().PUBLIC().SIGNATURE(RectF, GetCursorAreaBounds);
     FUNCTION().PUBLIC().SIGNATURE(bool, IsScrollable);
     FUNCTION().PUBLIC().SIGNATURE(bool, IsInputTransparent);
     FUNCTION().PUBLIC().SIGNATURE_STATIC(String, GetCreateMenuGroup);
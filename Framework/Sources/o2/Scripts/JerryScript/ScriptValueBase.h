@@ -117,6 +117,23 @@ namespace o2
             jerry_value_t Get() override;
         };
 
+        struct IFieldAccessorContainer : public IDataContainer
+        {
+            virtual jerry_value_t Get(jerry_value_t thisValue) = 0;
+            virtual void Set(jerry_value_t thisValue, jerry_value_t value) = 0;
+        };
+
+        template<typename _object_type, typename _field_type>
+        struct FieldAccessorContainer : public IFieldAccessorContainer
+        {
+            void* (*pointerGetter)(void*) = nullptr;
+
+            jerry_value_t Get(jerry_value_t thisValue) override;
+            void Set(jerry_value_t thisValue, jerry_value_t value) override;
+
+            _field_type* GetFieldPtr(jerry_value_t thisValue) const;
+        };
+
         struct DataContainerDeleter
         {
             jerry_object_native_info_t info;
@@ -143,6 +160,16 @@ namespace o2
                                               const jerry_value_t args_p[],
                                               const jerry_length_t args_count);
 
+        static jerry_value_t FieldAccessorSetter(const jerry_value_t function_obj,
+                                                 const jerry_value_t this_val,
+                                                 const jerry_value_t args_p[],
+                                                 const jerry_length_t args_count);
+
+        static jerry_value_t FieldAccessorGetter(const jerry_value_t function_obj,
+                                                 const jerry_value_t this_val,
+                                                 const jerry_value_t args_p[],
+                                                 const jerry_length_t args_count);
+
         template<size_t _i = 0, size_t _j = 0, typename... _args>
         static void UnpackArgs(std::tuple<_args ...>& argst, jerry_value_t* args, int argsCount);
 
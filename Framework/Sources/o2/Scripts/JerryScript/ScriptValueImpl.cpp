@@ -109,11 +109,15 @@ namespace o2
         else if (type == ValueType::Object)
         {
             ScriptValue res = EmptyObject();
-            ForEachProperties([&](const ScriptValue& name, const ScriptValue& value)
-                              {
-                                  res[name] = value.Copy();
-                                  return true;
-                              });
+            auto copyProperty = [&](const ScriptValue& name, const ScriptValue& value)
+            {
+                res[name] = value.Copy();
+                return true;
+            };
+
+            // Reflected fields accessors are got from prototypes with this object as receiver
+            ForEachProperties(copyProperty);
+            ForEachPrototypesAccessors(copyProperty);
             return res;
         }
 
@@ -237,6 +241,57 @@ namespace o2
             GetPrototype().ForEachProperties(func, withPrototypes);
     }
 
+    void ScriptValue::ForEachPrototypesAccessors(const Function<bool(const ScriptValue& name, const ScriptValue& value)>& func) const
+    {
+        if (GetValueType() != ValueType::Object)
+            return;
+
+        // Returns true when property is defined in this object or in prototype closer than specified
+        auto isShadowed = [&](const ScriptValue& name, const ScriptValue& prototype)
+        {
+            for (ScriptValue object = *this; object.jvalue != prototype.jvalue; object = object.GetPrototype())
+            {
+                ScriptValue hasProperty;
+                hasProperty.Accept(jerry_has_own_property(object.jvalue, name.jvalue));
+                if (jerry_get_boolean_value(hasProperty.jvalue))
+                    return true;
+            }
+
+            return false;
+        };
+
+        for (ScriptValue prototype = GetPrototype(); prototype.GetValueType() == ValueType::Object;
+             prototype = prototype.GetPrototype())
+        {
+            ScriptValue names;
+            names.Accept(jerry_object_get_property_names(prototype.jvalue, (jerry_property_filter_t)(
+                JERRY_PROPERTY_FILTER_EXLCUDE_NON_ENUMERABLE | JERRY_PROPERTY_FILTER_EXLCUDE_SYMBOLS)));
+
+            int namesCount = names.GetLength();
+            for (int i = 0; i < namesCount; i++)
+            {
+                ScriptValue name = names.GetElement(i);
+
+                jerry_property_descriptor_t descr;
+                jerry_init_property_descriptor_fields(&descr);
+
+                bool isAccessor = jerry_get_own_property_descriptor(prototype.jvalue, name.jvalue, &descr) &&
+                    descr.is_get_defined;
+
+                jerry_free_property_descriptor_fields(&descr);
+
+                if (!isAccessor || isShadowed(name, prototype))
+                    continue;
+
+                ScriptValue value;
+                value.Accept(jerry_get_property(jvalue, name.jvalue));
+
+                if (!func(name, value))
+                    return;
+            }
+        }
+    }
+
     ScriptValue ScriptValue::GetProperty(const ScriptValue& name) const
     {
         if (GetValueType() != ValueType::Object)
@@ -454,6 +509,35 @@ namespace o2
         return container->Get();
     }
 
+    jerry_value_t ScriptValueBase::FieldAccessorSetter(const jerry_value_t function_obj,
+                                                       const jerry_value_t this_val,
+                                                       const jerry_value_t args_p[],
+                                                       const jerry_length_t args_count)
+    {
+        void* ptr = nullptr;
+        jerry_get_object_native_pointer(function_obj, &ptr, &GetDataDeleter().info);
+
+        if (args_count > 0)
+        {
+            IFieldAccessorContainer* container = static_cast<IFieldAccessorContainer*>((IDataContainer*)ptr);
+            container->Set(this_val, args_p[0]);
+        }
+
+        return jerry_create_undefined();
+    }
+
+    jerry_value_t ScriptValueBase::FieldAccessorGetter(const jerry_value_t function_obj,
+                                                       const jerry_value_t this_val,
+                                                       const jerry_value_t args_p[],
+                                                       const jerry_length_t args_count)
+    {
+        void* ptr = nullptr;
+        jerry_get_object_native_pointer(function_obj, &ptr, &GetDataDeleter().info);
+
+        IFieldAccessorContainer* container = static_cast<IFieldAccessorContainer*>((IDataContainer*)ptr);
+        return container->Get(this_val);
+    }
+
     ScriptValue*& ScriptValuePrototypes::GetVec2Prototype()
     {
         static ScriptValue* value;
@@ -553,6 +637,24 @@ namespace o2
         return GetNameSpaceAndConstructor(subPathProp, path.SubStr(fnd + 2), constructor);
     }
 
+    const ScriptValue& ScriptPrototypeProcessor::GetFreeOwnershipFunction()
+    {
+        static ScriptValue func = []()
+        {
+            ScriptValue res;
+            res.SetThisFunction<ScriptValue>(Function<ScriptValue(ScriptValue)>(
+                [](ScriptValue thisValue)
+                {
+                    thisValue.SetObjectOwnership(false);
+                    return thisValue;
+                }));
+
+            return res;
+        }();
+
+        return func;
+    }
+
     void ScriptPrototypeProcessor::RegisterTypeConstructor(Type* type, ScriptValue& constructorFunc)
     {
         String constructor;
@@ -218,6 +218,59 @@ namespace o2
         setter(tmp.GetValue<_type>());
     }
 
+    template<typename _object_type, typename _field_type>
+    _field_type* ScriptValueBase::FieldAccessorContainer<_object_type, _field_type>::GetFieldPtr(jerry_value_t thisValue) const
+    {
+        void* dataPtr = nullptr;
+        jerry_get_object_native_pointer(thisValue, &dataPtr, &GetDataDeleter().info);
+        auto dataContainer = (IDataContainer*)dataPtr;
+        if (!dataContainer)
+            return nullptr;
+
+        _object_type* object = nullptr;
+        if (dataContainer->GetType() == &TypeOf(_object_type))
+            object = (_object_type*)dataContainer->GetData();
+        else
+            object = dynamic_cast<_object_type*>(dataContainer->TryCastToIObject());
+
+        if (!object)
+            return nullptr;
+
+        return (_field_type*)(*pointerGetter)(object);
+    }
+
+    template<typename _object_type, typename _field_type>
+    jerry_value_t ScriptValueBase::FieldAccessorContainer<_object_type, _field_type>::Get(jerry_value_t thisValue)
+    {
+        auto fieldPtr = GetFieldPtr(thisValue);
+        if (!fieldPtr)
+            return jerry_create_undefined();
+
+        ScriptValue tmp;
+        if constexpr (IsProperty<_field_type>::value)
+            tmp.SetValue<typename ExtractPropertyValueType<_field_type>::type>(fieldPtr->Get());
+        else
+            tmp.SetValue<_field_type>(*fieldPtr);
+
+        return jerry_acquire_value(tmp.jvalue);
+    }
+
+    template<typename _object_type, typename _field_type>
+    void ScriptValueBase::FieldAccessorContainer<_object_type, _field_type>::Set(jerry_value_t thisValue, jerry_value_t value)
+    {
+        auto fieldPtr = GetFieldPtr(thisValue);
+        if (!fieldPtr)
+            return;
+
+        ScriptValue tmp;
+        tmp.AcquireValue(value);
+
+        if constexpr (IsProperty<_field_type>::value)
+            fieldPtr->Set(tmp.GetValue<typename ExtractPropertyValueType<_field_type>::type>());
+        else
+            *fieldPtr = tmp.GetValue<_field_type>();
+    }
+
     template<size_t _i /*= 0*/, size_t _j /*= 0*/, typename... _args>
     void ScriptValueBase::UnpackArgs(std::tuple<_args ...>& argst, jerry_value_t* args, int argsCount)
     {
@@ -297,18 +350,21 @@ namespace o2
         dataContainer->isDataOwner = owner;
         jerry_set_object_native_pointer(jvalue, (IDataContainer*)dataContainer, &GetDataDeleter().info);
 
+        // Fields accessors and FreeOwnership function of reflected objects are shared in type prototype
         if constexpr (std::is_base_of<IObject, _type>::value)
         {
             object->ReflectIntoScriptValue(*this);
             SetPrototype(_type::GetScriptPrototype());
         }
-
-        SetProperty("FreeOwnership", Function<ScriptValue()>(
-            [d = dataContainer, j = jvalue]() {
-                d->isDataOwner = false;
-                ScriptValue th; th.AcquireValue(j);
-                return th;
-            }));
+        else
+        {
+            SetProperty("FreeOwnership", Function<ScriptValue()>(
+                [d = dataContainer, j = jvalue]() {
+                    d->isDataOwner = false;
+                    ScriptValue th; th.AcquireValue(j);
+                    return th;
+                }));
+        }
     }
 
 
@@ -451,6 +507,39 @@ namespace o2
         jerry_free_property_descriptor_fields(&propertyDescriptor);
     }
 
+    template<typename _object_type, typename _field_type>
+    void ScriptValue::SetFieldAccessor(const ScriptValue& name, void* (*pointerGetter)(void*))
+    {
+        if (GetValueType() != ValueType::Object)
+        {
+            jerry_release_value(jvalue);
+            jvalue = jerry_create_object();
+        }
+
+        jerry_property_descriptor_t propertyDescriptor;
+        jerry_init_property_descriptor_fields(&propertyDescriptor);
+
+        propertyDescriptor.is_enumerable = true;
+        propertyDescriptor.is_enumerable_defined = true;
+
+        propertyDescriptor.is_get_defined = true;
+        propertyDescriptor.getter = jerry_create_external_function(FieldAccessorGetter);
+        auto getterContainer = new FieldAccessorContainer<_object_type, _field_type>();
+        getterContainer->pointerGetter = pointerGetter;
+        jerry_set_object_native_pointer(propertyDescriptor.getter, (IDataContainer*)getterContainer, &GetDataDeleter().info);
+
+        propertyDescriptor.is_set_defined = true;
+        propertyDescriptor.setter = jerry_create_external_function(FieldAccessorSetter);
+        auto setterContainer = new FieldAccessorContainer<_object_type, _field_type>();
+        setterContainer->pointerGetter = pointerGetter;
+        jerry_set_object_native_pointer(propertyDescriptor.setter, (IDataContainer*)setterContainer, &GetDataDeleter().info);
+
+        jerry_value_t newPropertyValue = jerry_define_own_property(jvalue, name.jvalue, &propertyDescriptor);
+        jerry_release_value(newPropertyValue);
+
+        jerry_free_property_descriptor_fields(&propertyDescriptor);
+    }
+
     template<typename _res_type, typename ... _args>
     _res_type ScriptValue::Invoke(_args ... args) const
     {
@@ -526,7 +615,54 @@ namespace o2
         ScriptValue proto = ScriptValue::EmptyObject();
         bool hasBaseClass = false;
 
+        ScriptValue fieldsProto; // Prototype for fields accessors of bases out of prototypes chain. Undefined for main type
+
     public:
+        struct FieldProcessor;
+
+        struct BaseFieldProcessor
+        {
+            ScriptPrototypeProcessor& processor;
+            ProtectSection section = ProtectSection::Public;
+
+        public:
+            BaseFieldProcessor(ScriptPrototypeProcessor& processor) : processor(processor) {}
+
+            template<typename _attribute_type, typename ... _args>
+            auto AddAttribute(_args ... args);
+
+            template<typename _type>
+            BaseFieldProcessor& SetDefaultValue(const _type& value) { return *this; }
+
+            BaseFieldProcessor& SetProtectSection(ProtectSection section)
+            {
+                this->section = section;
+                return *this;
+            }
+
+            template<typename _object_type, typename _field_type>
+            BaseFieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, void* (*pointerGetter)(void*),
+                                            _field_type& field)
+            {
+                return *this;
+            }
+        };
+
+        struct FieldProcessor : public BaseFieldProcessor
+        {
+            FieldProcessor(const BaseFieldProcessor& processor) :BaseFieldProcessor(processor) {}
+
+            template<typename _attribute_type, typename ... _args>
+            FieldProcessor& AddAttribute(_args ... args) { return *this; }
+
+            template<typename _type>
+            FieldProcessor& SetDefaultValue(const _type& value) { return *this; }
+
+            template<typename _object_type, typename _field_type>
+            FieldProcessor& FieldBasics(_object_type* object, Type* type, const char* name, void* (*pointerGetter)(void*),
+                                        _field_type& field);
+        };
+
         struct BaseFunctionProcessor : public BaseTypeProcessor::FunctionProcessor
         {
             ScriptPrototypeProcessor& processor;
@@ -560,25 +696,72 @@ namespace o2
                                  _res_type(*pointer)(_args ...));
         };
 
+        template<typename _object_type>
+        void Start(_object_type* object, Type* type)
+        {
+            _object_type::GetScriptPrototype().SetProperty(ScriptValue("FreeOwnership"), GetFreeOwnershipFunction());
+        }
+
+        BaseFieldProcessor StartField() { return BaseFieldProcessor(*this); }
+
         BaseFunctionProcessor StartFunction() { return BaseFunctionProcessor(*this); }
 
         template<typename _object_type, typename _base_type>
         void BaseType(_object_type* object, Type* type, const char* name)
         {
-            if (hasBaseClass)
-                return;
-
             if constexpr (std::is_base_of<ISerializable, _base_type>::value && !std::is_same<ISerializable, _base_type>::value)
             {
-                _object_type::GetScriptPrototype().SetPrototype(_base_type::GetScriptPrototype());
-                hasBaseClass = true;
+                if (!hasBaseClass && !fieldsProto.IsObject())
+                {
+                    _object_type::GetScriptPrototype().SetPrototype(_base_type::GetScriptPrototype());
+                    hasBaseClass = true;
+                }
+                else
+                {
+                    // Only first base is in prototypes chain, fields accessors of other bases are copied into this prototype
+                    ScriptPrototypeProcessor baseProcessor;
+                    baseProcessor.fieldsProto = fieldsProto.IsObject() ? fieldsProto : _object_type::GetScriptPrototype();
+                    _base_type::template ProcessBaseTypes<ScriptPrototypeProcessor>(nullptr, baseProcessor);
+                    _base_type::template ProcessFields<ScriptPrototypeProcessor>(nullptr, baseProcessor);
+                }
             }
         }
 
+        // Returns FreeOwnership function, shared between all types prototypes
+        static const ScriptValue& GetFreeOwnershipFunction();
+
         static void RegisterTypeConstructor(Type* type, ScriptValue& constructorFunc);
         static void RegisterTypeStaticFunction(Type* type, const char* name, const ScriptValue& func);
     };
 
+    template<typename _attribute_type, typename ... _args>
+    auto ScriptPrototypeProcessor::BaseFieldProcessor::AddAttribute(_args ... args)
+    {
+        if constexpr (std::is_same<ScriptableAttribute, _attribute_type>::value)
+            return ScriptPrototypeProcessor::FieldProcessor(*this);
+        else
+            return *this;
+    }
+
+    template<typename _object_type, typename _field_type>
+    ScriptPrototypeProcessor::FieldProcessor&
+    ScriptPrototypeProcessor::FieldProcessor::FieldBasics(_object_type* object, Type* type, const char* name,
+                                                          void* (*pointerGetter)(void*), _field_type& field)
+    {
+        if (section != ProtectSection::Public)
+            return *this;
+
+        if constexpr (std::is_copy_constructible<_field_type>::value)
+        {
+            if (processor.fieldsProto.IsObject())
+                processor.fieldsProto.SetFieldAccessor<_object_type, _field_type>(ScriptValue(name), pointerGetter);
+            else
+                _object_type::GetScriptPrototype().template SetFieldAccessor<_object_type, _field_type>(ScriptValue(name), pointerGetter);
+        }
+
+        return *this;
+    }
+
     template<typename _attribute_type, typename ... _args>
     auto ScriptPrototypeProcessor::BaseFunctionProcessor::AddAttribute(_args ... args)
     {
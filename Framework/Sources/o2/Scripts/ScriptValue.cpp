@@ -59,10 +59,13 @@ namespace o2
         {
             res += "\n" + tab + "{\n";
 
-            ForEachProperties([&](const ScriptValue& name, const ScriptValue& value) {
+            auto dumpProperty = [&](const ScriptValue& name, const ScriptValue& value) {
                 res += tab + "  " + name.Dump(tab + "  ") + " : " + value.Dump(tab + "  ") + ",\n";
                 return true;
-            }, false);
+            };
+
+            ForEachProperties(dumpProperty, false);
+            ForEachPrototypesAccessors(dumpProperty);
 
 
             if (GetPrototype().GetValueType() != ValueType::Null)
@@ -118,6 +118,10 @@ namespace o2 {
         void ForEachProperties(const Function<bool(const ScriptValue &name, const ScriptValue &value)> &func,
                                bool withPrototypes = true) const;
 
+        // Iterates enumerable accessors from prototypes chain, like reflected fields. Values are got with this object as
+        // receiver, accessors shadowed by closer properties are skipped
+        void ForEachPrototypesAccessors(const Function<bool(const ScriptValue &name, const ScriptValue &value)> &func) const;
+
         // Returns property value
         ScriptValue GetProperty(const ScriptValue &name) const;
 
@@ -164,6 +168,11 @@ namespace o2 {
         void SetPropertyWrapper(const ScriptValue &name, const Function<void(const _type &value)> &setter,
                                 const Function<_type()> &getter);
 
+        // Sets field accessor. Accessor reads field from native object of receiver, so it can be shared in prototype
+        // between all objects of type
+        template<typename _object_type, typename _field_type>
+        void SetFieldAccessor(const ScriptValue &name, void* (*pointerGetter)(void*));
+
         // Removes property
         void RemoveProperty(const ScriptValue &name);
 
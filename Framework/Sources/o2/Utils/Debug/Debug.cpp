@@ -9,8 +9,7 @@
 #include "o2/Render/Text.h"
 #include "o2/Render/VectorFont.h"
 #include "o2/Render/VectorFontEffects.h"
-#include "o2/Utils/Debug/Log/ConsoleLogStream.h"
-#include "o2/Utils/Debug/Log/FileLogStream.h"
+#include "o2/Utils/Debug/Log/AsyncLogStream.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/Editor/EditorScope.h"
 
@@ -21,9 +20,10 @@ namespace o2
     Debug::Debug(RefCounter* refCounter):
         Singleton<Debug>(refCounter)
     {
-        mFileLogStream = mmake<FileLogStream>("", "log.txt");
-        mLogStream = mmake<ConsoleLogStream>("");
-        mFileLogStream->BindStream(mLogStream);
+        mLogStream = mmake<AsyncLogStream>("", "log.txt");
+
+        if (ENABLE_LOG_CRASH_HANDLERS)
+            AsyncLogStream::InstallCrashHandlers();
     }
 
     Debug::~Debug()
@@ -119,6 +119,12 @@ namespace o2
         return mInstance->mLogStream;
     }
 
+    void Debug::FlushLog()
+    {
+        if (auto asyncLogStream = DynamicCast<AsyncLogStream>(mInstance->mLogStream))
+            asyncLogStream->Flush();
+    }
+
     void Debug::DrawRect(const RectF& rect, const Color4& color, float delay)
     {
         GetCurrentScopeDrawables().Add(mmake<DbgRect>(rect, color, delay));
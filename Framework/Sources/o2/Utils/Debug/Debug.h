@@ -47,6 +47,9 @@ namespace o2
         // Returns pointer to main log
         const Ref<LogStream>& GetLog();
 
+        // Waits until all main log messages are written into file and console
+        void FlushLog();
+
         // Draws debug line from begin to end with color and disappearing delay
         void DrawLine(const Vec2F& begin, const Vec2F& end, const Color4& color, float delay);
 
@@ -219,8 +222,7 @@ namespace o2
         };
 
     protected:
-        Ref<LogStream> mFileLogStream; // File log stream
-        Ref<LogStream> mLogStream;     // Main log stream
+        Ref<LogStream> mLogStream; // Main log stream, writes into file and console asynchronously
 
         Vector<Ref<IDbgDrawable>> mDbgDrawables;       // Debug drawables array
         Vector<Ref<IDbgDrawable>> mEditorDbgDrawables; // Debug drawables array for editor
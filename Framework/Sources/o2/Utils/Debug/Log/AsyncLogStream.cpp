@@ -0,0 +1,487 @@
+#include "o2/stdafx.h"
+#include "AsyncLogStream.h"
+
+#include <chrono>
+#include <csignal>
+#include <exception>
+
+#if defined PLATFORM_WINDOWS
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef PLATFORM_ANDROID
+#include <android/log.h>
+#endif
+
+namespace o2
+{
+    // Maximum size of batch, written into outputs at once
+    static constexpr size_t maxBatchSize = 64*1024;
+
+    // Head of async log streams list, flushed on crash
+    static std::atomic<AsyncLogStream*>& GetCrashFlushStreamsHead()
+    {
+        static std::atomic<AsyncLogStream*> head = nullptr;
+        return head;
+    }
+
+    // Guards adding and removing streams into crash flushing list
+    static std::mutex& GetCrashFlushStreamsMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // Writes batch of records into console
+    static void WriteConsole(const std::string& batch)
+    {
+#if defined PLATFORM_ANDROID
+        size_t lineBegin = 0;
+        while (lineBegin < batch.length())
+        {
+            size_t lineEnd = batch.find('\n', lineBegin);
+            if (lineEnd == std::string::npos)
+                lineEnd = batch.length();
+
+            __android_log_print(ANDROID_LOG_INFO, "o2: ", "%.*s", (int)(lineEnd - lineBegin), batch.data() + lineBegin);
+            lineBegin = lineEnd + 1;
+        }
+#else
+        fwrite(batch.data(), 1, batch.length(), stdout);
+#endif
+    }
+
+    // Writes data into file descriptor using only write(), safe to call from signal handler
+    static void WriteDescriptor(int descriptor, const char* data, size_t length)
+    {
+        while (length > 0)
+        {
+#if defined PLATFORM_WINDOWS
+            int written = _write(descriptor, data, (unsigned int)length);
+#else
+            auto written = write(descriptor, data, length);
+#endif
+            if (written <= 0)
+                return;
+
+            data += written;
+            length -= (size_t)written;
+        }
+    }
+
+    // Returns descriptor of file
+    static int GetFileDescriptor(FILE* file)
+    {
+#if defined PLATFORM_WINDOWS
+        return _fileno(file);
+#else
+        return fileno(file);
+#endif
+    }
+
+    AsyncLogStream::AsyncLogStream(const WString& id, const String& fileName, bool consoleOutput /*= true*/,
+                                   int queueCapacity /*= 8192*/):
+        LogStream(id), mConsoleOutput(consoleOutput)
+    {
+        if (!fileName.IsEmpty())
+        {
+            mFile = fopen(fileName.Data(), "w");
+            Assert(mFile, "Can't open file for logging");
+
+            // Records are already written by batches. Without file buffer written records are not lost on crash
+            if (mFile)
+            {
+                setvbuf(mFile, nullptr, _IONBF, 0);
+                mFileDescriptor = GetFileDescriptor(mFile);
+            }
+        }
+
+#if !defined PLATFORM_ANDROID
+        if (mConsoleOutput)
+            mConsoleDescriptor = GetFileDescriptor(stdout);
+#endif
+
+        UInt64 cellsCount = 2;
+        while (cellsCount < (UInt64)queueCapacity)
+            cellsCount <<= 1;
+
+        mCellsMask = cellsCount - 1;
+        mCells = new Cell[cellsCount];
+        for (UInt64 i = 0; i < cellsCount; i++)
+            mCells[i].sequence.store(i, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(GetCrashFlushStreamsMutex());
+            mNextStream = GetCrashFlushStreamsHead().load();
+            GetCrashFlushStreamsHead().store(this);
+        }
+
+        mWriteThread = std::thread(&AsyncLogStream::WriteThreadLoop, this);
+    }
+
+    AsyncLogStream::~AsyncLogStream()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mWakeMutex);
+            mStopping = true;
+        }
+
+        mWakeCondition.notify_one();
+        mWriteThread.join();
+
+        {
+            std::lock_guard<std::mutex> lock(GetCrashFlushStreamsMutex());
+
+            AsyncLogStream* prev = nullptr;
+            for (auto stream = GetCrashFlushStreamsHead().load(); stream; prev = stream, stream = stream->mNextStream)
+            {
+                if (stream != this)
+                    continue;
+
+                if (prev)
+                    prev->mNextStream = mNextStream;
+                else
+                    GetCrashFlushStreamsHead().store(mNextStream);
+
+                break;
+            }
+        }
+
+        if (mFile)
+            fclose(mFile);
+
+        delete[] mCells;
+    }
+
+    void AsyncLogStream::SetOverflowPolicy(OverflowPolicy policy)
+    {
+        mOverflowPolicy = policy;
+    }
+
+    AsyncLogStream::OverflowPolicy AsyncLogStream::GetOverflowPolicy() const
+    {
+        return mOverflowPolicy;
+    }
+
+    void AsyncLogStream::SetFlushPeriod(float period)
+    {
+        mFlushPeriod = period;
+    }
+
+    float AsyncLogStream::GetFlushPeriod() const
+    {
+        return mFlushPeriod;
+    }
+
+    void AsyncLogStream::Flush()
+    {
+        std::unique_lock<std::mutex> lock(mWakeMutex);
+
+        UInt64 request = ++mFlushRequests;
+        mWakeCondition.notify_one();
+        mFlushedCondition.wait(lock, [&]() { return mFlushesDone >= request; });
+    }
+
+    UInt64 AsyncLogStream::GetDroppedRecordsCount() const
+    {
+        return mDroppedRecordsCount;
+    }
+
+    UInt64 AsyncLogStream::GetBlockedRecordsCount() const
+    {
+        return mBlockedRecordsCount;
+    }
+
+    void AsyncLogStream::FlushAllOnCrash()
+    {
+        std::string batch;
+        for (auto stream = GetCrashFlushStreamsHead().load(); stream; stream = stream->mNextStream)
+        {
+            // Writing thread can hold the lock while writing batch, giving it some time to finish
+            bool locked = false;
+            for (int i = 0; i < 100 && !locked; i++)
+            {
+                locked = stream->mWriteMutex.try_lock();
+                if (!locked)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            if (locked)
+            {
+                stream->WriteQueuedRecords(batch);
+                stream->FlushOutputs();
+                stream->mWriteMutex.unlock();
+            }
+            else
+                stream->FlushOutputs();
+        }
+    }
+
+    void AsyncLogStream::WriteAllOnSignal()
+    {
+        static const char newLine = '\n';
+
+        for (auto stream = GetCrashFlushStreamsHead().load(); stream; stream = stream->mNextStream)
+        {
+            if (stream->mFileDescriptor < 0 && stream->mConsoleDescriptor < 0)
+                continue;
+
+            // Cells are not released until records are written, so ready cells texts are not changed by other threads
+            UInt64 position = stream->mPopPosition.load(std::memory_order_acquire);
+            for (UInt64 i = 0; i <= stream->mCellsMask; i++, position++)
+            {
+                Cell& cell = stream->mCells[position & stream->mCellsMask];
+                if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+                    break;
+
+                for (int descriptor : { stream->mFileDescriptor, stream->mConsoleDescriptor })
+                {
+                    if (descriptor < 0)
+                        continue;
+
+                    WriteDescriptor(descriptor, cell.text.data(), cell.text.length());
+                    WriteDescriptor(descriptor, &newLine, 1);
+                }
+            }
+        }
+    }
+
+    static std::terminate_handler previousTerminateHandler = nullptr;
+
+    // Fatal signals handled on crash and their previous handlers
+    static const int fatalSignals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+    static void (*previousSignalHandlers[4])(int) = { SIG_DFL, SIG_DFL, SIG_DFL, SIG_DFL };
+
+    static void OnFatalSignal(int signal)
+    {
+        AsyncLogStream::WriteAllOnSignal();
+
+        auto previousHandler = SIG_DFL;
+        for (int i = 0; i < 4; i++)
+        {
+            if (fatalSignals[i] == signal)
+                previousHandler = previousSignalHandlers[i];
+        }
+
+        std::signal(signal, previousHandler);
+        std::raise(signal);
+    }
+
+    void AsyncLogStream::InstallCrashHandlers()
+    {
+        static bool installed = false;
+        if (installed)
+            return;
+
+        installed = true;
+
+        previousTerminateHandler = std::set_terminate([]()
+        {
+            AsyncLogStream::FlushAllOnCrash();
+
+            if (previousTerminateHandler)
+                previousTerminateHandler();
+
+            std::abort();
+        });
+
+        for (int i = 0; i < 4; i++)
+        {
+            auto previousHandler = std::signal(fatalSignals[i], &OnFatalSignal);
+            if (previousHandler != SIG_ERR)
+                previousSignalHandlers[i] = previousHandler;
+        }
+    }
+
+    void AsyncLogStream::OutStrEx(const WString& str)
+    {
+        PushRecord(str, false);
+    }
+
+    void AsyncLogStream::OutErrorEx(const WString& str)
+    {
+        PushRecord("ERROR:" + str, true);
+
+        if (IsStoppingOnLogErrors())
+        {
+            Flush();
+            Assert(false, (const char*)((String)str));
+        }
+    }
+
+    void AsyncLogStream::PushRecord(const WString& str, bool urgent)
+    {
+        String utf8Str = str;
+        std::string text = std::move((std::string&)utf8Str);
+
+        if (!TryPush(text))
+        {
+            if (mOverflowPolicy == OverflowPolicy::Drop)
+            {
+                mDroppedRecordsCount++;
+                return;
+            }
+
+            // Waking writing thread and waiting for free space
+            mBlockedRecordsCount++;
+            mUrgent = true;
+            mWakeCondition.notify_one();
+
+            while (!TryPush(text))
+                std::this_thread::yield();
+        }
+
+        if (urgent)
+        {
+            std::lock_guard<std::mutex> lock(mWakeMutex);
+            mUrgent = true;
+            mWakeCondition.notify_one();
+        }
+    }
+
+    bool AsyncLogStream::TryPush(std::string& text)
+    {
+        UInt64 position = mPushPosition.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+
+        while (true)
+        {
+            cell = &mCells[position & mCellsMask];
+            UInt64 sequence = cell->sequence.load(std::memory_order_acquire);
+            Int64 diff = (Int64)sequence - (Int64)position;
+
+            if (diff == 0)
+            {
+                if (mPushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false;
+            else
+                position = mPushPosition.load(std::memory_order_relaxed);
+        }
+
+        cell->text = std::move(text);
+        cell->sequence.store(position + 1, std::memory_order_release);
+
+        // Waking writing thread each quarter of queue, so it has time to write records before queue overflows
+        if ((position & (mCellsMask >> 2)) == 0)
+            mWakeCondition.notify_one();
+
+        return true;
+    }
+
+    bool AsyncLogStream::WriteQueuedRecords(std::string& batch)
+    {
+        bool written = false;
+        UInt64 popPosition = mPopPosition.load(std::memory_order_relaxed);
+        UInt64 batchEndPosition = popPosition;
+
+        while (true)
+        {
+            Cell& cell = mCells[batchEndPosition & mCellsMask];
+            bool hasRecord = cell.sequence.load(std::memory_order_acquire) == batchEndPosition + 1;
+
+            if (hasRecord)
+            {
+                batch += cell.text;
+                batch += '\n';
+                batchEndPosition++;
+            }
+
+            if (!batch.empty() && (!hasRecord || batch.length() >= maxBatchSize))
+            {
+                if (mFile)
+                    fwrite(batch.data(), 1, batch.length(), mFile);
+
+                if (mConsoleOutput)
+                    WriteConsole(batch);
+
+                batch.clear();
+                written = true;
+
+                for (; popPosition < batchEndPosition; popPosition++)
+                {
+                    Cell& writtenCell = mCells[popPosition & mCellsMask];
+                    writtenCell.text.clear();
+                    writtenCell.sequence.store(popPosition + mCellsMask + 1, std::memory_order_release);
+                }
+
+                mPopPosition.store(popPosition, std::memory_order_release);
+            }
+
+            if (!hasRecord)
+                break;
+        }
+
+        return written;
+    }
+
+    void AsyncLogStream::FlushOutputs()
+    {
+        if (mFile)
+            fflush(mFile);
+
+        if (mConsoleOutput)
+            fflush(stdout);
+    }
+
+    void AsyncLogStream::WriteThreadLoop()
+    {
+        using Clock = std::chrono::steady_clock;
+
+        std::string batch;
+        batch.reserve(maxBatchSize);
+
+        auto lastFlushTime = Clock::now();
+        bool hasUnflushedRecords = false;
+
+        while (true)
+        {
+            UInt64 flushRequests = mFlushRequests.load(std::memory_order_acquire);
+            bool stopping = mStopping.load();
+            bool urgent = mUrgent.exchange(false);
+            auto flushPeriod = std::chrono::duration<float>(mFlushPeriod.load());
+
+            {
+                std::lock_guard<std::mutex> lock(mWriteMutex);
+                hasUnflushedRecords = WriteQueuedRecords(batch) || hasUnflushedRecords;
+
+                bool needFlush = urgent || stopping || flushRequests > mFlushesDone ||
+                    Clock::now() - lastFlushTime >= flushPeriod;
+
+                if (hasUnflushedRecords && needFlush)
+                {
+                    FlushOutputs();
+                    lastFlushTime = Clock::now();
+                    hasUnflushedRecords = false;
+                }
+            }
+
+            std::unique_lock<std::mutex> lock(mWakeMutex);
+
+            if (flushRequests > mFlushesDone)
+            {
+                mFlushesDone = flushRequests;
+                mFlushedCondition.notify_all();
+            }
+
+            if (stopping)
+                break;
+
+            if (!mUrgent && !mStopping && mFlushRequests == flushRequests)
+                mWakeCondition.wait_for(lock, flushPeriod);
+        }
+    }
+}
+// --- META ---
+
+ENUM_META(o2::AsyncLogStream::OverflowPolicy)
+{
+    ENUM_ENTRY(Block);
+    ENUM_ENTRY(Drop);
+}
+END_ENUM_META;
+// --- END META ---
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "o2/Utils/Debug/Log/LogStream.h"
+
+namespace o2
+{
+    // -------------------------------------------------------------------------------------------------------
+    // Asynchronous log stream. Messages are converted into UTF-8 records and pushed into lock-free bounded
+    // queue. Background thread writes records into file and console by batches and flushes them periodically.
+    // When queue is full, producer waits for free space or drops record, depending on overflow policy
+    // -------------------------------------------------------------------------------------------------------
+    class AsyncLogStream: public LogStream
+    {
+    public:
+        enum class OverflowPolicy { Block, Drop };
+
+    public:
+        // Constructor with id and file name. Empty file name disables file output
+        AsyncLogStream(const WString& id, const String& fileName, bool consoleOutput = true, int queueCapacity = 8192);
+
+        // Destructor. Writes remaining records and stops writing thread
+        ~AsyncLogStream() override;
+
+        // Sets queue overflow policy
+        void SetOverflowPolicy(OverflowPolicy policy);
+
+        // Returns queue overflow policy
+        OverflowPolicy GetOverflowPolicy() const;
+
+        // Sets period of flushing file and console, in seconds
+        void SetFlushPeriod(float period);
+
+        // Returns period of flushing file and console, in seconds
+        float GetFlushPeriod() const;
+
+        // Waits until all pushed records are written and flushed
+        void Flush();
+
+        // Returns count of records dropped because queue was full
+        UInt64 GetDroppedRecordsCount() const;
+
+        // Returns count of records pushed after waiting for free space in queue
+        UInt64 GetBlockedRecordsCount() const;
+
+        // Writes and flushes remaining records of all async log streams from current thread. Called on terminate
+        static void FlushAllOnCrash();
+
+        // Writes remaining records of all async log streams using only write(), without locks and allocations, so
+        // it can be called from signal handler. Records being written by writing thread at this moment can be doubled
+        static void WriteAllOnSignal();
+
+        // Installs terminate and fatal signals handlers, which write remaining records of all async log streams.
+        // Installed by Debug only when ENABLE_LOG_CRASH_HANDLERS is set
+        static void InstallCrashHandlers();
+
+    protected:
+        // ----------------------------------------------------------------------------
+        // Queue cell. Sequence tells whether cell is free for pushing or ready to pop
+        // ----------------------------------------------------------------------------
+        struct Cell
+        {
+            std::atomic<UInt64> sequence;
+            std::string         text;
+        };
+
+    protected:
+        FILE* mFile = nullptr;         // Output file, null when file output is disabled. Not buffered
+        bool  mConsoleOutput = true;   // Is records written into console
+
+        int mFileDescriptor = -1;    // Output file descriptor, used for writing on fatal signal
+        int mConsoleDescriptor = -1; // Console descriptor, used for writing on fatal signal
+
+        Cell*               mCells = nullptr;  // Queue cells ring
+        UInt64              mCellsMask = 0;    // Cells count minus one, count is power of two
+        std::atomic<UInt64> mPushPosition = 0; // Position of next pushing record
+        std::atomic<UInt64> mPopPosition = 0;  // Position of first not written record. Changed under write mutex
+
+        std::atomic<OverflowPolicy> mOverflowPolicy = OverflowPolicy::Block; // Queue overflow policy
+        std::atomic<float>          mFlushPeriod = 0.1f;                     // Flush period in seconds
+
+        std::atomic<UInt64> mDroppedRecordsCount = 0; // Count of dropped records
+        std::atomic<UInt64> mBlockedRecordsCount = 0; // Count of records waited for free space
+
+        std::mutex              mWriteMutex;       // Guards popping records and writing into outputs
+        std::mutex              mWakeMutex;        // Mutex for wake and flush conditions
+        std::condition_variable mWakeCondition;    // Wakes writing thread
+        std::condition_variable mFlushedCondition; // Notifies waiters of flush
+        std::atomic<bool>       mUrgent = false;   // Is records must be written and flushed without waiting period
+        std::atomic<UInt64>     mFlushRequests = 0; // Count of requested flushes
+        UInt64                  mFlushesDone = 0;   // Count of flush requests completed, guarded by wake mutex
+        std::atomic<bool>       mStopping = false;  // Is writing thread stopping
+
+        AsyncLogStream* mNextStream = nullptr; // Next stream in crash flushing list
+
+        std::thread mWriteThread; // Background writing thread
+
+    protected:
+        // Pushes record into queue
+        void OutStrEx(const WString& str) override;
+
+        // Pushes error record into queue, flushes it when stopping on errors
+        void OutErrorEx(const WString& str) override;
+
+        // Converts message into record and pushes it into queue. Urgent records are written without waiting flush period
+        void PushRecord(const WString& str, bool urgent);
+
+        // Tries to push record into queue. Returns false when queue is full
+        bool TryPush(std::string& text);
+
+        // Pops records from queue into batch and writes it into outputs. Cells are released only after batch is
+        // written, so records can be written on fatal signal until then. Must be called under write mutex
+        bool WriteQueuedRecords(std::string& batch);
+
+        // Flushes file and console outputs
+        void FlushOutputs();
+
+        // Writing thread loop
+        void WriteThreadLoop();
+    };
+}
+// --- META ---
+
+PRE_ENUM_META(o2::AsyncLogStream::OverflowPolicy);
+// --- END META ---
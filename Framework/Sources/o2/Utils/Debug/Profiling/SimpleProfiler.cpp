@@ -1,79 +1,404 @@
 #include "o2/stdafx.h"
 #include "SimpleProfiler.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include "o2/Utils/FileSystem/File.h"
+
 namespace o2
 {
-    void SimpleProfiler::Reset()
+    // ------------------------------------------------------------------------------------------------
+    // Sample slot in ring buffer. Fields are atomic, so owner thread can overwrite slot while exporting
+    // thread copies it; torn copies are detected by write index and skipped
+    // ------------------------------------------------------------------------------------------------
+    struct ProfilerSampleSlot
+    {
+        std::atomic<const char*> id;
+        std::atomic<UInt64>      begin;
+        std::atomic<UInt64>      end;
+        std::atomic<UInt32>      depth;
+    };
+
+    // -----------------------------------------------------------------------------------------
+    // Samples ring buffer of one thread. Written only by owner thread, read by exporting thread.
+    // Freed when owner thread exits, registration is guarded by profiler threads mutex
+    // -----------------------------------------------------------------------------------------
+    struct ProfilerThreadBuffer
     {
-        mTimer.Reset();
+        static constexpr UInt64 capacity = 1 << 16;
+
+        ProfilerSampleSlot samples[capacity];
 
-        mSamples.Clear();
-        mAccumulatedSamples.clear();
+        std::atomic<UInt64> writeIndex = 0; // Total count of written samples
+        UInt32              depth = 0;      // Current nesting depth
+        UInt32              threadIdx = 0;  // Index of thread in registration order
+        String              threadName;     // Thread name for exports
+    };
 
-        mAccumulatedSamplesCount = 0;
+    // ------------------------------------------------------------
+    // Profiler state: registered thread buffers and frames markers
+    // ------------------------------------------------------------
+    struct ProfilerState
+    {
+        static constexpr UInt64 framesCapacity = 4096;
+
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        std::mutex                    threadsMutex;   // Guards threads list and threads names
+        Vector<ProfilerThreadBuffer*> threads;        // Registered buffers of alive threads
+        UInt32                        threadsIdx = 0; // Index of next registered thread
+
+        std::atomic<UInt64> resetTime = 0;               // Samples and frames before this time are ignored
+        std::atomic<UInt64> frames[framesCapacity] = {}; // Frames end times ring buffer
+        std::atomic<UInt64> framesCount = 0;             // Total count of marked frames
+        std::atomic<UInt64> framesCountAtReset = 0;      // Count of marked frames at last reset
+    };
+
+    static ProfilerState& GetProfilerState()
+    {
+        static ProfilerState* state = new ProfilerState();
+        return *state;
     }
 
-    void SimpleProfiler::Flush()
+    // -----------------------------------------------------------------------------------
+    // Thread buffer owner. Unregisters and frees buffer of thread when thread is finished
+    // -----------------------------------------------------------------------------------
+    struct ProfilerThreadBufferOwner
     {
-        for (auto& sample : mSamples)
+        ProfilerThreadBuffer* buffer = nullptr;
+
+        ~ProfilerThreadBufferOwner()
         {
-            auto& accumulated = mAccumulatedSamples[sample.id];
-            accumulated.first += sample.end - sample.begin;
-            accumulated.second++;
+            if (!buffer)
+                return;
+
+            auto& state = GetProfilerState();
+            {
+                std::lock_guard<std::mutex> lock(state.threadsMutex);
+                state.threads.Remove(buffer);
+            }
+
+            delete buffer;
         }
+    };
+
+    static ProfilerThreadBuffer& GetProfilerThreadBuffer()
+    {
+        static thread_local ProfilerThreadBufferOwner owner;
+        if (!owner.buffer)
+        {
+            owner.buffer = new ProfilerThreadBuffer();
 
-        mSamples.Clear();
-        mAccumulatedSamplesCount++;
+            auto& state = GetProfilerState();
+            std::lock_guard<std::mutex> lock(state.threadsMutex);
+            owner.buffer->threadIdx = state.threadsIdx++;
+            owner.buffer->threadName = owner.buffer->threadIdx == 0 ? String("Main") : String("Thread ") + (String)(int)owner.buffer->threadIdx;
+            state.threads.Add(owner.buffer);
+        }
+
+        return *owner.buffer;
     }
 
-    void SimpleProfiler::Sample(const char* id, float start, float end)
+    // Copies valid samples of thread buffer, made after time. Works like sequence lock: samples are copied without
+    // blocking owner thread, then samples that could be overwritten during copying are dropped
+    static void CopyThreadSamples(ProfilerThreadBuffer& buffer, UInt64 afterTime, Vector<SimpleProfiler::Sample>& result)
     {
-        mSamples.Add({ id, start, end });
+        UInt64 endIndex = buffer.writeIndex.load(std::memory_order_acquire);
+        UInt64 beginIndex = endIndex > ProfilerThreadBuffer::capacity ? endIndex - ProfilerThreadBuffer::capacity : 0;
+
+        int offset = result.Count();
+        for (UInt64 i = beginIndex; i < endIndex; i++)
+        {
+            auto& slot = buffer.samples[i & (ProfilerThreadBuffer::capacity - 1)];
+            result.Add({ slot.id.load(std::memory_order_relaxed), slot.begin.load(std::memory_order_relaxed),
+                         slot.end.load(std::memory_order_relaxed), slot.depth.load(std::memory_order_relaxed) });
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // Samples that could be overwritten by owner thread during copying are dropped, including slot being written now
+        UInt64 newEndIndex = buffer.writeIndex.load(std::memory_order_relaxed) + 1;
+        UInt64 overwritten = newEndIndex > beginIndex + ProfilerThreadBuffer::capacity ? newEndIndex - beginIndex - ProfilerThreadBuffer::capacity : 0;
+        overwritten = Math::Min(overwritten, endIndex - beginIndex);
+        result.erase(result.begin() + offset, result.begin() + offset + (int)overwritten);
+
+        result.RemoveAll([&](auto& sample) { return sample.begin < afterTime; });
     }
 
-    const Vector<SimpleProfiler::SampleInterval>& SimpleProfiler::GetSamples()
+    // Appends string into JSON with escaping
+    static void WriteJsonString(String& json, const char* str)
     {
-        return mSamples;
+        json += '"';
+        for (const char* c = str; *c; c++)
+        {
+            if (*c == '"' || *c == '\\')
+            {
+                json += '\\';
+                json += *c;
+            }
+            else if ((unsigned char)*c < 0x20)
+                json += ' ';
+            else
+                json += *c;
+        }
+        json += '"';
     }
 
-    const std::unordered_map<const char*, Pair<float, int>>& SimpleProfiler::GetAccumulatedSamples()
+    void SimpleProfiler::Reset()
     {
-        return mAccumulatedSamples;
+        auto& state = GetProfilerState();
+        state.resetTime.store(GetProfileTime(), std::memory_order_release);
+        state.framesCountAtReset.store(state.framesCount.load(std::memory_order_acquire), std::memory_order_release);
     }
 
-    int SimpleProfiler::GetAccumulatedSamplesCount()
+    void SimpleProfiler::MarkFrame()
     {
-        return mAccumulatedSamplesCount;
+        auto& state = GetProfilerState();
+        UInt64 idx = state.framesCount.load(std::memory_order_relaxed);
+        state.frames[idx & (ProfilerState::framesCapacity - 1)].store(GetProfileTime(), std::memory_order_relaxed);
+        state.framesCount.store(idx + 1, std::memory_order_release);
+    }
+
+    int SimpleProfiler::GetFramesCount()
+    {
+        auto& state = GetProfilerState();
+        return (int)(state.framesCount.load(std::memory_order_acquire) - state.framesCountAtReset.load(std::memory_order_acquire));
+    }
+
+    void SimpleProfiler::SetThreadName(const String& name)
+    {
+        auto& buffer = GetProfilerThreadBuffer();
+
+        std::lock_guard<std::mutex> lock(GetProfilerState().threadsMutex);
+        buffer.threadName = name;
+    }
+
+    bool SimpleProfiler::SaveChromeTrace(const String& path)
+    {
+        auto& state = GetProfilerState();
+        UInt64 resetTime = state.resetTime.load(std::memory_order_acquire);
+
+        String json;
+        json += "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+        bool first = true;
+        auto beginEvent = [&]() { if (!first) json += ",\n"; first = false; };
+
+        std::lock_guard<std::mutex> lock(state.threadsMutex);
+
+        Vector<Sample> samples;
+        for (auto buffer : state.threads)
+        {
+            beginEvent();
+            json += String::Format("{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", buffer->threadIdx);
+            WriteJsonString(json, buffer->threadName.Data());
+            json += "}}";
+
+            samples.Clear();
+            CopyThreadSamples(*buffer, resetTime, samples);
+
+            for (auto& sample : samples)
+            {
+                beginEvent();
+                json += "{\"ph\":\"X\",\"name\":";
+                WriteJsonString(json, sample.id);
+                json += String::Format(",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", buffer->threadIdx,
+                                       (double)sample.begin/1000.0, (double)(sample.end - sample.begin)/1000.0);
+            }
+        }
+
+        int framesCount = Math::Min(GetFramesCount(), (int)ProfilerState::framesCapacity);
+        UInt64 lastFrame = state.framesCount.load(std::memory_order_acquire);
+        for (UInt64 i = lastFrame - framesCount; i < lastFrame; i++)
+        {
+            beginEvent();
+            json += String::Format("{\"ph\":\"i\",\"s\":\"g\",\"name\":\"Frame %u\",\"pid\":1,\"tid\":0,\"ts\":%.3f}",
+                                   (UInt)i, (double)state.frames[i & (ProfilerState::framesCapacity - 1)].load(std::memory_order_relaxed)/1000.0);
+        }
+
+        json += "]}\n";
+
+        OutFile file(path);
+        if (!file.IsOpened())
+            return false;
+
+        file.WriteData(json.Data(), json.Length());
+        return true;
     }
 
-    void SimpleProfiler::DumpLog()
+    String SimpleProfiler::GetFramesReport(int framesCount /*= 1*/, bool tree /*= true*/)
     {
-        o2Debug.Log("---- Simple profiler dump for " + (String)mAccumulatedSamplesCount + " frames:");
+        // ---------------------------------------------------
+        // Report node: accumulated sample in call hierarchy
+        // ---------------------------------------------------
+        struct Node
+        {
+            const char* id = nullptr;
+            UInt64      total = 0;
+            UInt64      children = 0;
+            int         count = 0;
+
+            std::unordered_map<const char*, int> childrenIndices;
+            Vector<int>                          childrenOrder;
+        };
 
-        static Vector<Pair<const char*, Pair<float, int>>> sortedSamples;
-        sortedSamples.Clear();
+        auto& state = GetProfilerState();
 
-        float invMS = 1000.0f / (float)mAccumulatedSamplesCount;
-        for (auto& kv : mAccumulatedSamples)
-            sortedSamples.Add({ kv.first, { kv.second.first * invMS, kv.second.second } });
+        framesCount = Math::Min(framesCount, GetFramesCount());
+        framesCount = Math::Min(framesCount, (int)ProfilerState::framesCapacity - 1);
+        if (framesCount <= 0)
+            return "No profiled frames";
 
-        sortedSamples.Sort([](auto& a, auto& b) { return a.second > b.second; });
+        UInt64 lastFrame = state.framesCount.load(std::memory_order_acquire);
+        UInt64 windowEnd = state.frames[(lastFrame - 1) & (ProfilerState::framesCapacity - 1)].load(std::memory_order_relaxed);
+        UInt64 windowBegin = GetFramesCount() > framesCount ?
+            state.frames[(lastFrame - 1 - framesCount) & (ProfilerState::framesCapacity - 1)].load(std::memory_order_relaxed) :
+            state.resetTime.load(std::memory_order_acquire);
 
-        float invFramesCount = 1.0f / (float)mAccumulatedSamplesCount;
+        double invFrames = 1.0/(double)framesCount;
+        auto toMs = [&](UInt64 ns) { return (double)ns*invFrames/1000000.0; };
 
-        for (auto& kv : sortedSamples)
+        String report = String::Format("Profiler report for %i frames, %.3f ms per frame:\n", framesCount, toMs(windowEnd - windowBegin));
+
+        std::lock_guard<std::mutex> lock(state.threadsMutex);
+
+        Vector<Sample> samples;
+        for (auto buffer : state.threads)
         {
-            o2Debug.Log("   %f ms (%.2f): %s", kv.second.first, (float)kv.second.second*invFramesCount, kv.first);
+            samples.Clear();
+            CopyThreadSamples(*buffer, windowBegin, samples);
+            samples.RemoveAll([&](auto& sample) { return sample.end > windowEnd; });
+
+            if (samples.IsEmpty())
+                continue;
+
+            std::sort(samples.begin(), samples.end(),
+                      [](auto& a, auto& b) { return a.begin < b.begin || (a.begin == b.begin && a.depth < b.depth); });
+
+            // Building call tree, parent of sample is last opened sample with smaller depth
+            Vector<Node> nodes;
+            nodes.Add(Node());
+
+            Vector<Pair<int, UInt64>> stack; // Node index and end time
+            for (auto& sample : samples)
+            {
+                while (!stack.IsEmpty() && stack.Last().second <= sample.begin)
+                    stack.PopBack();
+
+                int parent = stack.IsEmpty() ? 0 : stack.Last().first;
+                int nodeIdx;
+                auto fnd = nodes[parent].childrenIndices.find(sample.id);
+                if (fnd != nodes[parent].childrenIndices.end())
+                    nodeIdx = fnd->second;
+                else
+                {
+                    nodeIdx = nodes.Count();
+                    nodes[parent].childrenIndices[sample.id] = nodeIdx;
+                    nodes[parent].childrenOrder.Add(nodeIdx);
+                    nodes.Add(Node());
+                    nodes[nodeIdx].id = sample.id;
+                }
+
+                UInt64 duration = sample.end - sample.begin;
+                nodes[nodeIdx].total += duration;
+                nodes[nodeIdx].count++;
+
+                if (parent != 0)
+                    nodes[parent].children += duration;
+
+                stack.Add({ nodeIdx, sample.end });
+            }
+
+            report += String::Format(" Thread '%s':\n", buffer->threadName.Data());
+
+            if (tree)
+            {
+                auto printNode = [&](int nodeIdx, int depth, auto& printNodeRef) -> void
+                {
+                    Vector<int> children = nodes[nodeIdx].childrenOrder;
+                    children.Sort([&](int a, int b) { return nodes[a].total > nodes[b].total; });
+
+                    for (int child : children)
+                    {
+                        auto& node = nodes[child];
+                        report += String::Format("%*s%9.3f ms  self %9.3f ms  x%.2f  %s\n", depth*2 + 2, "",
+                                                 toMs(node.total), toMs(node.total - node.children),
+                                                 (double)node.count*invFrames, node.id);
+
+                        printNodeRef(child, depth + 1, printNodeRef);
+                    }
+                };
+
+                printNode(0, 0, printNode);
+            }
+            else
+            {
+                std::unordered_map<const char*, Node> flat;
+                for (int i = 1; i < nodes.Count(); i++)
+                {
+                    auto& node = flat[nodes[i].id];
+                    node.id = nodes[i].id;
+                    node.total += nodes[i].total;
+                    node.children += nodes[i].children;
+                    node.count += nodes[i].count;
+                }
+
+                Vector<Node*> sorted;
+                for (auto& kv : flat)
+                    sorted.Add(&kv.second);
+
+                sorted.Sort([](Node* a, Node* b) { return a->total - a->children > b->total - b->children; });
+
+                for (auto node : sorted)
+                {
+                    report += String::Format("  self %9.3f ms  total %9.3f ms  x%.2f  %s\n",
+                                             toMs(node->total - node->children), toMs(node->total),
+                                             (double)node->count*invFrames, node->id);
+                }
+            }
         }
+
+        return report;
+    }
+
+    void SimpleProfiler::DumpLog(int framesCount /*= 60*/)
+    {
+        o2Debug.LogStr(GetFramesReport(framesCount, false));
     }
 
-    float SimpleProfiler::GetProfileTime()
+    UInt64 SimpleProfiler::GetProfileTime()
     {
-        return mTimer.GetTime();
+        auto delta = std::chrono::steady_clock::now() - GetProfilerState().startTime;
+        return (UInt64)std::chrono::duration_cast<std::chrono::nanoseconds>(delta).count();
     }
 
-    Timer SimpleProfiler::mTimer;
-    Vector<SimpleProfiler::SampleInterval> SimpleProfiler::mSamples;
-    std::unordered_map<const char*, Pair<float, int>> SimpleProfiler::mAccumulatedSamples;
-    int SimpleProfiler::mAccumulatedSamplesCount;
+    UInt64 SimpleProfiler::BeginSample()
+    {
+        GetProfilerThreadBuffer().depth++;
+        return GetProfileTime();
+    }
+
+    void SimpleProfiler::EndSample(const char* id, UInt64 begin)
+    {
+        UInt64 end = GetProfileTime();
+
+        auto& buffer = GetProfilerThreadBuffer();
+        buffer.depth--;
+
+        UInt64 idx = buffer.writeIndex.load(std::memory_order_relaxed);
+
+        // Slot is overwritten only after previous write index is visible, so reader can detect overwriting
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto& slot = buffer.samples[idx & (ProfilerThreadBuffer::capacity - 1)];
+        slot.id.store(id, std::memory_order_relaxed);
+        slot.begin.store(begin, std::memory_order_relaxed);
+        slot.end.store(end, std::memory_order_relaxed);
+        slot.depth.store(buffer.depth, std::memory_order_relaxed);
+
+        buffer.writeIndex.store(idx + 1, std::memory_order_release);
+    }
 }
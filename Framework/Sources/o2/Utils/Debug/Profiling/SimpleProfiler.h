@@ -1,79 +1,101 @@
 #pragma once
-#include <unordered_map>
 
-#include "o2/Utils/Types/Containers/Pair.h"
-#include "o2/Utils/System/Time/Timer.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/String.h"
 
 #ifdef TRACY_ENABLE
 #include "tracy/Tracy.hpp"
 #endif
 
 namespace o2
-{    
+{
+    // -----------------------------------------------------------------------------------------------
+    // Built-in profiler. Each thread writes samples into its own lock-free ring buffer, with nanosecond
+    // begin and end times and nesting depth. Frames are marked by PROFILE_FRAME(). Collected samples
+    // can be exported to Chrome trace JSON (chrome://tracing, Perfetto) or into per-frame report.
+    // Works without Tracy, enabled by O2_PROFILE_STATS
+    // -----------------------------------------------------------------------------------------------
     class SimpleProfiler
     {
     public:
+        // -----------------------------------------------------
+        // Scope sampler, writes sample when leaving the scope
+        // -----------------------------------------------------
         struct ScopeSampler
         {
             const char* id;
-            float begin, end;
+            UInt64 begin;
 
-            ScopeSampler(const char* id): 
-                id(id), begin(SimpleProfiler::GetProfileTime())
+            ScopeSampler(const char* id):
+                id(id), begin(SimpleProfiler::BeginSample())
             {}
 
             ~ScopeSampler()
             {
-                end = SimpleProfiler::GetProfileTime();
-                SimpleProfiler::Sample(id, begin, end);
+                SimpleProfiler::EndSample(id, begin);
             }
         };
 
+        // -------------------------------------------------
+        // Zone sampler, writes sample when End() is called
+        // -------------------------------------------------
         struct ZoneSampler
         {
             const char* id;
-            float begin, end;
+            UInt64 begin;
 
-            ZoneSampler(const char* id) :
-                id(id), begin(SimpleProfiler::GetProfileTime())
+            ZoneSampler(const char* id):
+                id(id), begin(SimpleProfiler::BeginSample())
             {}
 
             void End()
             {
-                end = SimpleProfiler::GetProfileTime();
-                SimpleProfiler::Sample(id, begin, end);
+                SimpleProfiler::EndSample(id, begin);
             }
         };
 
-        struct SampleInterval
+        // --------------------------------------
+        // Profiling sample, times in nanoseconds
+        // --------------------------------------
+        struct Sample
         {
-            const char* id;
-            float begin, end;
-
-            SampleInterval(const char* id, float begin, float end) :
-                id(id), begin(begin), end(end)
-            {}
+            const char* id;    // Sample name
+            UInt64      begin; // Begin time in nanoseconds from profiler start
+            UInt64      end;   // End time in nanoseconds from profiler start
+            UInt32      depth; // Nesting depth in thread
         };
 
     public:
+        // Drops all collected samples and frames
         static void Reset();
-        static void Flush();
 
-        static void DumpLog();
+        // Marks end of frame. Called from main thread
+        static void MarkFrame();
+
+        // Returns count of marked frames since start or reset
+        static int GetFramesCount();
+
+        // Sets name of current thread, used in exports
+        static void SetThreadName(const String& name);
 
-        static void Sample(const char* id, float start, float end);
+        // Saves collected samples of all threads in Chrome trace JSON format. Returns false when file can't be written
+        static bool SaveChromeTrace(const String& path);
 
-        static const Vector<SampleInterval>& GetSamples();
-        static const std::unordered_map<const char*, Pair<float, int>>& GetAccumulatedSamples();
-        static int GetAccumulatedSamplesCount();
+        // Returns report for last frames, averaged per frame. When tree is true, samples are grouped by call hierarchy,
+        // otherwise flat list is returned
+        static String GetFramesReport(int framesCount = 1, bool tree = true);
 
-        static float GetProfileTime();
+        // Dumps flat report of last frames into log
+        static void DumpLog(int framesCount = 60);
 
-    private:
-        static Timer mTimer;
-        static Vector<SampleInterval> mSamples;
-        static std::unordered_map<const char*, Pair<float, int>> mAccumulatedSamples;
-        static int mAccumulatedSamplesCount;
+        // Returns time from profiler start in nanoseconds
+        static UInt64 GetProfileTime();
+
+        // Begins sample in current thread, returns begin time
+        static UInt64 BeginSample();
+
+        // Ends sample in current thread and writes it into thread's buffer
+        static void EndSample(const char* id, UInt64 begin);
     };
 
 #if !defined(__PRETTY_FUNCTION__) && !defined(__GNUC__)
@@ -86,25 +108,27 @@ namespace o2
 #define TRACY_PROFILE_INFO(info) ZoneText(info, info.Length())
 #define TRACY_PROFILE_FRAME() FrameMark
 #else
-#define TRACY_PROFILE_SAMPLE_FUNC() 
-#define TRACY_PROFILE_SAMPLE(id) 
+#define TRACY_PROFILE_SAMPLE_FUNC()
+#define TRACY_PROFILE_SAMPLE(id)
 #define TRACY_PROFILE_INFO(info)
 #define TRACY_PROFILE_FRAME()
-#endif 
+#endif
 
 #if defined(O2_PROFILE_STATS)
 #define SIMPLE_PROFILE_SAMPLE_FUNC() o2::SimpleProfiler::ScopeSampler __scope_sampler(__PRETTY_FUNCTION__)
 #define SIMPLE_PROFILE_SAMPLE(id) o2::SimpleProfiler::ScopeSampler __scope_sampler(id)
-#define SIMPLE_PROFILE_INFO(info) 
+#define SIMPLE_PROFILE_INFO(info)
+#define SIMPLE_PROFILE_FRAME() o2::SimpleProfiler::MarkFrame()
 #else
-#define SIMPLE_PROFILE_SAMPLE_FUNC() 
-#define SIMPLE_PROFILE_SAMPLE(id) 
+#define SIMPLE_PROFILE_SAMPLE_FUNC()
+#define SIMPLE_PROFILE_SAMPLE(id)
 #define SIMPLE_PROFILE_INFO(info)
-#endif 
+#define SIMPLE_PROFILE_FRAME()
+#endif
 
 #define PROFILE_SAMPLE_FUNC() TRACY_PROFILE_SAMPLE_FUNC(); SIMPLE_PROFILE_SAMPLE_FUNC()
 #define PROFILE_SAMPLE(id) TRACY_PROFILE_SAMPLE(id); SIMPLE_PROFILE_SAMPLE(id)
 #define PROFILE_INFO(info) TRACY_PROFILE_INFO(info); SIMPLE_PROFILE_INFO(info)
-#define PROFILE_FRAME() TRACY_PROFILE_FRAME()
+#define PROFILE_FRAME() TRACY_PROFILE_FRAME(); SIMPLE_PROFILE_FRAME()
 
 }
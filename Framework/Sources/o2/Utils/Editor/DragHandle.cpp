@@ -211,6 +211,17 @@ namespace o2
         return false;
     }
 
+    RectF DragHandle::GetCursorAreaBounds() const
+    {
+        if (!isPointInside.IsEmpty())
+            return CursorAreaEventsListener::GetCursorAreaBounds();
+
+        if (mRegularDrawable)
+            return mRegularDrawable->GetAxisAlignedRect().GetIntersection(mDrawingScissorRect);
+
+        return RectF();
+    }
+
     Vec2F DragHandle::ScreenToLocal(const Vec2F& point)
     {
         return screenToLocalTransformFunc(point);
@@ -158,6 +158,11 @@ namespace o2
         return mFrame.IsPointInside(point);
     }
 
+    RectF FrameHandles::GetCursorAreaBounds() const
+    {
+        return mFrame.AABB();
+    }
+
     void FrameHandles::SetPivotEnabled(bool enabled)
     {
         mIsPivotAvailable = enabled;
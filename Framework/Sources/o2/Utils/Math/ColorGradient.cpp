@@ -89,6 +89,13 @@ namespace o2
         return Math::Lerp(leftKey.color, rightKey.color, coef);
     }
 
+    void ColorGradient::EvaluateBatch(const float* positions, Color4* values, int count) const
+    {
+        int cacheKey = 0;
+        for (int i = 0; i < count; i++)
+            values[i] = Evaluate(positions[i], true, cacheKey);
+    }
+
     void ColorGradient::MoveKeys(float offset)
     {
         for (auto& key : mKeys)
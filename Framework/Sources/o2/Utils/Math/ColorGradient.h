@@ -57,6 +57,9 @@ namespace o2
         // Returns value by position
         Color4 Evaluate(float position, bool direction, int& cacheKey) const;
 
+        // Evaluates colors by positions array into values array. Keys are searched from previous position key
+        void EvaluateBatch(const float* positions, Color4* values, int count) const;
+
         // Moves all keys positions to offset
         void MoveKeys(float offset);
 
@@ -225,6 +228,7 @@ CLASS_METHODS_META(o2::ColorGradient)
     FUNCTION().PUBLIC().CONSTRUCTOR(const ColorGradient&);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(Color4, Evaluate, float);
     FUNCTION().PUBLIC().SIGNATURE(Color4, Evaluate, float, bool, int&);
+    FUNCTION().PUBLIC().SIGNATURE(void, EvaluateBatch, const float*, Color4*, int);
     FUNCTION().PUBLIC().SIGNATURE(void, MoveKeys, float);
     FUNCTION().PUBLIC().SIGNATURE(void, MoveKeysFrom, float, float);
     FUNCTION().PUBLIC().SIGNATURE(void, AppendCurve, const ColorGradient&);
@@ -109,6 +109,73 @@ namespace o2
         return Math::Lerp(topSegValue, bottomSegValue, randomRangeCoef);
     }
 
+    void Curve::EvaluateBatch(const float* positions, const float* randomRangeCoefs, float* values, int count) const
+    {
+        if (!mLookupTableUsed || mKeys.Count() < 2)
+        {
+            int cacheKey = 0, cacheKeyApprox = 0;
+            for (int i = 0; i < count; i++)
+            {
+                float randomRangeCoef = randomRangeCoefs ? randomRangeCoefs[i] : 0.0f;
+                values[i] = Evaluate(positions[i], randomRangeCoef, true, cacheKey, cacheKeyApprox);
+            }
+
+            return;
+        }
+
+        const float* top = mLookupTableTop.data();
+        const float* bottom = mLookupTableBottom.data();
+        const int lastSegment = mLookupTableSamplesCount - 2;
+
+        for (int i = 0; i < count; i++)
+        {
+            float position = positions[i];
+            float randomRangeCoef = randomRangeCoefs ? randomRangeCoefs[i] : 0.0f;
+
+            // Written to catch NaN positions too
+            if (!(position >= mLookupTableBegin && position <= mLookupTableEnd))
+            {
+                values[i] = Evaluate(position, randomRangeCoef);
+                continue;
+            }
+
+            float samplePosition = (position - mLookupTableBegin)*mLookupTableInvStep;
+            int segment = Math::Min((int)samplePosition, lastSegment);
+            float coef = samplePosition - (float)segment;
+
+            float topValue = top[segment] + (top[segment + 1] - top[segment])*coef;
+            float bottomValue = bottom[segment] + (bottom[segment + 1] - bottom[segment])*coef;
+
+            values[i] = topValue + (bottomValue - topValue)*randomRangeCoef;
+        }
+    }
+
+    void Curve::BakeLookupTable(int samplesCount /*= 256*/, float maxError /*= -1.0f*/)
+    {
+        mLookupTableSamplesCount = Math::Max(samplesCount, 2);
+        mLookupTableMaxError = maxError;
+        UpdateLookupTable();
+    }
+
+    void Curve::ResetLookupTable()
+    {
+        mLookupTableSamplesCount = 0;
+        mLookupTableMaxError = -1.0f;
+        mLookupTableUsed = false;
+        mLookupTableTop.Clear();
+        mLookupTableBottom.Clear();
+    }
+
+    bool Curve::IsLookupTableBaked() const
+    {
+        return mLookupTableSamplesCount > 0;
+    }
+
+    bool Curve::IsLookupTableUsed() const
+    {
+        return mLookupTableUsed;
+    }
+
     void Curve::BeginKeysBatchChange()
     {
         mBatchChange = true;
@@ -770,9 +837,77 @@ namespace o2
             }
         }
 
+        UpdateLookupTable();
+
         onKeysChanged();
     }
 
+    void Curve::UpdateLookupTable()
+    {
+        if (mLookupTableSamplesCount == 0)
+            return;
+
+        mLookupTableTop.Resize(mLookupTableSamplesCount);
+        mLookupTableBottom.Resize(mLookupTableSamplesCount);
+
+        if (mKeys.Count() < 2)
+        {
+            mLookupTableBegin = mLookupTableEnd = 0.0f;
+            mLookupTableInvStep = 0.0f;
+            mLookupTableUsed = false;
+            return;
+        }
+
+        mLookupTableBegin = mKeys[0].position;
+        mLookupTableEnd = mKeys.Last().position;
+
+        float step = (mLookupTableEnd - mLookupTableBegin)/(float)(mLookupTableSamplesCount - 1);
+        mLookupTableInvStep = step > 0.0f ? 1.0f/step : 0.0f;
+
+        // Samples are ascending, so keys are searched from cached position
+        int topCacheKey = 0, topCacheKeyApprox = 0, bottomCacheKey = 0, bottomCacheKeyApprox = 0;
+        for (int i = 0; i < mLookupTableSamplesCount; i++)
+        {
+            float position = mLookupTableBegin + step*(float)i;
+            mLookupTableTop[i] = Evaluate(position, 0.0f, true, topCacheKey, topCacheKeyApprox);
+            mLookupTableBottom[i] = Evaluate(position, 1.0f, true, bottomCacheKey, bottomCacheKeyApprox);
+        }
+
+        if (mLookupTableMaxError < 0.0f)
+        {
+            mLookupTableUsed = true;
+            return;
+        }
+
+        auto sample = [&](const Vector<float>& table, float position)
+        {
+            float samplePosition = (position - mLookupTableBegin)*mLookupTableInvStep;
+            int segment = Math::Clamp((int)samplePosition, 0, mLookupTableSamplesCount - 2);
+            return Math::Lerp(table[segment], table[segment + 1], samplePosition - (float)segment);
+        };
+
+        // Table and keys approximation are both linear between their points, so the largest difference is at
+        // approximation points. Steps give difference about step height
+        float maxError = 0.0f;
+        float minValue = FLT_MAX, maxValue = -FLT_MAX;
+        for (int i = 1; i < mKeys.Count(); i++)
+        {
+            for (int j = 0; j < Key::mApproxValuesCount; j++)
+            {
+                auto& top = mKeys[i].mApproxTopValues[j];
+                auto& bottom = mKeys[i].mApproxBottomValues[j];
+
+                maxError = Math::Max(maxError, Math::Abs(sample(mLookupTableTop, top.position) - top.value));
+                maxError = Math::Max(maxError, Math::Abs(sample(mLookupTableBottom, bottom.position) - bottom.value));
+
+                minValue = Math::Min(minValue, Math::Min(top.value, bottom.value));
+                maxValue = Math::Max(maxValue, Math::Max(top.value, bottom.value));
+            }
+        }
+
+        mLookupTableUsed = maxError <= mLookupTableMaxError*Math::Max(maxValue - minValue, FLT_EPSILON);
+    }
+
     Vector<Curve::Key> Curve::GetKeysNonContant()
     {
         return mKeys;
@@ -57,6 +57,25 @@ namespace o2
         // Returns value by position
         float Evaluate(float position, float randomRangeCoef, bool direction, int& cacheKey, int& cacheKeyApprox) const;
 
+        // Evaluates values by positions array into values array. Random range coefficients array is optional, zero
+        // coefficients are used when it's null. Uses baked lookup table when it's used, otherwise searches keys
+        void EvaluateBatch(const float* positions, const float* randomRangeCoefs, float* values, int count) const;
+
+        // Bakes uniform lookup table with samples count between first and last keys. Table is regenerated when keys
+        // are changed, until it's reset. Positions out of keys range are evaluated by keys. When max error isn't
+        // negative, table is used only while it differs from keys evaluation not more than max error relative to
+        // values range, so curves with steps or short keys segments are evaluated exactly
+        void BakeLookupTable(int samplesCount = 256, float maxError = -1.0f);
+
+        // Resets baked lookup table
+        void ResetLookupTable();
+
+        // Returns true when lookup table is baked
+        bool IsLookupTableBaked() const;
+
+        // Returns true when lookup table is baked and accurate enough, so it is used in batch evaluation
+        bool IsLookupTableUsed() const;
+
         // Called when beginning keys batch change. After this call all keys modifications will not be update approximation
         // Used for optimizing many keys change
         void BeginKeysBatchChange();
@@ -279,13 +298,25 @@ namespace o2
 
         Vector<Key> mKeys; // Curve keys @SERIALIZABLE
 
+        int           mLookupTableSamplesCount = 0; // Samples count of baked lookup table, 0 when it isn't baked
+        float         mLookupTableBegin = 0.0f;     // Position of first lookup table sample
+        float         mLookupTableEnd = 0.0f;       // Position of last lookup table sample
+        float         mLookupTableInvStep = 0.0f;   // Inverted distance between lookup table samples
+        Vector<float> mLookupTableTop;              // Lookup table samples of top range values
+        Vector<float> mLookupTableBottom;           // Lookup table samples of bottom range values
+        float         mLookupTableMaxError = -1.0f; // Allowed lookup table error relative to values range, negative for any
+        bool          mLookupTableUsed = false;     // Is lookup table used in batch evaluation: baked and accurate enough
+
     protected:
         // Checks all smooth keys and updates supports points
         void CheckSmoothKeys();
 
-        // Updates approximation
+        // Updates approximation and baked lookup table
         void UpdateApproximation();
 
+        // Samples baked lookup table from keys and checks its accuracy
+        void UpdateLookupTable();
+
         // Returns keys (for property)
         Vector<Key> GetKeysNonContant();
 
@@ -317,6 +348,14 @@ CLASS_FIELDS_META(o2::Curve)
     FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mBatchChange);
     FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mChangedKeys);
     FIELD().PROTECTED().SERIALIZABLE_ATTRIBUTE().NAME(mKeys);
+    FIELD().PROTECTED().DEFAULT_VALUE(0).NAME(mLookupTableSamplesCount);
+    FIELD().PROTECTED().DEFAULT_VALUE(0.0f).NAME(mLookupTableBegin);
+    FIELD().PROTECTED().DEFAULT_VALUE(0.0f).NAME(mLookupTableEnd);
+    FIELD().PROTECTED().DEFAULT_VALUE(0.0f).NAME(mLookupTableInvStep);
+    FIELD().PROTECTED().NAME(mLookupTableTop);
+    FIELD().PROTECTED().NAME(mLookupTableBottom);
+    FIELD().PROTECTED().DEFAULT_VALUE(-1.0f).NAME(mLookupTableMaxError);
+    FIELD().PROTECTED().DEFAULT_VALUE(false).NAME(mLookupTableUsed);
 }
 END_META;
 CLASS_METHODS_META(o2::Curve)
@@ -328,6 +367,11 @@ CLASS_METHODS_META(o2::Curve)
     FUNCTION().PUBLIC().CONSTRUCTOR(const Curve&);
     FUNCTION().PUBLIC().SCRIPTABLE_ATTRIBUTE().SIGNATURE(float, Evaluate, float, float);
     FUNCTION().PUBLIC().SIGNATURE(float, Evaluate, float, float, bool, int&, int&);
+    FUNCTION().PUBLIC().SIGNATURE(void, EvaluateBatch, const float*, const float*, float*, int);
+    FUNCTION().PUBLIC().SIGNATURE(void, BakeLookupTable, int, float);
+    FUNCTION().PUBLIC().SIGNATURE(void, ResetLookupTable);
+    FUNCTION().PUBLIC().SIGNATURE(bool, IsLookupTableBaked);
+    FUNCTION().PUBLIC().SIGNATURE(bool, IsLookupTableUsed);
     FUNCTION().PUBLIC().SIGNATURE(void, BeginKeysBatchChange);
     FUNCTION().PUBLIC().SIGNATURE(void, CompleteKeysBatchingChange);
     FUNCTION().PUBLIC().SIGNATURE(void, MoveKeys, float);
@@ -374,6 +418,7 @@ CLASS_METHODS_META(o2::Curve)
     FUNCTION().PUBLIC().SIGNATURE_STATIC(Curve, Linear, float, float, float);
     FUNCTION().PROTECTED().SIGNATURE(void, CheckSmoothKeys);
     FUNCTION().PROTECTED().SIGNATURE(void, UpdateApproximation);
+    FUNCTION().PROTECTED().SIGNATURE(void, UpdateLookupTable);
     FUNCTION().PROTECTED().SIGNATURE(Vector<Key>, GetKeysNonContant);
     FUNCTION().PROTECTED().SIGNATURE(void, OnDeserialized, const DataValue&);
     FUNCTION().PROTECTED().SIGNATURE(void, InternalSmoothKeyAt, int, float);
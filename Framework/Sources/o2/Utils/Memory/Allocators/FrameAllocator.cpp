@@ -0,0 +1,59 @@
+#include "o2/stdafx.h"
+#include "FrameAllocator.h"
+
+#include "o2/Utils/Debug/Assert.h"
+
+namespace o2
+{
+    std::atomic<UInt64> FrameAllocator::mFrameIndex = 1;
+
+    void* FrameAllocator::Allocate(size_t size, size_t alignment /*= alignof(std::max_align_t)*/)
+    {
+        auto& arena = GetThreadArena();
+        arena.allocationsCount++;
+
+        return arena.allocator.Allocate(size, alignment);
+    }
+
+    void FrameAllocator::Deallocate(void* ptr, size_t size)
+    {
+        auto& arena = GetThreadArena();
+        arena.allocationsCount--;
+        arena.allocator.Deallocate(ptr, size);
+    }
+
+    void FrameAllocator::BeginFrame()
+    {
+        mFrameIndex.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    size_t FrameAllocator::GetUsedSize()
+    {
+        return GetThreadArena().allocator.GetUsedSize();
+    }
+
+    int FrameAllocator::GetAllocationsCount()
+    {
+        return GetThreadArena().allocationsCount;
+    }
+
+    FrameAllocator::ThreadArena& FrameAllocator::GetThreadArena()
+    {
+        static thread_local ThreadArena arena;
+
+        UInt64 frameIndex = mFrameIndex.load(std::memory_order_relaxed);
+        if (arena.frameIndex != frameIndex)
+        {
+            // Frame container kept from previous frame still uses arena memory, so arena is reset on next frame
+            // after it is released
+            Assert(arena.allocationsCount == 0, "Frame allocated data outlived its frame");
+
+            if (arena.allocationsCount == 0)
+                arena.allocator.Reset();
+
+            arena.frameIndex = frameIndex;
+        }
+
+        return arena;
+    }
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include "o2/Utils/Memory/Allocators/LinearAllocator.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace o2
+{
+    // -------------------------------------------------------------------------------------------------
+    // Frame allocator. Per-thread linear arena for temporary data, that lives not longer than a frame.
+    // Application begins new frame each update, then each thread arena resets on its next allocation.
+    // Arena counts its live allocations and isn't reset while any of them is alive, so data kept between
+    // frames is never overwritten; it is reported by assert. Memory must be released on allocating thread
+    // -------------------------------------------------------------------------------------------------
+    class FrameAllocator
+    {
+    public:
+        // Allocates memory from current thread arena
+        static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        // Releases memory on allocating thread. Only last allocation is really released, others are kept until arena reset
+        static void Deallocate(void* ptr, size_t size);
+
+        // Begins new frame. All threads arenas will be reset on next allocation
+        static void BeginFrame();
+
+        // Returns used size in current thread arena
+        static size_t GetUsedSize();
+
+        // Returns count of not released allocations in current thread arena
+        static int GetAllocationsCount();
+
+    protected:
+        // --------------------------------------------------------------------------
+        // Thread arena: linear allocator with frame index and live allocations count
+        // --------------------------------------------------------------------------
+        struct ThreadArena
+        {
+            LinearAllocator allocator { 64*1024 }; // Arena memory
+            UInt64          frameIndex = 0;        // Frame index of last arena reset
+            int             allocationsCount = 0;  // Count of not released allocations
+        };
+
+    protected:
+        static std::atomic<UInt64> mFrameIndex; // Current frame index. Thread arena resets when its index is different
+
+    protected:
+        // Returns current thread arena, resets it when frame was changed and there are no live allocations
+        static ThreadArena& GetThreadArena();
+    };
+
+    // ----------------------------------------------------
+    // STL compatible allocator, allocates from frame arena
+    // ----------------------------------------------------
+    template<typename _type>
+    class FrameStdAllocator
+    {
+    public:
+        typedef _type value_type;
+
+    public:
+        FrameStdAllocator() = default;
+
+        template<typename _other_type>
+        FrameStdAllocator(const FrameStdAllocator<_other_type>& other) {}
+
+        _type* allocate(size_t count)
+        {
+            return (_type*)FrameAllocator::Allocate(count*sizeof(_type), alignof(_type));
+        }
+
+        void deallocate(_type* ptr, size_t count)
+        {
+            FrameAllocator::Deallocate(ptr, count*sizeof(_type));
+        }
+
+        template<typename _other_type>
+        bool operator==(const FrameStdAllocator<_other_type>& other) const { return true; }
+
+        template<typename _other_type>
+        bool operator!=(const FrameStdAllocator<_other_type>& other) const { return false; }
+    };
+
+    // ---------------------------------------------------------------------------------------
+    // Temporary dynamic array in frame arena. Has basic Vector interface, lives only in frame
+    // ---------------------------------------------------------------------------------------
+    template<typename _type>
+    class FrameVector: public std::vector<_type, FrameStdAllocator<_type>>
+    {
+    public:
+        using std::vector<_type, FrameStdAllocator<_type>>::vector;
+
+        // Returns count of elements
+        int Count() const { return (int)this->size(); }
+
+        // Returns true when no elements
+        bool IsEmpty() const { return this->empty(); }
+
+        // Reserves memory for elements
+        void Reserve(int count) { this->reserve(count); }
+
+        // Adds element
+        _type& Add(const _type& value) { this->push_back(value); return this->back(); }
+
+        // Adds elements from range
+        template<typename _container>
+        void Add(const _container& values) { this->insert(this->end(), values.begin(), values.end()); }
+
+        // Returns last element
+        _type& Last() { return this->back(); }
+
+        // Removes last element
+        void PopBack() { this->pop_back(); }
+
+        // Removes all elements
+        void Clear() { this->clear(); }
+
+        // Returns true when value is in array
+        bool Contains(const _type& value) const { return std::find(this->begin(), this->end(), value) != this->end(); }
+
+        // Returns first element that satisfies predicate, or default value
+        template<typename _predicate>
+        _type FindOrDefault(const _predicate& pred) const
+        {
+            auto fnd = std::find_if(this->begin(), this->end(), pred);
+            return fnd != this->end() ? *fnd : _type();
+        }
+    };
+
+    // Temporary string in frame arena
+    typedef std::basic_string<char, std::char_traits<char>, FrameStdAllocator<char>> FrameString;
+}
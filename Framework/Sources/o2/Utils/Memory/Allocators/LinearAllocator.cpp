@@ -5,36 +5,116 @@
 
 namespace o2
 {
-    LinearAllocator::LinearAllocator(size_t blockSize, IAllocator* baseAllocator /*= DefaultAllocator::GetInstance()*/)
+    LinearAllocator::LinearAllocator(size_t blockSize, IAllocator* baseAllocator /*= DefaultAllocator::GetInstance()*/):
+        mBaseAllocator(baseAllocator), mBlockSize(blockSize)
+    {}
+
+    LinearAllocator::~LinearAllocator()
     {
-        mBaseAllocator = baseAllocator;
-        mBlock = mBaseAllocator->Allocate(blockSize);
-        mBlockSize = blockSize;
-        mCurrentSize = 0;
+        while (mBlock)
+        {
+            Block* next = mBlock->next;
+            mBaseAllocator->Deallocate(mBlock);
+            mBlock = next;
+        }
     }
 
-    void* LinearAllocator::Reallocate(void* ptr, size_t oldSize, size_t newSize)
+    void* LinearAllocator::Allocate(size_t size)
     {
-        void* newMemory = Allocate(newSize);
-        memcpy(newMemory, ptr, oldSize);
-        return newMemory;
+        return Allocate(size, alignof(std::max_align_t));
+    }
+
+    void* LinearAllocator::Allocate(size_t size, size_t alignment)
+    {
+        std::byte* ptr = (std::byte*)(((uintptr_t)mCaret + alignment - 1) & ~(uintptr_t)(alignment - 1));
+        if (!mBlock || ptr + size > mEnd)
+        {
+            AddBlock(size + alignment);
+            ptr = (std::byte*)(((uintptr_t)mCaret + alignment - 1) & ~(uintptr_t)(alignment - 1));
+        }
+
+        mUsedSize += ptr + size - mCaret;
+        mCaret = ptr + size;
+
+        return ptr;
     }
 
     void LinearAllocator::Deallocate(void* ptr)
     {}
 
-    void* LinearAllocator::Allocate(size_t size)
+    void LinearAllocator::Deallocate(void* ptr, size_t size)
     {
-        if (mCurrentSize + size > mBlockSize)
+        if ((std::byte*)ptr + size == mCaret)
         {
-            size_t newSize = mCurrentSize > 1024*1024 ? mCurrentSize + 512*1024 : mCurrentSize*2;
-            mBlock = mBaseAllocator->Reallocate(mBlock, mCurrentSize, newSize);
-            mBlockSize = newSize;
+            mCaret = (std::byte*)ptr;
+            mUsedSize -= size;
         }
+    }
 
-        void* ptr = reinterpret_cast<std::byte*>(mBlock) + size;
-        mCurrentSize += size;
+    void* LinearAllocator::Reallocate(void* ptr, size_t oldSize, size_t newSize)
+    {
+        if (ptr && (std::byte*)ptr + oldSize == mCaret && (std::byte*)ptr + newSize <= mEnd)
+        {
+            mCaret = (std::byte*)ptr + newSize;
+            mUsedSize = mUsedSize - oldSize + newSize;
+            return ptr;
+        }
 
-        return ptr;
+        void* newMemory = Allocate(newSize);
+        if (ptr)
+            memcpy(newMemory, ptr, oldSize < newSize ? oldSize : newSize);
+
+        return newMemory;
+    }
+
+    void LinearAllocator::Reset()
+    {
+        if (mBlock && mBlock->next)
+        {
+            size_t totalSize = 0;
+            while (mBlock)
+            {
+                Block* next = mBlock->next;
+                totalSize += mBlock->size;
+                mBaseAllocator->Deallocate(mBlock);
+                mBlock = next;
+            }
+
+            AddBlock(totalSize);
+        }
+
+        if (mBlock)
+            mCaret = GetBlockData(mBlock);
+
+        mUsedSize = 0;
+    }
+
+    size_t LinearAllocator::GetUsedSize() const
+    {
+        return mUsedSize;
+    }
+
+    void LinearAllocator::AddBlock(size_t size)
+    {
+        size_t blockSize = mBlockSize;
+        if (mBlock)
+            blockSize = mBlock->size*2;
+
+        if (blockSize < size)
+            blockSize = size;
+
+        Block* block = (Block*)mBaseAllocator->Allocate(sizeof(Block) + blockSize + alignof(std::max_align_t));
+        block->next = mBlock;
+        block->size = blockSize;
+
+        mBlock = block;
+        mCaret = GetBlockData(block);
+        mEnd = mCaret + blockSize;
+    }
+
+    std::byte* LinearAllocator::GetBlockData(Block* block)
+    {
+        constexpr size_t alignment = alignof(std::max_align_t);
+        return (std::byte*)(((uintptr_t)(block + 1) + alignment - 1) & ~(uintptr_t)(alignment - 1));
     }
 }
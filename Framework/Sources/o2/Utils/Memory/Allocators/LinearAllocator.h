@@ -1,23 +1,60 @@
 #pragma once
 #include "o2/Utils/Memory/Allocators/IAllocator.h"
 #include "o2/Utils/Memory/Allocators/DefaultAllocator.h"
+#include <cstddef>
 
 namespace o2
 {
+    // -------------------------------------------------------------------------------------------
+    // Linear allocator. Allocates memory by moving caret in blocks, releases everything on reset.
+    // Memory is never moved, new block is added when current is over. On reset blocks are merged
+    // into one, so in steady state all allocations fit into single block
+    // -------------------------------------------------------------------------------------------
     class LinearAllocator: public IAllocator
     {
     public:
         LinearAllocator(size_t blockSize, IAllocator* baseAllocator = DefaultAllocator::GetInstance());
+        LinearAllocator(const LinearAllocator& other) = delete;
+        ~LinearAllocator();
 
         void* Allocate(size_t size) override;
         void Deallocate(void* ptr) override;
         void* Reallocate(void* ptr, size_t oldSize, size_t newSize) override;
 
+        // Allocates memory with specified alignment
+        void* Allocate(size_t size, size_t alignment);
+
+        // Releases memory if it is last allocation, otherwise memory is kept until reset
+        void Deallocate(void* ptr, size_t size);
+
+        // Releases all allocations
+        void Reset();
+
+        // Returns used memory size
+        size_t GetUsedSize() const;
+
     private:
+        struct Block
+        {
+            Block* next; // Previous filled block
+            size_t size; // Block data size
+        };
+
         IAllocator* mBaseAllocator;
 
-        void* mBlock;
-        size_t mBlockSize;
-        size_t mCurrentSize;
+        Block* mBlock = nullptr; // Current block, linked with previous blocks
+        size_t mBlockSize;       // Initial block size
+
+        std::byte* mCaret = nullptr; // Next allocation position in current block
+        std::byte* mEnd = nullptr;   // End of current block
+
+        size_t mUsedSize = 0; // Used size in all blocks
+
+    private:
+        // Adds new block with at least specified size
+        void AddBlock(size_t size);
+
+        // Returns block data begin
+        static std::byte* GetBlockData(Block* block);
     };
 };
@@ -2,6 +2,7 @@
 #include "MemoryAnalyzer.h"
 
 #include "o2/Utils/Memory/MemoryAnalyzeableObject.h"
+#include "o2/Utils/Memory/MemoryManager.h"
 #include "o2/Utils/Types/Ref.h"
 
 namespace o2
@@ -195,9 +196,41 @@ namespace o2
                 it++;
         }
 
+        allMemoryNode->children.push_back(BuildAllocationsNode(allMemoryNode));
+
         return allMemoryNode;
     }
 
+    MemoryAnalyzer::MemoryNode* MemoryAnalyzer::BuildAllocationsNode(MemoryNode* parent)
+    {
+        auto allocationsNode = new MemoryNode();
+        allocationsNode->name = "Allocations by source";
+        allocationsNode->mainParent = parent;
+        allocationsNode->parents.push_back(parent);
+
+        std::vector<MemoryManager::AllocSourceInfo> allocations;
+        MemoryManager::Instance().GetAllocationsInfo(allocations);
+
+        std::sort(allocations.begin(), allocations.end(), [](auto& a, auto& b) { return a.size > b.size; });
+
+        for (auto& allocation : allocations)
+        {
+            auto node = new MemoryNode();
+            node->name = std::string(allocation.source) + ":" + std::to_string(allocation.sourceLine);
+            node->type = std::to_string(allocation.count) + " allocs, peak " + std::to_string(allocation.peakSize) +
+                " bytes, total " + std::to_string(allocation.totalCount) + " allocs";
+            node->size = allocation.size;
+            node->mainParent = allocationsNode;
+            node->parents.push_back(allocationsNode);
+
+            allocationsNode->children.push_back(node);
+        }
+
+        allocationsNode->SummarizeSize();
+
+        return allocationsNode;
+    }
+
     void MemoryAnalyzer::BuildSubTree(MemoryNode* root, const std::vector<MemoryAnalyzeObject*>& roots,
                                       std::map<std::byte*, MemoryNode*>& memoryNodes,
                                       std::vector<std::pair<MemoryNode*, std::vector<MemoryAnalyzeObject*>>>& currentNodes,
@@ -210,8 +243,6 @@ namespace o2
         nextNodes.clear();
         childRefs.clear();
 
-        auto& memoryInfos = MemoryManager::Instance().mAllocs;
-
         // Repeat until there are no more nodes to process
         while (!currentNodes.empty())
         {
@@ -252,20 +283,12 @@ namespace o2
 
                     // Get object's memory size
                     size_t objectSize = object->GetMemorySize();
+
+                    // If it's unknown, use object's type size
                     if (objectSize == 0)
                     {
-                        // If it's zero, try to find it in memory info
-                        auto memoryInfosFndIt = memoryInfos.find(objectMemoryBegin);
-                        if (memoryInfosFndIt == memoryInfos.end())
-                        {
-
-                            o2Debug.LogError("Failed to find memory info for memory address: %p", objectMemoryBegin);
-                            continue;
-                        }
-
-                        auto& memoryInfo = memoryInfosFndIt->second;
-                        objectSize = memoryInfo.size;
-                        memoryInfo.markIndex = mCurrentBuildMemoryTreeIdx;
+                        if (auto iobject = object->GetIObject())
+                            objectSize = (size_t)iobject->GetType().GetSize();
                     }
 
                     // Create new node for this object
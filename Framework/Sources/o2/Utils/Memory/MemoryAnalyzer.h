@@ -45,6 +45,9 @@ namespace o2
         // Builds memory tree from roots
         static MemoryNode* BuildMemoryTree(const std::vector<MemoryAnalyzeObject*>& roots);
 
+        // Builds node with allocations statistics by source code locations
+        static MemoryNode* BuildAllocationsNode(MemoryNode* parent);
+
     private:
         static int mCurrentBuildMemoryTreeIdx;
 
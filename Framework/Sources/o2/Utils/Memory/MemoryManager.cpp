@@ -2,6 +2,8 @@
 #include "MemoryManager.h"
 
 #include <algorithm>
+#include <cstring>
+#include <new>
 
 #include "o2/Utils/Debug/Assert.h"
 #include "o2/Utils/Debug/Log/ConsoleLogStream.h"
@@ -9,17 +11,26 @@
 
 void* operator new(size_t size, const char* location, int line)
 {
-    return _mmalloc(size, location, line);
+#if ENABLE_MEMORY_MANAGE
+    if (void* memory = o2::MemoryManager::Allocate(size, location, line))
+        return memory;
+
+    throw std::bad_alloc();
+#else
+    return ::operator new(size);
+#endif
 }
 
 void* operator new[](size_t size, const char* location, int line)
 {
-    return _mmalloc(size, location, line);
-}
+#if ENABLE_MEMORY_MANAGE
+    if (void* memory = o2::MemoryManager::Allocate(size, location, line))
+        return memory;
 
-void operator delete(void* allocMemory) noexcept
-{
-    _mfree(allocMemory);
+    throw std::bad_alloc();
+#else
+    return ::operator new[](size);
+#endif
 }
 
 void operator delete(void* allocMemory, const char* location, int line)
@@ -29,38 +40,89 @@ void operator delete(void* allocMemory, const char* location, int line)
 
 void operator delete[](void* allocMemory, const char* location, int line)
 {
-    ::operator delete(allocMemory);
+    ::operator delete[](allocMemory);
+}
+
+#if ENABLE_MEMORY_MANAGE
+// Global operators are replaced only when memory managing is enabled. All of them put allocation header, so delete
+// releases any memory the same way: mnew allocations are registered by source, other allocations aren't counted
+void* operator new(size_t size)
+{
+    if (void* memory = o2::MemoryManager::Allocate(size, nullptr, 0))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return o2::MemoryManager::Allocate(size, nullptr, 0);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return o2::MemoryManager::Allocate(size, nullptr, 0);
+}
+
+void operator delete(void* allocMemory) noexcept
+{
+    o2::MemoryManager::Release(allocMemory);
 }
 
 void operator delete[](void* allocMemory) noexcept
 {
-    ::operator delete(allocMemory);
+    o2::MemoryManager::Release(allocMemory);
 }
 
-void* _mmalloc(size_t size, const char* location, int line)
+void operator delete(void* allocMemory, size_t size) noexcept
 {
-    void* memory = malloc(size);
+    o2::MemoryManager::Release(allocMemory);
+}
 
-#if ENABLE_MEMORY_MANAGE
-    o2::MemoryManager::Instance().OnMemoryAllocate(memory, size, location, line);
-#endif
+void operator delete[](void* allocMemory, size_t size) noexcept
+{
+    o2::MemoryManager::Release(allocMemory);
+}
 
-    return memory;
+void operator delete(void* allocMemory, const std::nothrow_t&) noexcept
+{
+    o2::MemoryManager::Release(allocMemory);
 }
 
-void _mfree(void* allocMemory)
+void operator delete[](void* allocMemory, const std::nothrow_t&) noexcept
 {
-#if ENABLE_MEMORY_MANAGE == true
-    o2::MemoryManager::Instance().OnMemoryRelease(allocMemory);
+    o2::MemoryManager::Release(allocMemory);
+}
 #endif
 
+void* _mmalloc(size_t size, const char* location, int line)
+{
+#if ENABLE_MEMORY_MANAGE
+    return o2::MemoryManager::Allocate(size, location, line);
+#else
+    return malloc(size);
+#endif
+}
+
+void _mfree(void* allocMemory)
+{
+#if ENABLE_MEMORY_MANAGE
+    o2::MemoryManager::Release(allocMemory);
+#else
     free(allocMemory);
+#endif
 }
 
 namespace o2
 {
-    MemoryManager::MemoryManager():
-        mTotalBytes(0)
+    MemoryManager::AllocSource MemoryManager::mSources[MemoryManager::mSourcesTableSize];
+
+    MemoryManager::MemoryManager()
     {}
 
     MemoryManager::~MemoryManager()
@@ -81,83 +143,176 @@ namespace o2
         mInstance = new MemoryManager();
     }
 
-    void MemoryManager::OnMemoryAllocate(void* memory, size_t size, const char* source, int line)
+    void* MemoryManager::Allocate(size_t size, const char* source, int line)
     {
-        AllocInfo info;
-        info.memory = memory;
-        info.size = size;
-        info.sourceLine = line;
-        info.source = source;
-        mAllocs[memory] = info;
-        mTotalBytes += size;
+        auto header = (AllocHeader*)malloc(sizeof(AllocHeader) + size);
+        if (!header)
+            return nullptr;
+
+        UInt32 idx = source ? GetAllocSourceIdx(source, line) : mUntrackedSourceIdx;
+
+        header->size = size;
+        header->sourceIdx = idx;
+        header->tag = mAllocHeaderTag;
+
+        if (idx == mUntrackedSourceIdx)
+            return header + 1;
+
+        auto& allocSource = mSources[idx];
+        allocSource.count.fetch_add(1, std::memory_order_relaxed);
+        allocSource.totalCount.fetch_add(1, std::memory_order_relaxed);
+
+        Int64 newSize = allocSource.size.fetch_add((Int64)size, std::memory_order_relaxed) + (Int64)size;
+        Int64 peakSize = allocSource.peakSize.load(std::memory_order_relaxed);
+        while (newSize > peakSize && !allocSource.peakSize.compare_exchange_weak(peakSize, newSize, std::memory_order_relaxed))
+        {}
+
+        return header + 1;
     }
 
-    void MemoryManager::OnMemoryRelease(void* memory)
+    void MemoryManager::Release(void* memory)
     {
-        auto fnd = mAllocs.find(memory);
-        if (fnd != mAllocs.end())
+        if (!memory)
+            return;
+
+        auto header = GetHeader(memory);
+        Assert(header->tag == mAllocHeaderTag, "Released memory is corrupted or already released");
+
+        if (header->sourceIdx != mUntrackedSourceIdx)
         {
-            mTotalBytes -= (*fnd).second.size;
-            mAllocs.erase(fnd);
+            auto& allocSource = mSources[header->sourceIdx];
+            allocSource.count.fetch_sub(1, std::memory_order_relaxed);
+            allocSource.size.fetch_sub((Int64)header->size, std::memory_order_relaxed);
         }
+
+        header->tag = 0;
+        free(header);
     }
 
-    void MemoryManager::DumpInfo()
+    MemoryManager::AllocHeader* MemoryManager::GetHeader(void* memory)
     {
-        printf("========MemoryManager::DumpInfo==========\n");
+        return (AllocHeader*)memory - 1;
+    }
 
-        printf("Total managed allocations: %f MB\n", (float)mTotalBytes / 1024.0f / 1024.0f);
+    UInt64 MemoryManager::GetAllocSourceKey(const char* source, int line)
+    {
+        // FNV-1a hash of file name and line. Zero is reserved for free entries
+        UInt64 hash = 0xCBF29CE484222325ull;
+        for (const char* c = source; c && *c; c++)
+            hash = (hash ^ (UInt8)*c)*0x100000001B3ull;
+
+        hash = (hash ^ (UInt64)(UInt32)line)*0x100000001B3ull;
 
-        struct allocSrc
+        return hash != 0 ? hash : 1;
+    }
+
+    UInt32 MemoryManager::GetAllocSourceIdx(const char* source, int line)
+    {
+        if (!source)
+            return 0;
+
+        UInt64 key = GetAllocSourceKey(source, line);
+        UInt32 idx = (UInt32)(key >> 40) & (mSourcesTableSize - 1);
+
+        auto isSameSource = [&](AllocSource& entry)
         {
-            char source[128];
-            int line = 0;
-            size_t size = 0;
-            int count = 0;
+            // Source is stored right after key is captured, wait until it is visible
+            const char* entrySource;
+            while (!(entrySource = entry.source.load(std::memory_order_acquire)))
+            {}
 
-            bool operator<(const allocSrc& other) const
-            {
-                return size < other.size;
-            }
+            return entry.sourceLine.load(std::memory_order_relaxed) == line && strcmp(entrySource, source) == 0;
         };
-        std::vector<allocSrc> allocs;
 
-        int i = 0;
-        for (auto it = mAllocs.begin(); it != mAllocs.end(); ++it, i++)
+        // Linear probing, first entry is reserved for overflow
+        for (UInt32 i = 0; i < mSourcesTableSize/4; i++, idx = (idx + 1) & (mSourcesTableSize - 1))
         {
-            auto& info = (*it).second;
+            if (idx == 0)
+                continue;
 
-            bool found = false;
-            for (auto& allc : allocs)
+            auto& entry = mSources[idx];
+
+            UInt64 entryKey = entry.key.load(std::memory_order_acquire);
+            if (entryKey == 0 && entry.key.compare_exchange_strong(entryKey, key, std::memory_order_acq_rel))
             {
-                if (allc.line == info.sourceLine && strcmp(allc.source, info.source) == 0)
-                {
-                    allc.size += info.size;
-                    allc.count++;
-                    found = true;
-                    break;
-                }
+                entry.sourceLine.store(line, std::memory_order_relaxed);
+                entry.source.store(source, std::memory_order_release);
+                return idx;
             }
 
-            if (!found)
-            {
-                allocSrc allc;
-                allc.line = info.sourceLine;
-                strncpy(allc.source, info.source, 127);
-                allc.size = info.size;
-                allc.count = 1;
+            // Keys of different sources can collide, so source is compared too
+            if (entryKey == key && isSameSource(entry))
+                return idx;
+        }
 
-                allocs.push_back(allc);
-            }
+        return 0;
+    }
+
+    void MemoryManager::GetAllocationsInfo(std::vector<AllocSourceInfo>& info) const
+    {
+        info.clear();
+
+        for (UInt32 i = 0; i < mSourcesTableSize; i++)
+        {
+            auto& entry = mSources[i];
+
+            AllocSourceInfo sourceInfo;
+            sourceInfo.totalCount = (size_t)entry.totalCount.load(std::memory_order_relaxed);
+            if (sourceInfo.totalCount == 0)
+                continue;
+
+            sourceInfo.source = i == 0 ? "<other>" : entry.source.load(std::memory_order_acquire);
+            if (!sourceInfo.source)
+                continue;
+
+            sourceInfo.sourceLine = entry.sourceLine.load(std::memory_order_relaxed);
+            sourceInfo.count = (size_t)std::max<Int64>(0, entry.count.load(std::memory_order_relaxed));
+            sourceInfo.size = (size_t)std::max<Int64>(0, entry.size.load(std::memory_order_relaxed));
+            sourceInfo.peakSize = (size_t)entry.peakSize.load(std::memory_order_relaxed);
+
+            info.push_back(sourceInfo);
         }
+    }
+
+    size_t MemoryManager::GetTotalAllocatedSize() const
+    {
+        Int64 res = 0;
+        for (UInt32 i = 0; i < mSourcesTableSize; i++)
+            res += mSources[i].size.load(std::memory_order_relaxed);
+
+        return (size_t)std::max<Int64>(0, res);
+    }
+
+    size_t MemoryManager::GetAllocationSize(void* memory) const
+    {
+        if (!memory)
+            return 0;
+
+#if ENABLE_MEMORY_MANAGE
+        return GetHeader(memory)->size;
+#else
+        return 0;
+#endif
+    }
+
+    void MemoryManager::DumpInfo()
+    {
+        printf("========MemoryManager::DumpInfo==========\n");
+
+        printf("Total managed allocations: %f MB\n", (float)GetTotalAllocatedSize() / 1024.0f / 1024.0f);
+
+        std::vector<AllocSourceInfo> allocs;
+        GetAllocationsInfo(allocs);
 
-        std::sort(allocs.begin(), allocs.end());
+        allocs.erase(std::remove_if(allocs.begin(), allocs.end(), [](auto& x) { return x.count == 0; }), allocs.end());
+        std::sort(allocs.begin(), allocs.end(), [](auto& a, auto& b) { return a.size < b.size; });
 
         for (int i = 0; i < (int)allocs.size(); i++)
         {
-            printf("%i: %s : %i - %zi bytes (%f MB) in %i allocs\n",
-                   i, allocs[i].source, allocs[i].line, allocs[i].size,
-                   (float)allocs[i].size / 1024.0f / 1024.0f, allocs[i].count);
+            printf("%i: %s : %i - %zi bytes (%f MB) in %zi allocs, peak %f MB\n",
+                   i, allocs[i].source, allocs[i].sourceLine, allocs[i].size,
+                   (float)allocs[i].size / 1024.0f / 1024.0f, allocs[i].count,
+                   (float)allocs[i].peakSize / 1024.0f / 1024.0f);
         }
 
         printf("========END==========\n");
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <algorithm>
-#include <vector>
+#include <atomic>
+#include <cstddef>
 #include <map>
+#include <new>
+#include <vector>
 
 #include "o2/EngineSettings.h"
 #include "o2/Utils/Types/CommonTypes.h"
@@ -31,12 +34,6 @@ void  operator delete(void* allocMemory, const char* location, int line);
 // Delete operator with source and line arguments
 void  operator delete[](void* allocMemory, const char* location, int line);
 
-// Overloaded delete operator
-void  operator delete(void* allocMemory) noexcept;
-
-// Overloaded delete operator
-void  operator delete[](void* allocMemory) noexcept;
-
 // Managed malloc() with source and line arguments
 void* _mmalloc(size_t size, const char* location, int line);
 
@@ -47,11 +44,30 @@ namespace o2
 {
     class LogStream;
 
-    // ------------------------------------------------------------------
-    // Memory manager, using for collecting garbage, tracing memory leaks
-    // ------------------------------------------------------------------
+    // -------------------------------------------------------------------------------------------------------
+    // Memory manager, using for tracing memory leaks. Works only when ENABLE_MEMORY_MANAGE is enabled: then
+    // global new and delete are replaced and every allocation has header with size, allocation source index
+    // and tag. Allocations by mnew, mmalloc and mmake are registered by source (file and line) and released
+    // by regular delete or mfree, other allocations aren't counted. Registering and releasing don't need any
+    // lookups or locks, statistics are collected in lock-free table, safe for any thread
+    // -------------------------------------------------------------------------------------------------------
     class MemoryManager
     {
+    public:
+        // ------------------------------------
+        // Allocations statistics by one source
+        // ------------------------------------
+        struct AllocSourceInfo
+        {
+            const char* source = nullptr; // Allocation source code file
+            int         sourceLine = 0;   // Allocation source code line
+
+            size_t count = 0;      // Current allocations count
+            size_t size = 0;       // Current allocated size in bytes
+            size_t peakSize = 0;   // Peak allocated size in bytes
+            size_t totalCount = 0; // Allocations count for all time
+        };
+
     public:
         // Constructor
         MemoryManager();
@@ -65,40 +81,82 @@ namespace o2
         // Initializes memory manager
         static void Initialize();
 
+        // Collects allocations statistics by sources. Can be called from any thread
+        void GetAllocationsInfo(std::vector<AllocSourceInfo>& info) const;
+
+        // Returns total managed allocated bytes
+        size_t GetTotalAllocatedSize() const;
+
+        // Returns size of allocation. Memory must be allocated by mnew, mmalloc or new. Returns 0 when memory managing is disabled
+        size_t GetAllocationSize(void* memory) const;
+
         // Collects information about allocated memory and prints into console
         void DumpInfo();
 
     protected:
-        // ----------------------
-        // Allocation information
-        // ----------------------
-        struct AllocInfo
+        // -----------------------------------------------------------------------------------------
+        // Managed allocation header. Placed before memory returned to user, keeps user memory aligned
+        // -----------------------------------------------------------------------------------------
+        struct alignas(alignof(std::max_align_t)) AllocHeader
         {
-            const char* source;     // Allocation source code file
-            int         sourceLine; // Allocation source code line
-            size_t      size;       // Allocated size in bytes
-            void*       memory;     // Pointer to allocated memory
+            size_t size;      // Allocated size in bytes
+            UInt32 sourceIdx; // Index of allocation source in sources table
+            UInt32 tag;       // Managed allocation tag, checked on release to catch foreign memory
+        };
 
-            int markIndex = 0; // Mark index for memory analyzer
+        // ----------------------------------------------------------------------
+        // Allocation source entry. Aligned to cache line to avoid false sharing
+        // ----------------------------------------------------------------------
+        struct alignas(64) AllocSource
+        {
+            std::atomic<UInt64>      key;        // Source key, hash of file name and line. Zero when entry is free
+            std::atomic<const char*> source;     // Allocation source code file
+            std::atomic<int>         sourceLine; // Allocation source code line
+
+            std::atomic<Int64>  count;      // Current allocations count
+            std::atomic<Int64>  size;       // Current allocated size in bytes
+            std::atomic<Int64>  peakSize;   // Peak allocated size in bytes
+            std::atomic<UInt64> totalCount; // Allocations count for all time
         };
 
+        static constexpr UInt32 mSourcesTableSize = 4096;    // Size of allocation sources table, power of two
+        static constexpr UInt32 mAllocHeaderTag = 0x6F324D41; // Managed allocation header tag
+        static constexpr UInt32 mUntrackedSourceIdx = ~0u;    // Source index of allocations without source, they aren't counted
+
         static MemoryManager* mInstance; // Instance pointer
 
-        std::map<void*, AllocInfo> mAllocs;     // Allocations info
-        size_t                     mTotalBytes; // Total managed allocated bytes
+        static AllocSource mSources[mSourcesTableSize]; // Allocation sources table. First entry collects sources that doesn't fit into table
 
     protected:
-        // Called when memory was allocated and registers allocation
-        void OnMemoryAllocate(void* memory, size_t size, const char* source, int line);
+        // Allocates memory with header and registers allocation. Allocation without source isn't registered
+        static void* Allocate(size_t size, const char* source, int line);
+
+        // Unregisters allocation and releases memory. Memory must be allocated by Allocate
+        static void Release(void* memory);
 
-        // Called when memory releasing, unregisters allocation
-        void OnMemoryRelease(void* memory);
+        // Returns allocation header of memory allocated by Allocate
+        static AllocHeader* GetHeader(void* memory);
+
+        // Returns allocation source key: hash of file name and line. Same file names from different units have same key
+        static UInt64 GetAllocSourceKey(const char* source, int line);
+
+        // Searches or adds allocation source into table, returns index
+        static UInt32 GetAllocSourceIdx(const char* source, int line);
 
         friend void* ::operator new(size_t size, const char* location, int line);
         friend void* ::operator new[](size_t size, const char* location, int line);
-        friend void  ::operator delete(void* allocMemory) noexcept;
         friend void* ::_mmalloc(size_t size, const char* location, int line);
         friend void  ::_mfree(void* allocMemory);
+
+        friend void* ::operator new(size_t size);
+        friend void* ::operator new(size_t size, const std::nothrow_t&) noexcept;
+        friend void* ::operator new[](size_t size, const std::nothrow_t&) noexcept;
+        friend void  ::operator delete(void* allocMemory) noexcept;
+        friend void  ::operator delete[](void* allocMemory) noexcept;
+        friend void  ::operator delete(void* allocMemory, size_t size) noexcept;
+        friend void  ::operator delete[](void* allocMemory, size_t size) noexcept;
+        friend void  ::operator delete(void* allocMemory, const std::nothrow_t&) noexcept;
+        friend void  ::operator delete[](void* allocMemory, const std::nothrow_t&) noexcept;
         friend class MemoryAnalyzer;
     };
 }
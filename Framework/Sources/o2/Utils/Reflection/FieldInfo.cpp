@@ -11,12 +11,12 @@ namespace o2
     FieldInfo::FieldInfo(const Type* ownerType, const String& name, GetValuePointerFuncPtr pointerGetter, const Type* type,
                          ProtectSection section, IDefaultValue* defaultValue /*= nullptr*/, 
                          ITypeSerializer* serializer /*= nullptr*/):
-        mOwnerType(ownerType), mName(name), mPointerGetter(pointerGetter), mType(type), mProtectSection(section),
+        mOwnerType(ownerType), mName(name), mNameId(name), mPointerGetter(pointerGetter), mType(type), mProtectSection(section),
         mSerializer(serializer ? serializer : mType->GetSerializer()), mDefaultValue(defaultValue)
     {}
 
     FieldInfo::FieldInfo(FieldInfo&& other):
-        mProtectSection(other.mProtectSection), mName(other.mName), mType(other.mType), mOwnerType(other.mOwnerType),
+        mProtectSection(other.mProtectSection), mName(other.mName), mNameId(other.mNameId), mType(other.mType), mOwnerType(other.mOwnerType),
         mAttributes(other.mAttributes), mSerializer(other.mSerializer), mDefaultValue(other.mDefaultValue), 
         mPointerGetter(other.mPointerGetter)
     {
@@ -48,6 +48,11 @@ namespace o2
         return mName;
     }
 
+    const NameId& FieldInfo::GetNameId() const
+    {
+        return mNameId;
+    }
+
     void FieldInfo::SetProtectSection(ProtectSection section)
     {
         mProtectSection = section;
@@ -4,6 +4,7 @@
 #include "o2/Utils/Types/CommonTypes.h"
 #include "o2/Utils/Types/Containers/Map.h"
 #include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/NameId.h"
 #include "o2/Utils/Types/String.h"
 
 namespace o2
@@ -62,6 +63,9 @@ namespace o2
         // Returns name of field
         const String& GetName() const;
 
+        // Returns interned name of field
+        const NameId& GetNameId() const;
+
         // Sets protection section
         void SetProtectSection(ProtectSection section);
 
@@ -126,6 +130,7 @@ namespace o2
     protected:
         ProtectSection         mProtectSection = ProtectSection::Public; // Protection section
         String                 mName;                                    // Name of field
+        NameId                 mNameId;                                  // Interned name of field, used for searching
         const Type*            mType = nullptr;                          // Field type
         const Type*            mOwnerType = nullptr;                     // Field owner type
         Vector<IAttribute*>    mAttributes;                              // Attributes array
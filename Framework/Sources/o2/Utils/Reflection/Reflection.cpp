@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "Reflection.h"
 
+#include <unordered_set>
 #include "o2/Utils/Serialization/DataValue.h"
 #include "o2/Utils/Basic/IObject.h"
 #include "o2/Utils/Math/Basis.h"
@@ -88,6 +89,8 @@ namespace o2
 
         mInstance->mInitializingFunctions.Clear();
         mInstance->mTypesInitialized = true;
+
+        UpdateTypesAncestry();
     }
 
     const Map<String, Type*>& Reflection::GetTypes()
@@ -125,6 +128,68 @@ namespace o2
         return mInstance->mTypesInitialized;
     }
 
+    void Reflection::UpdateTypesAncestry()
+    {
+        // Sorting types topologically, base types go before derived. Some base types, like IObject, aren't
+        // registered in types map, they are collected through base types of registered types
+        Vector<Type*> sortedTypes;
+        std::unordered_set<Type*> visitedTypes;
+
+        Function<void(Type*)> sortType = [&](Type* type)
+        {
+            if (!visitedTypes.insert(type).second)
+                return;
+
+            for (auto& baseType : type->mBaseTypes)
+                sortType(const_cast<Type*>(baseType.type));
+
+            sortedTypes.Add(type);
+        };
+
+        for (auto& kv : mInstance->mTypes)
+            sortType(kv.second);
+
+        for (auto type : sortedTypes)
+        {
+            type->mAncestorIndex = -1;
+            type->mAncestorsBits.Clear();
+            type->mAncestryComputed = false;
+        }
+
+        // Only types with derived types get bits, so bitsets are short
+        int ancestorsCount = 0;
+        for (auto type : sortedTypes)
+        {
+            for (auto& baseType : type->mBaseTypes)
+            {
+                Type* base = const_cast<Type*>(baseType.type);
+                if (base->mAncestorIndex < 0)
+                    base->mAncestorIndex = ancestorsCount++;
+            }
+        }
+
+        for (auto type : sortedTypes)
+        {
+            for (auto& baseType : type->mBaseTypes)
+            {
+                const Type* base = baseType.type;
+                Assert(base->mAncestryComputed && base->mAncestorIndex >= 0,
+                       "Base type ancestry must be computed before derived type");
+
+                int words = Math::Max(base->mAncestorsBits.Count(), (base->mAncestorIndex >> 6) + 1);
+                while (type->mAncestorsBits.Count() < words)
+                    type->mAncestorsBits.Add(0);
+
+                for (int i = 0; i < base->mAncestorsBits.Count(); i++)
+                    type->mAncestorsBits[i] |= base->mAncestorsBits[i];
+
+                type->mAncestorsBits[base->mAncestorIndex >> 6] |= 1ull << (base->mAncestorIndex & 63);
+            }
+
+            type->mAncestryComputed = true;
+        }
+    }
+
     FunctionType* Reflection::InitializeFunctionType(const char* name)
     {
         FunctionType* res = mnew FunctionType(name);
@@ -74,6 +74,9 @@ namespace o2
         // Returns is types was initialized
         static bool IsTypesInitialized();
 
+        // Computes ancestors bitsets of all types for constant time Type::IsBasedOn. Called after types initialization
+        static void UpdateTypesAncestry();
+
     public:
         // Initializes regular type
         template<typename _type>
@@ -428,6 +431,10 @@ namespace o2
         baseTypeInfo.dynamicCastDownFunc = &CastSelector<_base_type, _object_type>::CastType::CastFunc;
 
         type->mBaseTypes.Add(baseTypeInfo);
+
+        // Type is initialized after others, ancestry must be rebuilt
+        if (Reflection::IsTypesInitialized())
+            Reflection::UpdateTypesAncestry();
     }
 
     template<typename _attribute_type, typename ... _args>
@@ -49,11 +49,18 @@ namespace o2
         if (mId == other.mId)
             return true;
 
-        for (auto typeInfo : mBaseTypes)
+        // Type without computed ancestry has no ancestor index, it can be registered after ancestry update
+        if (mAncestryComputed && other.mAncestryComputed)
         {
-            if (typeInfo.type->mId == mId)
-                return true;
+            if (other.mAncestorIndex < 0)
+                return false;
+
+            int word = other.mAncestorIndex >> 6;
+            return word < mAncestorsBits.Count() && (mAncestorsBits[word] & (1ull << (other.mAncestorIndex & 63))) != 0;
+        }
 
+        for (auto& typeInfo : mBaseTypes)
+        {
             if (typeInfo.type->IsBasedOn(other))
                 return true;
         }
@@ -123,10 +130,19 @@ namespace o2
     }
 
     const FieldInfo* Type::GetField(const String& name) const
+    {
+        NameId nameId = NameId::Find(name);
+        if (nameId.IsEmpty())
+            return nullptr;
+
+        return GetField(nameId);
+    }
+
+    const FieldInfo* Type::GetField(const NameId& name) const
     {
         for (auto& field : mFields)
         {
-            if (field.GetName() == name)
+            if (field.mNameId == name)
                 return &field;
         }
 
@@ -204,11 +220,17 @@ namespace o2
     void* Type::GetFieldPtr(void* object, const String& path, const FieldInfo*& fieldInfo) const
     {
         int delPos = path.Find("/");
-        String pathPart = path.SubStr(0, delPos);
+
+        // Path part is looked up by view, without allocating substring
+        std::string_view pathPartView(path);
+        if (delPos >= 0)
+            pathPartView = pathPartView.substr(0, delPos);
+
+        NameId pathPart = NameId::Find(pathPartView);
 
         for (auto& field : mFields)
         {
-            if (field.mName == pathPart)
+            if (field.mNameId == pathPart)
             {
                 fieldInfo = &field;
 
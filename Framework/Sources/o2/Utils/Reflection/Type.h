@@ -19,6 +19,7 @@ namespace o2
     class FunctionInfo;
     class IAbstractValueProxy;
     class IObject;
+    class NameId;
     class StaticFunctionInfo;
     class Type;
     struct ITypeSerializer;
@@ -79,7 +80,7 @@ namespace o2
         // Returns size of type in bytes
         int GetSize() const;
 
-        // Is this type based on other
+        // Is this type based on other. Checks precomputed ancestors bitset, works in constant time after types initialization
         bool IsBasedOn(const Type& other) const;
 
         // Returns type usage
@@ -109,6 +110,9 @@ namespace o2
         // Returns field information by name
         const FieldInfo* GetField(const String& name) const;
 
+        // Returns field information by interned name
+        const FieldInfo* GetField(const NameId& name) const;
+
         // Returns function info by name
         const FunctionInfo* GetFunction(const String& name) const;
 
@@ -175,6 +179,10 @@ namespace o2
 
         Vector<BaseType> mBaseTypes; // Base types ids with offset 
 
+        int            mAncestorIndex = -1;       // Index of bit in ancestors bitsets, -1 when there are no types based on this
+        Vector<UInt64> mAncestorsBits;            // Bitset of all direct and indirect base types by their ancestor indices
+        bool           mAncestryComputed = false; // Is ancestors bitset computed; when false, IsBasedOn searches base types recursively
+
         Vector<FieldInfo>           mFields;          // Fields information
         Vector<FunctionInfo*>       mFunctions;       // Functions informations
         Vector<StaticFunctionInfo*> mStaticFunctions; // Functions informations
@@ -765,8 +773,7 @@ typedef void* (*GetValuePointerFuncPtr)(void*);
     }                                                                                                          \
     TEMPLATE_OPT void CLASS::ReflectIntoScriptValue(o2::ScriptValue& scriptValue) const                        \
     {                                                                                                          \
-        o2::ReflectScriptValueTypeProcessor processor(scriptValue);                                            \
-        ProcessType<o2::ReflectScriptValueTypeProcessor>(const_cast<CLASS*>(this), processor);                 \
+        o2::CheckReflectValueOverridden<CLASS>::Process(const_cast<CLASS*>(this), scriptValue);                \
     }                                                                                                           
 #else
 #define DECLARE_SCRIPTING(CLASS, TEMPLATE_OPT)
@@ -0,0 +1,338 @@
+#include "o2/stdafx.h"
+#include "BinaryDataFormat.h"
+
+#include "o2/Utils/Serialization/JsonDataFormat.h"
+
+namespace o2
+{
+    // -----------------------------------------------------------------------------
+    // Binary data reader. Reads tokens and passes them into document parse handler
+    // -----------------------------------------------------------------------------
+    class BinaryDataReader
+    {
+    public:
+        BinaryDataReader(const char* data, int size):
+            mCaret((const UInt8*)data), mEnd((const UInt8*)data + size)
+        {}
+
+        // Reads all tokens into handler. Returns false when data is corrupted: elements counts are checked before
+        // passing to handler, because handler pops them from stack
+        bool Parse(JsonDataDocumentParseHandler& handler)
+        {
+            mContainers.Clear();
+
+            do
+            {
+                if (mCaret >= mEnd)
+                    return false;
+
+                auto token = (BinaryDataWriter::Token)*mCaret++;
+
+                // Object members keys must be strings
+                if (!mContainers.IsEmpty() && mContainers.Last().isObject && mContainers.Last().elementsCount % 2 == 0 &&
+                    token != BinaryDataWriter::Token::String && token != BinaryDataWriter::Token::EndObject)
+                {
+                    return false;
+                }
+
+                switch (token)
+                {
+                case BinaryDataWriter::Token::Null: handler.Null(); break;
+                case BinaryDataWriter::Token::BoolTrue: handler.Bool(true); break;
+                case BinaryDataWriter::Token::BoolFalse: handler.Bool(false); break;
+
+                case BinaryDataWriter::Token::Int:
+                {
+                    uint64_t value;
+                    if (!ReadVarUInt(value))
+                        return false;
+
+                    handler.Int((int)DecodeZigZag(value));
+                    break;
+                }
+
+                case BinaryDataWriter::Token::UInt:
+                {
+                    uint64_t value;
+                    if (!ReadVarUInt(value))
+                        return false;
+
+                    handler.Uint((unsigned)value);
+                    break;
+                }
+
+                case BinaryDataWriter::Token::Int64:
+                {
+                    uint64_t value;
+                    if (!ReadVarUInt(value))
+                        return false;
+
+                    handler.Int64(DecodeZigZag(value));
+                    break;
+                }
+
+                case BinaryDataWriter::Token::UInt64:
+                {
+                    uint64_t value;
+                    if (!ReadVarUInt(value))
+                        return false;
+
+                    handler.Uint64(value);
+                    break;
+                }
+
+                case BinaryDataWriter::Token::Double:
+                {
+                    if (mEnd - mCaret < (int)sizeof(double))
+                        return false;
+
+                    double value;
+                    memcpy(&value, mCaret, sizeof(double));
+                    mCaret += sizeof(double);
+                    handler.Double(value);
+                    break;
+                }
+
+                case BinaryDataWriter::Token::String:
+                {
+                    uint64_t length;
+                    if (!ReadVarUInt(length) || (uint64_t)(mEnd - mCaret) < length)
+                        return false;
+
+                    handler.String((const char*)mCaret, (unsigned)length, true);
+                    mCaret += length;
+                    break;
+                }
+
+                case BinaryDataWriter::Token::StartObject:
+                    handler.StartObject();
+                    mContainers.Add({ true, 0 });
+                    continue;
+
+                case BinaryDataWriter::Token::StartArray:
+                    handler.StartArray();
+                    mContainers.Add({ false, 0 });
+                    continue;
+
+                case BinaryDataWriter::Token::EndObject:
+                case BinaryDataWriter::Token::EndArray:
+                {
+                    bool isObject = token == BinaryDataWriter::Token::EndObject;
+
+                    uint64_t count;
+                    if (mContainers.IsEmpty() || mContainers.Last().isObject != isObject || !ReadVarUInt(count))
+                        return false;
+
+                    // Object member is key and value
+                    uint64_t elementsCount = mContainers.Last().elementsCount;
+                    if (isObject ? (elementsCount % 2 != 0 || count != elementsCount/2) : count != elementsCount)
+                        return false;
+
+                    if (isObject)
+                        handler.EndObject((unsigned)count);
+                    else
+                        handler.EndArray((unsigned)count);
+
+                    mContainers.PopBack();
+                    break;
+                }
+
+                default:
+                    return false;
+                }
+
+                // Value is read, counting it in parent container
+                if (!mContainers.IsEmpty())
+                    mContainers.Last().elementsCount++;
+
+            } while (!mContainers.IsEmpty());
+
+            return true;
+        }
+
+    protected:
+        // Opened container info
+        struct Container
+        {
+            bool     isObject;      // Is container object or array
+            uint64_t elementsCount; // Count of read values in container. Keys are counted in objects too
+        };
+
+    protected:
+        const UInt8* mCaret; // Current reading position
+        const UInt8* mEnd;   // End of data
+
+        Vector<Container> mContainers; // Stack of opened containers
+
+    protected:
+        // Reads variable-length unsigned integer
+        bool ReadVarUInt(uint64_t& value)
+        {
+            value = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                if (mCaret >= mEnd)
+                    return false;
+
+                UInt8 b = *mCaret++;
+                value |= (uint64_t)(b & 0x7f) << shift;
+                if ((b & 0x80) == 0)
+                    return true;
+            }
+
+            return false;
+        }
+
+        // Decodes zig-zag encoded signed integer
+        static int64_t DecodeZigZag(uint64_t value)
+        {
+            return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+        }
+    };
+
+    bool ParseBinary(const char* data, int size, DataDocument& document)
+    {
+        JsonDataDocumentParseHandler handler(document);
+        BinaryDataReader reader(data, size);
+        if (reader.Parse(handler))
+        {
+            (DataValue&)document = std::move(*handler.stack.Pop<DataValue>());
+            return true;
+        }
+
+        return false;
+    }
+
+    void WriteBinary(String& str, const DataDocument& document)
+    {
+        str.clear();
+        BinaryDataWriter writer(str);
+        document.Write(writer);
+    }
+
+    BinaryDataWriter::BinaryDataWriter(o2::String& buffer):
+        buffer(buffer)
+    {}
+
+    bool BinaryDataWriter::Null()
+    {
+        WriteToken(Token::Null);
+        return true;
+    }
+
+    bool BinaryDataWriter::Bool(bool value)
+    {
+        WriteToken(value ? Token::BoolTrue : Token::BoolFalse);
+        return true;
+    }
+
+    bool BinaryDataWriter::Int(int value)
+    {
+        WriteToken(Token::Int);
+        WriteVarUInt(((uint64_t)(int64_t)value << 1) ^ (uint64_t)((int64_t)value >> 63));
+        return true;
+    }
+
+    bool BinaryDataWriter::Uint(unsigned value)
+    {
+        WriteToken(Token::UInt);
+        WriteVarUInt(value);
+        return true;
+    }
+
+    bool BinaryDataWriter::Int64(int64_t value)
+    {
+        WriteToken(Token::Int64);
+        WriteVarUInt(((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+        return true;
+    }
+
+    bool BinaryDataWriter::Uint64(uint64_t value)
+    {
+        WriteToken(Token::UInt64);
+        WriteVarUInt(value);
+        return true;
+    }
+
+    bool BinaryDataWriter::Double(double value)
+    {
+        WriteToken(Token::Double);
+        buffer.append((const char*)&value, sizeof(double));
+        return true;
+    }
+
+    bool BinaryDataWriter::String(const char* str, unsigned length, bool copy)
+    {
+        WriteToken(Token::String);
+        WriteVarUInt(length);
+        buffer.append(str, length);
+        return true;
+    }
+
+    bool BinaryDataWriter::StartObject()
+    {
+        WriteToken(Token::StartObject);
+        return true;
+    }
+
+    bool BinaryDataWriter::Key(const char* str, unsigned length, bool copy)
+    {
+        return String(str, length, copy);
+    }
+
+    bool BinaryDataWriter::EndObject(unsigned memberCount)
+    {
+        WriteToken(Token::EndObject);
+        WriteVarUInt(memberCount);
+        return true;
+    }
+
+    bool BinaryDataWriter::StartArray()
+    {
+        WriteToken(Token::StartArray);
+        return true;
+    }
+
+    bool BinaryDataWriter::EndArray(unsigned elementCount)
+    {
+        WriteToken(Token::EndArray);
+        WriteVarUInt(elementCount);
+        return true;
+    }
+
+    void BinaryDataWriter::WriteToken(Token token)
+    {
+        buffer.push_back((char)token);
+    }
+
+    void BinaryDataWriter::WriteVarUInt(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            buffer.push_back((char)((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+
+        buffer.push_back((char)value);
+    }
+}
+// --- META ---
+
+ENUM_META(o2::BinaryDataWriter::Token)
+{
+    ENUM_ENTRY(BoolFalse);
+    ENUM_ENTRY(BoolTrue);
+    ENUM_ENTRY(Double);
+    ENUM_ENTRY(EndArray);
+    ENUM_ENTRY(EndObject);
+    ENUM_ENTRY(Int);
+    ENUM_ENTRY(Int64);
+    ENUM_ENTRY(Null);
+    ENUM_ENTRY(StartArray);
+    ENUM_ENTRY(StartObject);
+    ENUM_ENTRY(String);
+    ENUM_ENTRY(UInt);
+    ENUM_ENTRY(UInt64);
+}
+END_ENUM_META;
+// --- END META ---
@@ -0,0 +1,57 @@
+#pragma once
+#include "DataValue.h"
+
+namespace o2
+{
+    // Parses binary document into DataDocument. All strings are copied into document
+    bool ParseBinary(const char* data, int size, DataDocument& document);
+
+    // Writes data into compact binary string
+    void WriteBinary(String& str, const DataDocument& document);
+
+    // -------------------------------------------------------------------------------------
+    // Compact binary data writer. Has the same interface as json writer, so DataValue::Write
+    // can be used with it. Numbers are stored as variable-length integers, strings are
+    // length-prefixed, objects and arrays are closed with elements count
+    // -------------------------------------------------------------------------------------
+    class BinaryDataWriter
+    {
+    public:
+        enum class Token
+        {
+            Null, BoolTrue, BoolFalse, Int, UInt, Int64, UInt64, Double, String,
+            StartObject, EndObject, StartArray, EndArray
+        };
+
+    public:
+        o2::String& buffer;
+
+    public:
+        BinaryDataWriter(o2::String& buffer);
+
+        bool Null();
+        bool Bool(bool value);
+        bool Int(int value);
+        bool Uint(unsigned value);
+        bool Int64(int64_t value);
+        bool Uint64(uint64_t value);
+        bool Double(double value);
+        bool String(const char* str, unsigned length, bool copy);
+        bool StartObject();
+        bool Key(const char* str, unsigned length, bool copy);
+        bool EndObject(unsigned memberCount);
+        bool StartArray();
+        bool EndArray(unsigned elementCount);
+
+    protected:
+        // Writes token byte
+        void WriteToken(Token token);
+
+        // Writes variable-length unsigned integer
+        void WriteVarUInt(uint64_t value);
+    };
+}
+// --- META ---
+
+PRE_ENUM_META(o2::BinaryDataWriter::Token);
+// --- END META ---
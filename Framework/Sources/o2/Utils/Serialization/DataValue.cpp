@@ -2,6 +2,7 @@
 #include "DataValue.h"
 
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/Serialization/BinaryDataFormat.h"
 #include "o2/Utils/Serialization/JsonDataFormat.h"
 
 #include "rapidjson/document.h"
@@ -728,6 +729,16 @@ namespace o2
             return false;
 
         auto size = file.GetDataSize();
+
+        if (format == Format::Binary)
+        {
+            String data;
+            data.resize(size);
+            file.ReadData(data.data(), size);
+
+            return ParseBinary(data.Data(), data.Length(), *this);
+        }
+
         char* data = (char*)mAllocator.Allocate(size);
         file.ReadData(data, size);
 
@@ -742,6 +753,9 @@ namespace o2
         if (format == Format::JSON)
             return ParseJson(data.Data(), *this);
 
+        if (format == Format::Binary)
+            return ParseBinary(data.Data(), data.Length(), *this);
+
         return false;
     }
 
@@ -770,6 +784,13 @@ namespace o2
             return buf;
         }
 
+        if (format == Format::Binary)
+        {
+            String buf;
+            WriteBinary(buf, *this);
+            return buf;
+        }
+
         return "";
         //return XmlDataFormat::SaveDataDoc(*this);
     }
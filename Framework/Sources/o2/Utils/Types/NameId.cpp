@@ -0,0 +1,156 @@
+#include "o2/stdafx.h"
+#include "NameId.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace o2
+{
+    // ---------------------------------------------------------------
+    // Names pool. Keys are views of entries strings, guarded by mutex
+    // ---------------------------------------------------------------
+    struct NameId::Pool
+    {
+        std::mutex                                   mutex;
+        std::unordered_map<std::string_view, Entry*> entries;
+    };
+
+    NameId::NameId()
+    {}
+
+    NameId::NameId(const String& name):
+        mEntry(Intern(name, true))
+    {}
+
+    NameId::NameId(const char* name):
+        mEntry(Intern(name, true))
+    {}
+
+    NameId::NameId(const NameId& other):
+        mEntry(other.mEntry)
+    {
+        if (mEntry)
+            mEntry->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    NameId::NameId(NameId&& other) noexcept:
+        mEntry(other.mEntry)
+    {
+        other.mEntry = nullptr;
+    }
+
+    NameId::~NameId()
+    {
+        Release(mEntry);
+    }
+
+    NameId& NameId::operator=(const NameId& other)
+    {
+        if (mEntry != other.mEntry)
+        {
+            if (other.mEntry)
+                other.mEntry->refs.fetch_add(1, std::memory_order_relaxed);
+
+            Release(mEntry);
+            mEntry = other.mEntry;
+        }
+
+        return *this;
+    }
+
+    NameId& NameId::operator=(NameId&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Release(mEntry);
+            mEntry = other.mEntry;
+            other.mEntry = nullptr;
+        }
+
+        return *this;
+    }
+
+    bool NameId::IsEmpty() const
+    {
+        return mEntry == nullptr;
+    }
+
+    const String& NameId::GetString() const
+    {
+        static const String emptyString;
+        return mEntry ? mEntry->string : emptyString;
+    }
+
+    size_t NameId::GetHash() const
+    {
+        return mEntry ? mEntry->hash : 0;
+    }
+
+    NameId::Pool& NameId::GetPool()
+    {
+        // Pool is never destroyed, names can be interned and released while static initialization and deinitialization
+        static Pool* pool = new Pool();
+        return *pool;
+    }
+
+    NameId NameId::Find(std::string_view name)
+    {
+        NameId res;
+        res.mEntry = Intern(name, false);
+        return res;
+    }
+
+    NameId::Entry* NameId::Intern(std::string_view name, bool create)
+    {
+        if (name.empty())
+            return nullptr;
+
+        auto& pool = GetPool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        // Entry is referenced under lock, so it can't be removed by releasing last reference concurrently
+        auto fnd = pool.entries.find(name);
+        if (fnd != pool.entries.end())
+        {
+            auto entry = fnd->second;
+            entry->refs.fetch_add(1, std::memory_order_relaxed);
+            return entry;
+        }
+
+        if (!create)
+            return nullptr;
+
+        Entry* entry = new Entry();
+        entry->string.assign(name.data(), name.size());
+        entry->hash = std::hash<std::string_view>()(name);
+        entry->refs = 1;
+
+        pool.entries.emplace(std::string_view(entry->string), entry);
+
+        return entry;
+    }
+
+    void NameId::Release(Entry* entry)
+    {
+        if (!entry)
+            return;
+
+        // Not last reference is released without lock
+        int refs = entry->refs.load(std::memory_order_relaxed);
+        while (refs > 1)
+        {
+            if (entry->refs.compare_exchange_weak(refs, refs - 1, std::memory_order_acq_rel))
+                return;
+        }
+
+        // Last reference is released under lock, entry can be found and referenced again until then
+        auto& pool = GetPool();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        if (entry->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            pool.entries.erase(std::string_view(entry->string));
+            delete entry;
+        }
+    }
+}
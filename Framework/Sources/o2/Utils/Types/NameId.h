@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <string_view>
+#include "o2/Utils/Types/String.h"
+
+namespace o2
+{
+    // -------------------------------------------------------------------------------------------------------------
+    // Interned name. Names with same text share one entry in global names pool, so comparing is pointer equality and
+    // hash is computed once when name is interned. Entries are reference counted and removed from pool when last
+    // name referencing them is destroyed, so renamed and destroyed actors don't grow the pool
+    // -------------------------------------------------------------------------------------------------------------
+    class NameId
+    {
+    public:
+        // Default constructor, empty name
+        NameId();
+
+        // Constructor from string, interns name into pool
+        explicit NameId(const String& name);
+
+        // Constructor from string, interns name into pool
+        explicit NameId(const char* name);
+
+        // Copy-constructor
+        NameId(const NameId& other);
+
+        // Move-constructor
+        NameId(NameId&& other) noexcept;
+
+        // Destructor, releases pool entry
+        ~NameId();
+
+        // Copy-operator
+        NameId& operator=(const NameId& other);
+
+        // Move-operator
+        NameId& operator=(NameId&& other) noexcept;
+
+        // Check equals operator
+        bool operator==(const NameId& other) const { return mEntry == other.mEntry; }
+
+        // Check not equals operator
+        bool operator!=(const NameId& other) const { return mEntry != other.mEntry; }
+
+        // Less operator, compares entries addresses. Order isn't alphabetical and differs between launches
+        bool operator<(const NameId& other) const { return mEntry < other.mEntry; }
+
+        // Returns is name empty
+        bool IsEmpty() const;
+
+        // Returns name string
+        const String& GetString() const;
+
+        // Returns hash of name string
+        size_t GetHash() const;
+
+        // Returns interned name without adding into pool. Returns empty name if it isn't interned: nothing has
+        // this name, so lookups can be finished without comparing
+        static NameId Find(std::string_view name);
+
+    private:
+        struct Entry
+        {
+            String           string;   // Name string
+            size_t           hash;     // Hash of string
+            std::atomic<int> refs = 0; // Count of names referencing entry
+        };
+
+        struct Pool;
+
+        Entry* mEntry = nullptr; // Pool entry, nullptr for empty name
+
+    private:
+        // Returns names pool
+        static Pool& GetPool();
+
+        // Returns referenced pool entry for name, creates it if required
+        static Entry* Intern(std::string_view name, bool create);
+
+        // Releases reference to entry. Removes entry from pool when it isn't referenced anymore
+        static void Release(Entry* entry);
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<o2::NameId>
+    {
+        std::size_t operator()(const o2::NameId& k) const
+        {
+            return k.GetHash();
+        }
+    };
+}
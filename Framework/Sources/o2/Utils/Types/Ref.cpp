@@ -9,12 +9,12 @@ namespace o2
 
     UInt16 RefCounterable::GetStrongReferencesCount() const
     {
-        return GetRefCounter()->strongReferences;
+        return GetRefCounter()->GetStrongCount();
     }
 
     UInt16 RefCounterable::GetWeakReferencesCount() const
     {
-        return GetRefCounter()->weakReferences;
+        return GetRefCounter()->GetWeakCount();
     }
 
     RefCounter* RefCounterable::GetRefCounter() const
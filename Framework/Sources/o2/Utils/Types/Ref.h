@@ -1,8 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include "Containers/Vector.h"
+#include "o2/EngineSettings.h"
 #include "o2/Utils/Memory/MemoryAnalyzeableObject.h"
+#include "o2/Utils/Memory/MemoryManager.h"
 
 namespace o2
 {
@@ -12,13 +15,43 @@ namespace o2
     template<typename _type, typename ... _args>
     Ref<_type> Make(_args&& ... args);
 
-    // --------------------------------
-    // Reference counter implementation
-    // --------------------------------
+    // ------------------------------------------------------------------------------------------------
+    // Reference counter implementation. All strong references together hold one weak reference, so
+    // counter memory is released when the last weak reference is released, after object destruction.
+    // When ENABLE_THREAD_SAFE_REFS is on, counters are atomic and references can be shared between threads
+    // ------------------------------------------------------------------------------------------------
     struct RefCounter
     {
-        UInt strongReferences = 0; // Strong references count
-        UInt weakReferences = 0;   // Weak references count
+#if ENABLE_THREAD_SAFE_REFS
+        typedef std::atomic<UInt> Counter;
+#else
+        typedef UInt Counter;
+#endif
+
+        Counter strongReferences = 0; // Strong references count
+        Counter weakReferences = 1;   // Weak references count, including one reference held by strong references
+
+    public:
+        // Increments strong references count
+        inline void IncrementStrong();
+
+        // Increments strong references count only when object is still alive. Returns false when object was destroyed
+        inline bool TryIncrementStrong();
+
+        // Decrements strong references count. Returns true when it was the last strong reference
+        inline bool DecrementStrong();
+
+        // Increments weak references count
+        inline void IncrementWeak();
+
+        // Decrements weak references count. Returns true when it was the last weak reference and counter can be freed
+        inline bool DecrementWeak();
+
+        // Returns strong references count
+        inline UInt GetStrongCount() const;
+
+        // Returns weak references count, without reference held by strong references
+        inline UInt GetWeakCount() const;
 
     protected:
         template<typename _type>
@@ -232,6 +265,7 @@ namespace o2
 
 #if ENABLE_MEMORY_ANALYZE
         std::byte* GetMemory() const override;
+        size_t GetMemorySize() const override;
         IObject* GetIObject() const override;
         const std::type_info& GetTypeInfo() const override;
 
@@ -373,8 +407,8 @@ namespace o2
         RefMaker() = default;
 
 #if ENABLE_MEMORY_MANAGE
-        const char* location;
-        int line;
+        const char* location = nullptr;
+        int line = 0;
 
         RefMaker(const char* location, int line) :location(location), line(line) {}
 
@@ -398,7 +432,7 @@ namespace o2
 
             auto memory = (std::byte*)allocate(refSize + typeSize);
             auto refCounter = new (memory) RefCounter();
-            refCounter->strongReferences += 1;
+            refCounter->IncrementStrong();
 
             _type* object;
 
@@ -419,12 +453,97 @@ namespace o2
             if constexpr (HasPostRefConstruct<_type>::value)
                 object->PostRefConstruct();
 
-            refCounter->strongReferences -= 1;
+            refCounter->DecrementStrong();
 
             return Ref<_type>(object);
         }
     };
 
+    // RefCounter implementation
+
+#if ENABLE_THREAD_SAFE_REFS
+    void RefCounter::IncrementStrong()
+    {
+        strongReferences.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool RefCounter::TryIncrementStrong()
+    {
+        UInt count = strongReferences.load(std::memory_order_relaxed);
+        while (count != 0)
+        {
+            if (strongReferences.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
+
+        return false;
+    }
+
+    bool RefCounter::DecrementStrong()
+    {
+        return strongReferences.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    void RefCounter::IncrementWeak()
+    {
+        weakReferences.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool RefCounter::DecrementWeak()
+    {
+        return weakReferences.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    UInt RefCounter::GetStrongCount() const
+    {
+        return strongReferences.load(std::memory_order_acquire);
+    }
+
+    UInt RefCounter::GetWeakCount() const
+    {
+        return weakReferences.load(std::memory_order_relaxed) - 1;
+    }
+#else
+    void RefCounter::IncrementStrong()
+    {
+        strongReferences++;
+    }
+
+    bool RefCounter::TryIncrementStrong()
+    {
+        if (strongReferences == 0)
+            return false;
+
+        strongReferences++;
+        return true;
+    }
+
+    bool RefCounter::DecrementStrong()
+    {
+        return --strongReferences == 0;
+    }
+
+    void RefCounter::IncrementWeak()
+    {
+        weakReferences++;
+    }
+
+    bool RefCounter::DecrementWeak()
+    {
+        return --weakReferences == 0;
+    }
+
+    UInt RefCounter::GetStrongCount() const
+    {
+        return strongReferences;
+    }
+
+    UInt RefCounter::GetWeakCount() const
+    {
+        return weakReferences - 1;
+    }
+#endif
+
     // BaseRef implementation
 
     template<typename _type>
@@ -593,10 +712,7 @@ namespace o2
     void Ref<_type>::IncrementRef()
     {
         if (mPtr)
-        {
-            auto refCounter = GetRefCounter(mPtr);
-            refCounter->strongReferences++;
-        }
+            GetRefCounter(mPtr)->IncrementStrong();
     }
 
     template<typename _type>
@@ -605,19 +721,14 @@ namespace o2
         if (mPtr)
         {
             auto refCounter = GetRefCounter(mPtr);
-
-            refCounter->strongReferences--;
-            if (refCounter->strongReferences == 0)
+            if (refCounter->DecrementStrong())
             {
-                refCounter->weakReferences++;
-
+                // Weak reference held by strong references keeps counter alive during destruction
                 DestructObject(mPtr);
 
-                refCounter->weakReferences--;
-
                 mPtr = nullptr;
 
-                if (refCounter->weakReferences == 0)
+                if (refCounter->DecrementWeak())
                     _mfree(refCounter);
             }
         }
@@ -638,6 +749,16 @@ namespace o2
         return nullptr;
     }
 
+    template<typename _type>
+    size_t Ref<_type>::GetMemorySize() const
+    {
+        // Reference counter and object are allocated together by mmalloc in RefMaker
+        if (mPtr)
+            return MemoryManager::Instance().GetAllocationSize(GetRefCounter(mPtr));
+
+        return 0;
+    }
+
     template<typename _type>
     IObject* GetIObjectPtrImpl(_type* ptr)
     {
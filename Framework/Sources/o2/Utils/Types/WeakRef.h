@@ -143,7 +143,8 @@ namespace o2
         mPtr(other.mPtr)
     {
         CheckRefCounter();
-        other.mPtr = nullptr;
+        IncrementWeakRef();
+        other = nullptr;
     }
 
     template<typename _type>
@@ -233,7 +234,8 @@ namespace o2
 
         mPtr = other.mPtr;
         CheckRefCounter();
-        other.mPtr = nullptr;
+        IncrementWeakRef();
+        other = nullptr;
 
         return *this;
     }
@@ -247,7 +249,7 @@ namespace o2
     template<typename _type>
     bool WeakRef<_type>::IsExpired() const
     {
-        return mRefCounter ? mRefCounter->strongReferences == 0 : true;
+        return mRefCounter ? mRefCounter->GetStrongCount() == 0 : true;
     }
 
     template<typename _type>
@@ -259,10 +261,11 @@ namespace o2
     template<typename _type>
     Ref<_type> WeakRef<_type>::Lock() const
     {
-        if (IsExpired())
-            return Ref<_type>();
+        Ref<_type> res;
+        if (mRefCounter && mRefCounter->TryIncrementStrong())
+            res.mPtr = mPtr;
 
-        return Ref<_type>(mPtr);
+        return res;
     }
 
     template<typename _type>
@@ -275,7 +278,7 @@ namespace o2
     void WeakRef<_type>::IncrementWeakRef()
     {
         if (mRefCounter)
-            mRefCounter->weakReferences++;
+            mRefCounter->IncrementWeak();
     }
 
     template<typename _type>
@@ -283,15 +286,11 @@ namespace o2
     {
         if (mRefCounter)
         {
-            mRefCounter->weakReferences--;
-            if (mRefCounter->strongReferences == 0)
+            if (mRefCounter->DecrementWeak())
             {
-                if (mRefCounter->weakReferences == 0)
-                {
-                    _mfree(mRefCounter);
-                    mRefCounter = nullptr;
-                    mPtr = nullptr;
-                }
+                _mfree(mRefCounter);
+                mRefCounter = nullptr;
+                mPtr = nullptr;
             }
         }
     }